@@ -0,0 +1,138 @@
+#ifndef OCCA_BENCHMARK_HEADER
+#define OCCA_BENCHMARK_HEADER
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "occa.hpp"
+
+namespace bench {
+  typedef std::vector<size_t> sizeVector_t;
+
+  //---[ Settings ]-------------------------------
+  class deviceConfig_t {
+  public:
+    std::string mode;
+    int threads;
+    bool precompiledHeaders;
+
+    deviceConfig_t(const std::string &mode_ = "Serial",
+                   const int threads_ = 1,
+                   const bool precompiledHeaders_ = true);
+
+    std::string deviceInfo() const;
+    std::string name() const;
+  };
+
+  class settings_t {
+  public:
+    std::vector<deviceConfig_t> devices;
+    sizeVector_t sizes;
+
+    int warmups, iterations;
+
+    std::string filter;
+    std::string jsonFile, csvFile;
+    std::string cacheDir;
+
+    bool keepCache, verbose;
+
+    settings_t();
+
+    bool runs(const std::string &benchmarkName) const;
+  };
+  //==============================================
+
+
+  //---[ Result ]---------------------------------
+  class result_t {
+  public:
+    std::string benchmark;
+    deviceConfig_t device;
+    size_t size;
+
+    double coldBuildTime, warmBuildTime;
+    double firstLaunchTime;
+    double minTime, avgTime, maxTime;
+
+    double flops, bytes;
+
+    result_t();
+
+    double gflops() const;
+    double gbs() const;
+  };
+  //==============================================
+
+
+  //---[ Benchmark ]------------------------------
+  //  Benchmarks build their kernel with [info] which the runner
+  //    salts to time cold (uncached) and warm (cached) builds
+  class benchmark_t {
+  public:
+    std::string name;
+
+    benchmark_t(const std::string &name_);
+    virtual ~benchmark_t();
+
+    virtual sizeVector_t sizes(const settings_t &settings);
+
+    // Called before the timed builds
+    virtual void prepare(occa::device &device,
+                         occa::kernelInfo info);
+
+    virtual occa::kernel build(occa::device &device,
+                               const size_t size,
+                               occa::kernelInfo info) = 0;
+
+    virtual void setup(occa::device &device,
+                       const size_t size) = 0;
+
+    virtual void run(occa::kernel &kernel) = 0;
+
+    virtual void free() = 0;
+
+    virtual double flops(const size_t size);
+    virtual double bytes(const size_t size);
+  };
+
+  std::string kernelPath(const std::string &filename);
+
+  void addExampleBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addCompileBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addFusionBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addOuterLoopBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addAtomicBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addReductionBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addPrimitiveBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addArrayExpressionBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addMemoryPrimitiveBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addVectorTypeBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addHalfPrecisionBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  void addTextureLayoutBenchmarks(std::vector<benchmark_t*> &benchmarks);
+  //==============================================
+
+
+  //---[ Runner ]---------------------------------
+  void run(std::vector<benchmark_t*> &benchmarks,
+           const settings_t &settings,
+           std::vector<result_t> &results);
+
+  result_t run(benchmark_t &benchmark,
+               const deviceConfig_t &deviceConfig,
+               const size_t size,
+               const settings_t &settings);
+
+  void printResults(std::ostream &out,
+                    const std::vector<result_t> &results);
+
+  void writeJSON(const std::string &filename,
+                 const std::vector<result_t> &results);
+
+  void writeCSV(const std::string &filename,
+                const std::vector<result_t> &results);
+  //==============================================
+}
+
+#endif
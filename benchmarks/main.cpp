@@ -0,0 +1,180 @@
+#include <iostream>
+#include <cstdlib>
+
+#include "benchmark.hpp"
+
+void printUsage();
+
+std::vector<std::string> splitList(const std::string &list);
+
+int main(int argc, char **argv){
+  bench::settings_t settings;
+
+  std::vector<std::string> modes, threads, sizes, pch;
+
+  modes.push_back("Serial");
+  if(occa::hasOpenMPEnabled())
+    modes.push_back("OpenMP");
+  if(occa::hasPthreadsEnabled())
+    modes.push_back("Pthreads");
+
+  threads.push_back("1");
+  if(1 < occa::cpu::getCoreCount())
+    threads.push_back(occa::toString(occa::cpu::getCoreCount()));
+
+  pch.push_back("on");
+
+  sizes.push_back("4096");
+  sizes.push_back("65536");
+  sizes.push_back("1048576");
+
+  for(int i = 1; i < argc; ++i){
+    const std::string arg  = argv[i];
+    const bool hasValue    = ((i + 1) < argc);
+    const std::string value = (hasValue ? argv[i + 1] : "");
+
+    if((arg == "-h") || (arg == "--help")){
+      printUsage();
+      return 0;
+    }
+    else if(arg == "--keep-cache"){
+      settings.keepCache = true;
+    }
+    else if(arg == "--verbose"){
+      settings.verbose = true;
+    }
+    else if(!hasValue){
+      printUsage();
+      return 1;
+    }
+    else {
+      if(arg == "--modes")
+        modes = splitList(value);
+      else if(arg == "--threads")
+        threads = splitList(value);
+      else if(arg == "--sizes")
+        sizes = splitList(value);
+      else if(arg == "--pch")
+        pch = splitList(value);
+      else if(arg == "--iterations")
+        settings.iterations = atoi(value.c_str());
+      else if(arg == "--warmups")
+        settings.warmups = atoi(value.c_str());
+      else if(arg == "--filter")
+        settings.filter = value;
+      else if(arg == "--json")
+        settings.jsonFile = value;
+      else if(arg == "--csv")
+        settings.csvFile = value;
+      else if(arg == "--cache-dir")
+        settings.cacheDir = value;
+      else {
+        printUsage();
+        return 1;
+      }
+
+      ++i;
+    }
+  }
+
+  for(size_t p = 0; p < pch.size(); ++p){
+    const bool usePCH = (pch[p] != "off");
+
+    for(size_t m = 0; m < modes.size(); ++m){
+      if(modes[m] == "Serial"){
+        settings.devices.push_back(bench::deviceConfig_t("Serial", 1, usePCH));
+        continue;
+      }
+
+      for(size_t t = 0; t < threads.size(); ++t)
+        settings.devices.push_back(bench::deviceConfig_t(modes[m], atoi(threads[t].c_str()), usePCH));
+    }
+  }
+
+  for(size_t s = 0; s < sizes.size(); ++s)
+    settings.sizes.push_back(atol(sizes[s].c_str()));
+
+  // Keep benchmark builds out of the user's kernel cache
+  const bool usingScratchCache = (settings.cacheDir.size() == 0);
+
+  if(usingScratchCache)
+    settings.cacheDir = occa::env::OCCA_CACHE_DIR + "benchmarks/";
+
+  occa::env::endDirWithSlash(settings.cacheDir);
+  occa::sys::mkpath(settings.cacheDir);
+  occa::env::OCCA_CACHE_DIR = settings.cacheDir;
+
+  occa::setVerboseCompilation(settings.verbose);
+
+  std::vector<bench::benchmark_t*> benchmarks;
+  std::vector<bench::result_t> results;
+
+  bench::addExampleBenchmarks(benchmarks);
+  bench::addCompileBenchmarks(benchmarks);
+  bench::addFusionBenchmarks(benchmarks);
+  bench::addOuterLoopBenchmarks(benchmarks);
+  bench::addAtomicBenchmarks(benchmarks);
+  bench::addReductionBenchmarks(benchmarks);
+  bench::addPrimitiveBenchmarks(benchmarks);
+  bench::addArrayExpressionBenchmarks(benchmarks);
+  bench::addMemoryPrimitiveBenchmarks(benchmarks);
+  bench::addVectorTypeBenchmarks(benchmarks);
+  bench::addHalfPrecisionBenchmarks(benchmarks);
+  bench::addTextureLayoutBenchmarks(benchmarks);
+
+  bench::run(benchmarks, settings, results);
+
+  if(settings.jsonFile.size())
+    bench::writeJSON(settings.jsonFile, results);
+  if(settings.csvFile.size())
+    bench::writeCSV(settings.csvFile, results);
+
+  for(size_t b = 0; b < benchmarks.size(); ++b)
+    delete benchmarks[b];
+
+  if(usingScratchCache && !settings.keepCache){
+    const std::string command = "rm -rf " + settings.cacheDir;
+    occa::ignoreResult( system(command.c_str()) );
+  }
+
+  return 0;
+}
+
+void printUsage(){
+  std::cout << "  Usage: ./main [options]\n\n"
+
+            << "  Options:\n"
+            << "    --modes      <Serial,OpenMP,Pthreads>  Modes to benchmark\n"
+            << "    --threads    <1,4,...>                 Thread counts for OpenMP and Pthreads\n"
+            << "    --sizes      <4096,65536,...>          Problem sizes (entries or grid points)\n"
+            << "    --pch        <on,off>                  Build with and/or without precompiled headers [on]\n"
+            << "    --iterations <N>                       Timed launches per case [10]\n"
+            << "    --warmups    <N>                       Untimed launches per case [2]\n"
+            << "    --filter     <name>                    Only run benchmarks containing <name>\n"
+            << "    --json       <file>                    Write results as JSON\n"
+            << "    --csv        <file>                    Write results as CSV\n"
+            << "    --cache-dir  <dir>                     Kernel cache used for builds\n"
+            << "                                             [Defaults to a scratch $OCCA_CACHE_DIR/benchmarks/]\n"
+            << "    --keep-cache                           Keep the scratch kernel cache\n"
+            << "    --verbose                              Print kernel compilation output\n";
+}
+
+std::vector<std::string> splitList(const std::string &list){
+  std::vector<std::string> entries;
+  std::string entry;
+
+  for(size_t i = 0; i <= list.size(); ++i){
+    if((i == list.size()) || (list[i] == ',')){
+      occa::strip(entry);
+
+      if(entry.size())
+        entries.push_back(entry);
+
+      entry.clear();
+    }
+    else
+      entry += list[i];
+  }
+
+  return entries;
+}
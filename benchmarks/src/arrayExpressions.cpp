@@ -0,0 +1,108 @@
+#include "occa/array.hpp"
+
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Array Expressions ]----------------------
+  //  Elementwise occa::array expressions next to the STREAM copy,
+  //    each fused expression is one pass and should get close to
+  //    the copy's GB/s
+  //
+  //  [axpy:unfused] splits y = a*x + y in two expressions to show
+  //    the extra pass through a temporary
+  class arrayExprBench : public benchmark_t {
+  public:
+    std::string expr;
+
+    int entries;
+    occa::array<float> x, y, z, tmp;
+
+    arrayExprBench(const std::string &expr_) :
+      benchmark_t("arrayExpr:" + expr_),
+      expr(expr_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      occa::array<float> x_(device, 2), y_(device, 2), z_(device, 2), tmp_(device, 2);
+
+      evaluate(x_, y_, z_, tmp_);
+
+      x_.free();
+      y_.free();
+      z_.free();
+      tmp_.free();
+
+      return device.buildKernelFromSource(kernelPath("kernels/stream.okl"),
+                                          "copy",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      x.allocate(device, entries);
+      y.allocate(device, entries);
+      z.allocate(device, entries);
+      tmp.allocate(device, entries);
+
+      for(int i = 0; i < entries; ++i){
+        x[i] = (float) (i % 17);
+        y[i] = (float) (i % 13);
+        z[i] = 0;
+      }
+
+      x.syncToDevice();
+      y.syncToDevice();
+      z.syncToDevice();
+    }
+
+    void evaluate(occa::array<float> &x_,
+                  occa::array<float> &y_,
+                  occa::array<float> &z_,
+                  occa::array<float> &tmp_){
+      const float a = 0.5f;
+
+      if(expr == "axpy"){
+        y_ = a*x_ + y_;
+      }
+      else if(expr == "axpy:unfused"){
+        tmp_  = a*x_;
+        y_   += tmp_;
+      }
+      else {
+        z_ = sqrt(x_*x_ + y_*y_);
+      }
+    }
+
+    void run(occa::kernel &copy){
+      evaluate(x, y, z, tmp);
+    }
+
+    void free(){
+      x.free();
+      y.free();
+      z.free();
+      tmp.free();
+    }
+
+    double flops(const size_t size){
+      return (((expr == "hypot") ? 4 : 2) * size);
+    }
+
+    // Only the fused passes are counted
+    double bytes(const size_t size){
+      return (3 * sizeof(float) * size);
+    }
+  };
+  //==============================================
+
+  void addArrayExpressionBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new arrayExprBench("axpy"));
+    benchmarks.push_back(new arrayExprBench("axpy:unfused"));
+    benchmarks.push_back(new arrayExprBench("hypot"));
+  }
+}
@@ -0,0 +1,77 @@
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Histogram ]------------------------------
+  //  Compare thread counts with [--threads] to see the contention,
+  //    [weighted] sums floats through compare-and-swap loops
+  class histogram : public benchmark_t {
+  public:
+    static const int bins = 64;
+
+    bool weighted;
+
+    int entries;
+    occa::memory o_values, o_weights, o_counts;
+
+    histogram(const bool weighted_) :
+      benchmark_t(weighted_ ? "histogram:float" : "histogram:int"),
+      weighted(weighted_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      info.addDefine("p_bins", bins);
+
+      return device.buildKernelFromSource(kernelPath("kernels/histogram.okl"),
+                                          weighted ? "weightedHistogram" : "histogram",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      std::vector<int> values(entries);
+      std::vector<float> weights(entries, 0.5);
+      std::vector<int> counts(bins, 0);
+
+      for(int i = 0; i < entries; ++i)
+        values[i] = (int) ((i * 2654435761u) >> 8);
+
+      o_values  = device.malloc(entries*sizeof(int)  , &(values[0]));
+      o_weights = device.malloc(entries*sizeof(float), &(weights[0]));
+      o_counts  = device.malloc(bins*sizeof(int)    , &(counts[0]));
+    }
+
+    void run(occa::kernel &kernel){
+      if(weighted)
+        kernel(entries, o_values, o_weights, o_counts);
+      else
+        kernel(entries, o_values, o_counts);
+    }
+
+    void free(){
+      o_values.free();
+      o_weights.free();
+      o_counts.free();
+    }
+
+    double flops(const size_t size){
+      return size;
+    }
+
+    double bytes(const size_t size){
+      return ((weighted ? 2 : 1) * 4 * size);
+    }
+  };
+
+  const int histogram::bins;
+  //==============================================
+
+  void addAtomicBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new histogram(false));
+    benchmarks.push_back(new histogram(true));
+  }
+}
@@ -0,0 +1,307 @@
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+
+#include "benchmark.hpp"
+
+#if OCCA_OPENMP_ENABLED
+#  include <omp.h>
+#endif
+
+namespace bench {
+  //---[ Settings ]-------------------------------
+  deviceConfig_t::deviceConfig_t(const std::string &mode_,
+                                 const int threads_,
+                                 const bool precompiledHeaders_) :
+    mode(mode_),
+    threads(threads_),
+    precompiledHeaders(precompiledHeaders_) {}
+
+  std::string deviceConfig_t::deviceInfo() const {
+    std::stringstream ss;
+
+    ss << "mode = " << mode;
+
+    if(mode == "Pthreads")
+      ss << ", threadCount = " << threads << ", schedule = compact";
+
+    return ss.str();
+  }
+
+  std::string deviceConfig_t::name() const {
+    std::stringstream ss;
+
+    ss << mode << '(' << threads << (precompiledHeaders ? "" : ",nopch") << ')';
+
+    return ss.str();
+  }
+
+  settings_t::settings_t() :
+    warmups(2),
+    iterations(10),
+    keepCache(false),
+    verbose(false) {}
+
+  bool settings_t::runs(const std::string &benchmarkName) const {
+    return ((filter.size() == 0) ||
+            (benchmarkName.find(filter) != std::string::npos));
+  }
+  //==============================================
+
+
+  //---[ Result ]---------------------------------
+  result_t::result_t() :
+    size(0),
+    coldBuildTime(0),
+    warmBuildTime(0),
+    firstLaunchTime(0),
+    minTime(0),
+    avgTime(0),
+    maxTime(0),
+    flops(0),
+    bytes(0) {}
+
+  double result_t::gflops() const {
+    return ((0 < minTime) ? (flops / (1.0e9 * minTime)) : 0);
+  }
+
+  double result_t::gbs() const {
+    return ((0 < minTime) ? (bytes / (1.0e9 * minTime)) : 0);
+  }
+  //==============================================
+
+
+  //---[ Benchmark ]------------------------------
+  benchmark_t::benchmark_t(const std::string &name_) :
+    name(name_) {}
+
+  benchmark_t::~benchmark_t(){}
+
+  sizeVector_t benchmark_t::sizes(const settings_t &settings){
+    return settings.sizes;
+  }
+
+  void benchmark_t::prepare(occa::device &device,
+                            occa::kernelInfo info){}
+
+  double benchmark_t::flops(const size_t size){
+    return 0;
+  }
+
+  double benchmark_t::bytes(const size_t size){
+    return 0;
+  }
+
+  std::string kernelPath(const std::string &filename){
+    return (std::string(BENCHMARK_DIR) + filename);
+  }
+  //==============================================
+
+
+  //---[ Runner ]---------------------------------
+  void run(std::vector<benchmark_t*> &benchmarks,
+           const settings_t &settings,
+           std::vector<result_t> &results){
+
+    for(size_t b = 0; b < benchmarks.size(); ++b){
+      benchmark_t &benchmark = *(benchmarks[b]);
+
+      if(!settings.runs(benchmark.name))
+        continue;
+
+      const sizeVector_t sizes = benchmark.sizes(settings);
+
+      for(size_t d = 0; d < settings.devices.size(); ++d){
+        for(size_t s = 0; s < sizes.size(); ++s){
+          results.push_back(run(benchmark,
+                                settings.devices[d],
+                                sizes[s],
+                                settings));
+
+          printResults(std::cout, std::vector<result_t>(1, results.back()));
+        }
+      }
+    }
+  }
+
+  result_t run(benchmark_t &benchmark,
+               const deviceConfig_t &deviceConfig,
+               const size_t size,
+               const settings_t &settings){
+
+    static const long runID = (long) time(NULL);
+    static int buildCount   = 0;
+
+    result_t result;
+
+    result.benchmark = benchmark.name;
+    result.device    = deviceConfig;
+    result.size      = size;
+    result.flops     = benchmark.flops(size);
+    result.bytes     = benchmark.bytes(size);
+
+#if OCCA_OPENMP_ENABLED
+    if(deviceConfig.mode == "OpenMP")
+      omp_set_num_threads(deviceConfig.threads);
+#endif
+
+    occa::setUsePrecompiledHeaders(deviceConfig.precompiledHeaders);
+
+    occa::device device(deviceConfig.deviceInfo());
+
+    // Defines unique to this build skip kernels cached by
+    //   earlier runs and benchmarks
+    occa::kernelInfo info;
+    info.addDefine("OCCA_BENCHMARK_RUN"  , runID);
+    info.addDefine("OCCA_BENCHMARK_BUILD", buildCount++);
+
+    benchmark.prepare(device, info);
+
+    double start = occa::currentTime();
+    occa::kernel coldKernel = benchmark.build(device, size, info);
+    result.coldBuildTime = (occa::currentTime() - start);
+
+    start = occa::currentTime();
+    occa::kernel kernel = benchmark.build(device, size, info);
+    result.warmBuildTime = (occa::currentTime() - start);
+
+    coldKernel.free();
+
+    benchmark.setup(device, size);
+
+    for(int i = 0; i < settings.warmups; ++i){
+      start = occa::currentTime();
+
+      benchmark.run(kernel);
+      device.finish();
+
+      if(i == 0)
+        result.firstLaunchTime = (occa::currentTime() - start);
+    }
+
+    double totalTime = 0;
+
+    for(int i = 0; i < settings.iterations; ++i){
+      start = occa::currentTime();
+
+      benchmark.run(kernel);
+      device.finish();
+
+      const double elapsed = (occa::currentTime() - start);
+
+      if((i == 0) || (elapsed < result.minTime))
+        result.minTime = elapsed;
+      if((i == 0) || (result.maxTime < elapsed))
+        result.maxTime = elapsed;
+
+      totalTime += elapsed;
+    }
+
+    if(settings.iterations)
+      result.avgTime = (totalTime / settings.iterations);
+
+    benchmark.free();
+    kernel.free();
+    device.free();
+
+    return result;
+  }
+
+  void printResults(std::ostream &out,
+                    const std::vector<result_t> &results){
+
+    for(size_t i = 0; i < results.size(); ++i){
+      const result_t &r = results[i];
+
+      out << std::left
+          << std::setw(24) << r.benchmark
+          << std::setw(16) << r.device.name()
+          << std::right
+          << std::setw(10) << r.size
+          << "  cold: "   << std::setw(9) << std::setprecision(4) << r.coldBuildTime << " s"
+          << "  warm: "   << std::setw(9) << std::setprecision(4) << r.warmBuildTime << " s"
+          << "  min: "    << std::setw(9) << std::setprecision(4) << r.minTime       << " s"
+          << "  GFLOP/s: "<< std::setw(8) << std::setprecision(4) << r.gflops()
+          << "  GB/s: "   << std::setw(8) << std::setprecision(4) << r.gbs()
+          << '\n';
+    }
+  }
+
+  void writeJSON(const std::string &filename,
+                 const std::vector<result_t> &results){
+
+    std::ofstream fs(filename.c_str());
+
+    OCCA_CHECK(fs.is_open(),
+               "Could not write benchmark results to [" << filename << "]");
+
+    fs << std::setprecision(9)
+       << "{\n"
+       << "  \"results\": [\n";
+
+    for(size_t i = 0; i < results.size(); ++i){
+      const result_t &r = results[i];
+
+      fs << "    {\n"
+         << "      \"benchmark\": \""   << r.benchmark      << "\",\n"
+         << "      \"mode\": \""        << r.device.mode    << "\",\n"
+         << "      \"threads\": "       << r.device.threads << ",\n"
+         << "      \"precompiledHeaders\": " << (r.device.precompiledHeaders ? "true" : "false") << ",\n"
+         << "      \"size\": "          << r.size           << ",\n"
+         << "      \"coldBuildTime\": " << r.coldBuildTime  << ",\n"
+         << "      \"warmBuildTime\": " << r.warmBuildTime  << ",\n"
+         << "      \"firstLaunchTime\": " << r.firstLaunchTime << ",\n"
+         << "      \"minTime\": "       << r.minTime        << ",\n"
+         << "      \"avgTime\": "       << r.avgTime        << ",\n"
+         << "      \"maxTime\": "       << r.maxTime        << ",\n"
+         << "      \"flops\": "         << r.flops          << ",\n"
+         << "      \"bytes\": "         << r.bytes          << ",\n"
+         << "      \"gflops\": "        << r.gflops()       << ",\n"
+         << "      \"gbs\": "           << r.gbs()          << '\n'
+         << "    }" << (((i + 1) < results.size()) ? "," : "") << '\n';
+    }
+
+    fs << "  ]\n"
+       << "}\n";
+
+    fs.close();
+  }
+
+  void writeCSV(const std::string &filename,
+                const std::vector<result_t> &results){
+
+    std::ofstream fs(filename.c_str());
+
+    OCCA_CHECK(fs.is_open(),
+               "Could not write benchmark results to [" << filename << "]");
+
+    fs << std::setprecision(9)
+       << "benchmark,mode,threads,precompiledHeaders,size,"
+       << "coldBuildTime,warmBuildTime,firstLaunchTime,"
+       << "minTime,avgTime,maxTime,"
+       << "flops,bytes,gflops,gbs\n";
+
+    for(size_t i = 0; i < results.size(); ++i){
+      const result_t &r = results[i];
+
+      fs << r.benchmark       << ','
+         << r.device.mode     << ','
+         << r.device.threads  << ','
+         << r.device.precompiledHeaders << ','
+         << r.size            << ','
+         << r.coldBuildTime   << ','
+         << r.warmBuildTime   << ','
+         << r.firstLaunchTime << ','
+         << r.minTime         << ','
+         << r.avgTime         << ','
+         << r.maxTime         << ','
+         << r.flops           << ','
+         << r.bytes           << ','
+         << r.gflops()        << ','
+         << r.gbs()           << '\n';
+    }
+
+    fs.close();
+  }
+  //==============================================
+}
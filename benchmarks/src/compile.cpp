@@ -0,0 +1,113 @@
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Cold Compile ]---------------------------
+  //  Only the builds are measured, compare
+  //    [--pch on,off] to see the precompiled header savings
+  class coldCompile : public benchmark_t {
+  public:
+    std::string filename, functionName;
+    std::vector<std::string> defineNames, defineValues;
+
+    coldCompile(const std::string &kernelName,
+                const std::string &filename_,
+                const std::string &functionName_) :
+      benchmark_t("compile:" + kernelName),
+      filename(filename_),
+      functionName(functionName_) {}
+
+    void define(const std::string &name_,
+                const std::string &value){
+      defineNames.push_back(name_);
+      defineValues.push_back(value);
+    }
+
+    sizeVector_t sizes(const settings_t &settings){
+      return sizeVector_t(1, 1);
+    }
+
+    void prepare(occa::device &device,
+                 occa::kernelInfo info){
+
+      // Keep the one-time precompiled header build out of the timings
+      occa::kernel warmup = device.buildKernelFromString("kernel void compileWarmup(int *a){\n"
+                                                         "  for(int i = 0; i < 1; ++i; tile(1)){\n"
+                                                         "    a[i] = i;\n"
+                                                         "  }\n"
+                                                         "}\n",
+                                                         "compileWarmup",
+                                                         info,
+                                                         occa::usingOKL);
+      warmup.free();
+    }
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      for(size_t i = 0; i < defineNames.size(); ++i)
+        info.addDefine(defineNames[i], defineValues[i]);
+
+      return device.buildKernelFromSource(kernelPath(filename),
+                                          functionName,
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){}
+
+    void run(occa::kernel &kernel){}
+
+    void free(){}
+  };
+  //==============================================
+
+
+  void addCompileBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    coldCompile *addVectors = new coldCompile("addVectors",
+                                              "../examples/addVectors/cpp/addVectors.okl",
+                                              "addVectors");
+
+    coldCompile *reduction = new coldCompile("reduction",
+                                             "../examples/reduction/reduction.okl",
+                                             "reduction");
+    reduction->define("p_Nred", "256");
+
+    coldCompile *transpose = new coldCompile("transpose",
+                                             "../examples/usingArrays/smallTranspose.okl",
+                                             "smallTranspose");
+
+    coldCompile *fd2d = new coldCompile("fd2d",
+                                        "../examples/fd2d/fd2d.okl",
+                                        "fd2d");
+    fd2d->define("sr"    , "7");
+    fd2d->define("w"     , "256");
+    fd2d->define("h"     , "256");
+    fd2d->define("dx"    , "0.01");
+    fd2d->define("dt"    , "0.001");
+    fd2d->define("freq"  , "3");
+    fd2d->define("mX"    , "128");
+    fd2d->define("mY"    , "128");
+    fd2d->define("Bx"    , "16");
+    fd2d->define("By"    , "16");
+    fd2d->define("tFloat", "float");
+
+    coldCompile *mandelbulb = new coldCompile("mandelbulb",
+                                              "../examples/mandelbulb/rayMarcher.okl",
+                                              "rayMarcher");
+    mandelbulb->define("WIDTH"         , "256");
+    mandelbulb->define("HEIGHT"        , "256");
+    mandelbulb->define("BATCH_SIZE"    , "16");
+    mandelbulb->define("SHAPE_FUNCTION", "mandelbulb");
+    mandelbulb->define("PIXEL"         , "0.009765625");
+    mandelbulb->define("HALF_PIXEL"    , "0.0048828125");
+    mandelbulb->define("tFloat"        , "float");
+    mandelbulb->define("tFloat3"       , "float3");
+
+    benchmarks.push_back(addVectors);
+    benchmarks.push_back(reduction);
+    benchmarks.push_back(transpose);
+    benchmarks.push_back(fd2d);
+    benchmarks.push_back(mandelbulb);
+  }
+}
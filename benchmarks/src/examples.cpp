@@ -0,0 +1,502 @@
+#include <cmath>
+
+#include "benchmark.hpp"
+#include "occa/array.hpp"
+
+namespace bench {
+  static int squareSide(const size_t size, const int multiple){
+    int side = (int) std::sqrt((double) size);
+
+    side = ((side + multiple - 1) / multiple) * multiple;
+
+    return ((side < multiple) ? multiple : side);
+  }
+
+  //---[ Launch Overhead ]------------------------
+  class launchOverhead : public benchmark_t {
+  public:
+    occa::memory o_a;
+
+    launchOverhead() :
+      benchmark_t("launchOverhead") {}
+
+    sizeVector_t sizes(const settings_t &settings){
+      return sizeVector_t(1, 1);
+    }
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      return device.buildKernelFromString("kernel void launchOverhead(const int entries,\n"
+                                          "                           int *a){\n"
+                                          "  for(int i = 0; i < entries; ++i; tile(16)){\n"
+                                          "    if(i < entries)\n"
+                                          "      a[i] = i;\n"
+                                          "  }\n"
+                                          "}\n",
+                                          "launchOverhead",
+                                          info,
+                                          occa::usingOKL);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+      o_a = device.malloc(sizeof(int));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(1, o_a);
+    }
+
+    void free(){
+      o_a.free();
+    }
+
+    double bytes(const size_t size){
+      return sizeof(int);
+    }
+  };
+  //==============================================
+
+
+  //---[ addVectors ]-----------------------------
+  class addVectors : public benchmark_t {
+  public:
+    int entries;
+    occa::memory o_a, o_b, o_ab;
+
+    addVectors() :
+      benchmark_t("addVectors") {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      return device.buildKernelFromSource(kernelPath("../examples/addVectors/cpp/addVectors.okl"),
+                                          "addVectors",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      std::vector<float> a(entries, 1), b(entries, 2);
+
+      o_a  = device.malloc(entries*sizeof(float), &(a[0]));
+      o_b  = device.malloc(entries*sizeof(float), &(b[0]));
+      o_ab = device.malloc(entries*sizeof(float));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(entries, o_a, o_b, o_ab);
+    }
+
+    void free(){
+      o_a.free();
+      o_b.free();
+      o_ab.free();
+    }
+
+    double flops(const size_t size){
+      return size;
+    }
+
+    double bytes(const size_t size){
+      return (3 * sizeof(float) * size);
+    }
+  };
+  //==============================================
+
+
+  //---[ reduction ]------------------------------
+  class reduction : public benchmark_t {
+  public:
+    static const int p_Nred = 256;
+
+    int entries;
+    occa::memory o_a, o_aRed;
+
+    reduction(const std::string &name_ = "reduction") :
+      benchmark_t(name_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      info.addDefine("p_Nred", p_Nred);
+
+      return device.buildKernelFromSource(kernelPath("../examples/reduction/reduction.okl"),
+                                          "reduction",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      std::vector<float> a(entries, 1);
+
+      o_a    = device.malloc(entries*sizeof(float), &(a[0]));
+      o_aRed = device.malloc(groups(size)*sizeof(float));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(entries, o_a, o_aRed);
+    }
+
+    void free(){
+      o_a.free();
+      o_aRed.free();
+    }
+
+    static size_t groups(const size_t size){
+      return ((size + p_Nred - 1) / p_Nred);
+    }
+
+    double flops(const size_t size){
+      return size;
+    }
+
+    double bytes(const size_t size){
+      return (sizeof(float) * (size + groups(size)));
+    }
+  };
+
+  const int reduction::p_Nred;
+  //==============================================
+
+
+  //---[ reduction:specialized ]------------------
+  //  Same kernel with [entries] baked in through kernel::specialize()
+  class specializedReduction : public reduction {
+  public:
+    specializedReduction() :
+      reduction("reduction:specialized") {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      occa::kernel kernel = reduction::build(device, size, info);
+      occa::kernel specializedKernel = kernel.specialize("entries", (int) size);
+
+      kernel.free();
+
+      return specializedKernel;
+    }
+  };
+  //==============================================
+
+
+  //---[ fd2d ]-----------------------------------
+  //  Uses the example's setuprc values, the size sets
+  //    [width * height] with a square grid
+  class fd2d : public benchmark_t {
+  public:
+    static const int sr = 7;
+    static const int Bx = 16, By = 16;
+
+    int width, height;
+    occa::memory o_u1, o_u2, o_u3;
+
+    fd2d() :
+      benchmark_t("fd2d") {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      width = height = squareSide(size, Bx);
+
+      info.addDefine("sr"  , sr);
+      info.addDefine("w"   , width);
+      info.addDefine("h"   , height);
+      info.addDefine("dx"  , 0.01);
+      info.addDefine("dt"  , 0.001);
+      info.addDefine("freq", 3);
+      info.addDefine("mX"  , width/2);
+      info.addDefine("mY"  , height/2);
+      info.addDefine("Bx"  , Bx);
+      info.addDefine("By"  , By);
+      info.addDefine("tFloat", "float");
+
+      occa::kernel kernel = device.buildKernelFromSource(kernelPath("../examples/fd2d/fd2d.okl"),
+                                                         "fd2d",
+                                                         info);
+
+      return kernel;
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      width = height = squareSide(size, Bx);
+
+      std::vector<float> u(width*height, 0);
+
+      o_u1 = device.malloc(u.size()*sizeof(float), &(u[0]));
+      o_u2 = device.malloc(u.size()*sizeof(float), &(u[0]));
+      o_u3 = device.malloc(u.size()*sizeof(float), &(u[0]));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(o_u1, o_u2, o_u3, 0.5f);
+    }
+
+    void free(){
+      o_u1.free();
+      o_u2.free();
+      o_u3.free();
+    }
+
+    // Same model as the example's GFLOPS/BW output
+    double flops(const size_t size){
+      const double points = squareSide(size, Bx) * squareSide(size, Bx);
+      return points * ((2*sr + 1)*4 + 5);
+    }
+
+    double bytes(const size_t size){
+      const double points = squareSide(size, Bx) * squareSide(size, Bx);
+      return sizeof(float) * points * (2*(2*sr + 1) + 3);
+    }
+  };
+
+  const int fd2d::sr;
+  const int fd2d::Bx;
+  const int fd2d::By;
+  //==============================================
+
+
+  //---[ usingArrays (transpose) ]----------------
+  class transpose : public benchmark_t {
+  public:
+    int entries;
+    occa::array<int> a;
+    occa::array<int, occa::useIdxOrder> b;
+
+    transpose() :
+      benchmark_t("transpose") {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      return device.buildKernelFromSource(kernelPath("../examples/usingArrays/smallTranspose.okl"),
+                                          "smallTranspose",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = squareSide(size, 1);
+
+      a.allocate(device, entries, entries);
+      b.allocate(device, entries, entries);
+      b.setIdxOrder(0,1);
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(entries, a, b);
+    }
+
+    void free(){
+      a.free();
+      b.free();
+    }
+
+    // Both arrays swap their strictly lower and upper triangles
+    double bytes(const size_t size){
+      const double n = squareSide(size, 1);
+      return (2 * 4 * sizeof(int) * (n * (n - 1) / 2));
+    }
+  };
+  //==============================================
+
+
+  //---[ mandelbulb ]-----------------------------
+  //  Marching each pixel costs thousands of flops,
+  //    sizes are scaled down to keep run-times close
+  class mandelbulb : public benchmark_t {
+  public:
+    static const int batchSize = 16;
+
+    int width, height;
+    occa::array<char> rgba;
+
+    occa::float3 lightDirection;
+    occa::float3 viewDirectionY, viewDirectionX;
+    occa::float3 nearFieldLocation, eyeLocation;
+
+    mandelbulb() :
+      benchmark_t("mandelbulb") {}
+
+    sizeVector_t sizes(const settings_t &settings){
+      sizeVector_t sizes_ = settings.sizes;
+
+      for(size_t i = 0; i < sizes_.size(); ++i)
+        sizes_[i] = ((sizes_[i] < (64*256)) ? 256 : (sizes_[i] / 64));
+
+      return sizes_;
+    }
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      width = height = squareSide(size, batchSize);
+
+      const float pixel = 2.5 / (0.5*(width + height));
+
+      info.addDefine("WIDTH"         , width);
+      info.addDefine("HEIGHT"        , height);
+      info.addDefine("BATCH_SIZE"    , batchSize);
+      info.addDefine("SHAPE_FUNCTION", "mandelbulb");
+      info.addDefine("PIXEL"         , pixel);
+      info.addDefine("HALF_PIXEL"    , 0.5*pixel);
+      info.addDefine("tFloat"        , "float");
+      info.addDefine("tFloat3"       , "float3");
+
+      return device.buildKernelFromSource(kernelPath("../examples/mandelbulb/rayMarcher.okl"),
+                                          "rayMarcher",
+                                          info);
+    }
+
+    // Initial scene from the example's updateScene()
+    void setup(occa::device &device,
+               const size_t size){
+
+      width = height = squareSide(size, batchSize);
+
+      rgba.allocate(device, 4, width, height);
+
+      const float depthOfField = 2.5;
+      const float eyeDistance  = 2.2;
+      const float viewAngle    = (151.0 * M_PI / 180.0);
+      const float lightAngle   = (M_PI / 180.0);
+
+      const occa::float3 lightLocation(0.5 * depthOfField * cos(lightAngle),
+                                       0.5 * depthOfField,
+                                       0.5 * depthOfField * sin(lightAngle));
+
+      nearFieldLocation = occa::float3(0.5 * depthOfField * cos(viewAngle),
+                                       0,
+                                       0.5 * depthOfField * sin(viewAngle));
+
+      const occa::float3 viewDirection = -occa::normalize(nearFieldLocation);
+
+      const float inv = 1.0 / sqrt(viewDirection.x*viewDirection.x +
+                                   viewDirection.z*viewDirection.z);
+
+      lightDirection = occa::normalize(lightLocation);
+      viewDirectionX = occa::float3(-inv*viewDirection.z, viewDirection.y, inv*viewDirection.x);
+      viewDirectionY = occa::cross(viewDirectionX, viewDirection);
+      eyeLocation    = nearFieldLocation - (eyeDistance * viewDirection);
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(rgba,
+             lightDirection,
+             viewDirectionY, viewDirectionX,
+             nearFieldLocation, eyeLocation);
+    }
+
+    void free(){
+      rgba.free();
+    }
+
+    double bytes(const size_t size){
+      const double side = squareSide(size, batchSize);
+      return (3 * side * side);
+    }
+  };
+
+  const int mandelbulb::batchSize;
+  //==============================================
+
+
+  //---[ customReduction ]------------------------
+  //  Kernel generated by the example's customReduction class
+  //    for [a2 = a * a]
+  class customReduction : public benchmark_t {
+  public:
+    int entries;
+    occa::memory o_a, o_a2;
+
+    customReduction() :
+      benchmark_t("customReduction") {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      std::stringstream ss;
+
+      ss << "kernel void customReductionKernel(const int entries,\n"
+         << "                                  const float *custom_reduction_in ,\n"
+         << "                                        float *custom_reduction_out){\n"
+         << "  for(int group = 0; group < entries; group += 128; outer0){\n"
+         << "    for(int item = group; item < (group + 128); ++item; inner0){\n"
+         << "      const int n = item;\n"
+         << '\n'
+         << "      if(n < entries){\n"
+         << "        const float a = custom_reduction_in[item];\n"
+         << "              float a2;\n"
+         << "        a2 = a * a;\n"
+         << "        custom_reduction_out[item] = a2;\n"
+         << "      }\n"
+         << "    }\n"
+         << "  }\n"
+         << '}';
+
+      return device.buildKernelFromString(ss.str(),
+                                          "customReductionKernel",
+                                          info,
+                                          occa::usingOKL);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      std::vector<float> a(entries, 2);
+
+      o_a  = device.malloc(entries*sizeof(float), &(a[0]));
+      o_a2 = device.malloc(entries*sizeof(float));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(entries, o_a, o_a2);
+    }
+
+    void free(){
+      o_a.free();
+      o_a2.free();
+    }
+
+    double flops(const size_t size){
+      return size;
+    }
+
+    double bytes(const size_t size){
+      return (2 * sizeof(float) * size);
+    }
+  };
+  //==============================================
+
+  void addExampleBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new launchOverhead());
+    benchmarks.push_back(new addVectors());
+    benchmarks.push_back(new reduction());
+    benchmarks.push_back(new specializedReduction());
+    benchmarks.push_back(new fd2d());
+    benchmarks.push_back(new transpose());
+    benchmarks.push_back(new mandelbulb());
+    benchmarks.push_back(new customReduction());
+  }
+}
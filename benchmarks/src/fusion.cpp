@@ -0,0 +1,105 @@
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Kernel Fusion ]--------------------------
+  //  Runs [scale -> axpy -> multiply] as separate launches or through
+  //    an occa::kernelSequence, which merges the three loop nests.
+  //    Both report the bytes the separate launches move
+  class kernelChain : public benchmark_t {
+  public:
+    bool fused, built;
+
+    int entries;
+    occa::kernel axpy, multiply;
+    occa::memory o_x, o_y, o_xy;
+
+    occa::kernelSequence sequence;
+
+    kernelChain(const bool fused_) :
+      benchmark_t(fused_ ? "fusion:sequence" : "fusion:separate"),
+      fused(fused_),
+      built(false) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      const std::string filename = kernelPath("kernels/fusion.okl");
+
+      // The runner builds twice, keep the last build
+      if(built){
+        axpy.free();
+        multiply.free();
+      }
+
+      built = true;
+
+      axpy     = device.buildKernelFromSource(filename, "axpy"    , info);
+      multiply = device.buildKernelFromSource(filename, "multiply", info);
+
+      return device.buildKernelFromSource(filename, "scale", info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      std::vector<float> x(entries, 1);
+
+      o_x  = device.malloc(entries*sizeof(float), &(x[0]));
+      o_y  = device.malloc(entries*sizeof(float));
+      o_xy = device.malloc(entries*sizeof(float));
+    }
+
+    void run(occa::kernel &scale){
+      const float alpha = 2, beta = 3;
+
+      if(!fused){
+        scale(entries, alpha, o_x, o_y);
+        axpy(entries, beta, o_x, o_y);
+        multiply(entries, o_x, o_y, o_xy);
+        return;
+      }
+
+      // The fused kernel is built on the first run and reused after
+      sequence.clear();
+
+      sequence.add(scale)
+        .addArgument(entries).addArgument(alpha).addArgument(o_x).addArgument(o_y);
+      sequence.add(axpy)
+        .addArgument(entries).addArgument(beta).addArgument(o_x).addArgument(o_y);
+      sequence.add(multiply)
+        .addArgument(entries).addArgument(o_x).addArgument(o_y).addArgument(o_xy);
+
+      sequence.run();
+    }
+
+    void free(){
+      sequence.clear();
+      sequence.free();
+
+      axpy.free();
+      multiply.free();
+      built = false;
+
+      o_x.free();
+      o_y.free();
+      o_xy.free();
+    }
+
+    double flops(const size_t size){
+      return (4 * size);
+    }
+
+    double bytes(const size_t size){
+      return (8 * sizeof(float) * size);
+    }
+  };
+  //==============================================
+
+  void addFusionBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new kernelChain(false));
+    benchmarks.push_back(new kernelChain(true));
+  }
+}
@@ -0,0 +1,98 @@
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Half Precision ]-------------------------
+  //  The same float8 axpy on float8, half8 and bfloat16x8 storage,
+  //    16-bit entries halve the traffic of bandwidth-bound kernels
+  //
+  //  CPU modes convert half8 through F16C when the kernels are
+  //    built for it (OCCA_CXXFLAGS="-O3 -march=native"), [size]
+  //    should be a multiple of 8
+  class halfAxpy : public benchmark_t {
+  public:
+    std::string type, storageType;
+    size_t typeBytes;
+
+    int entries;
+    occa::memory o_x, o_y;
+
+    halfAxpy(const std::string &type_, const size_t typeBytes_) :
+      benchmark_t("halfPrecision:" + type_),
+      type(type_),
+      storageType((type_ == "bfloat16") ? "bfloat16x8" : (type_ + "8")),
+      typeBytes(typeBytes_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      info.addDefine("storage_t", storageType);
+
+      return device.buildKernelFromSource(kernelPath("kernels/halfPrecision.okl"),
+                                          "axpy",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      std::vector<float> x(entries), y(entries);
+
+      for(int i = 0; i < entries; ++i){
+        x[i] = 0.25f * (i % 8);
+        y[i] = 1.0f;
+      }
+
+      o_x = device.malloc(entries*typeBytes);
+      o_y = device.malloc(entries*typeBytes);
+
+      if(type == "float"){
+        o_x.copyFrom(&(x[0]));
+        o_y.copyFrom(&(y[0]));
+        return;
+      }
+
+      std::vector<unsigned short> bits(entries);
+
+      if(type == "half")
+        occa::floatToHalf(&(x[0]), (occa::half*) &(bits[0]), entries);
+      else
+        occa::floatToBfloat16(&(x[0]), (occa::bfloat16*) &(bits[0]), entries);
+
+      o_x.copyFrom(&(bits[0]));
+
+      if(type == "half")
+        occa::floatToHalf(&(y[0]), (occa::half*) &(bits[0]), entries);
+      else
+        occa::floatToBfloat16(&(y[0]), (occa::bfloat16*) &(bits[0]), entries);
+
+      o_y.copyFrom(&(bits[0]));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(entries / 8, 1.0e-3f, o_x, o_y);
+    }
+
+    void free(){
+      o_x.free();
+      o_y.free();
+    }
+
+    double flops(const size_t size){
+      return (2 * (double) size);
+    }
+
+    double bytes(const size_t size){
+      return (3 * typeBytes * (double) size);
+    }
+  };
+  //==============================================
+
+  void addHalfPrecisionBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new halfAxpy("float"   , sizeof(float)));
+    benchmarks.push_back(new halfAxpy("half"    , sizeof(occa::half)));
+    benchmarks.push_back(new halfAxpy("bfloat16", sizeof(occa::bfloat16)));
+  }
+}
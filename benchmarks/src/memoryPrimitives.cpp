@@ -0,0 +1,176 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Memory Primitives ]----------------------
+  //  Fills, strided copies, gathers and scatters next to the same
+  //    loops on the host, GB/s count every entry and index read and
+  //    written once
+  //
+  //  [copy2D] packs the interior of a square grid with [size]
+  //    entries, [scatterAdd] adds into 1024 bins
+  class memoryPrimitiveBench : public benchmark_t {
+  public:
+    std::string op;
+    bool onHost;
+
+    int entries, n;
+    occa::memory o_in, o_out, o_indices;
+    std::vector<float> in, out;
+    std::vector<int> indices;
+
+    memoryPrimitiveBench(const std::string &op_, const bool onHost_) :
+      benchmark_t(op_ + (onHost_ ? ":host" : ":occa")),
+      op(op_),
+      onHost(onHost_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      if(!onHost){
+        occa::memory o_tmp  = device.malloc(16*sizeof(float));
+        occa::memory o_tmp2 = device.malloc(16*sizeof(float));
+        occa::memory o_idx  = device.malloc(4*sizeof(int));
+
+        occa::fill<int>(o_idx, 0);
+
+        runOn(o_tmp, o_tmp2, o_idx, 4, 4);
+
+        device.finish();
+
+        o_tmp.free();
+        o_tmp2.free();
+        o_idx.free();
+      }
+
+      return device.buildKernelFromSource(kernelPath("kernels/stream.okl"),
+                                          "copy",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+      n       = (int) std::sqrt((double) size);
+
+      in.resize(entries);
+      out.resize(entries);
+      indices.resize(entries);
+
+      srand(entries);
+
+      for(int i = 0; i < entries; ++i){
+        in[i]      = (float) (i % 17);
+        indices[i] = ((op == "scatterAdd") ?
+                      (rand() % 1024)      :
+                      (int) ((i * 7919L) % entries));
+      }
+
+      if(onHost)
+        return;
+
+      o_in      = device.malloc(entries*sizeof(float), &(in[0]));
+      o_out     = device.malloc(entries*sizeof(float), &(in[0]));
+      o_indices = device.malloc(entries*sizeof(int)  , &(indices[0]));
+    }
+
+    void runOn(occa::memory in_,
+               occa::memory out_,
+               occa::memory indices_,
+               const int count,
+               const int n_){
+      if(op == "fill"){
+        occa::fill<float>(out_, 1.0f, count);
+      }
+      else if(op == "iota"){
+        occa::iota<float>(out_, 0.0f, 1.0f, count);
+      }
+      else if(op == "copy2D"){
+        occa::copy2D<float>(out_, in_,
+                            n_ - 2, n_ - 2,
+                            n_ - 2, n_,
+                            0, n_ + 1);
+      }
+      else if(op == "gather"){
+        occa::gather<float>(in_, indices_, out_, count);
+      }
+      else if(op == "scatter"){
+        occa::scatter<float>(in_, indices_, out_, count);
+      }
+      else {
+        occa::scatterAdd<float>(in_, indices_, out_, count);
+      }
+    }
+
+    void runOnHost(){
+      if(op == "fill"){
+        for(int i = 0; i < entries; ++i)
+          out[i] = 1.0f;
+      }
+      else if(op == "iota"){
+        for(int i = 0; i < entries; ++i)
+          out[i] = (float) i;
+      }
+      else if(op == "copy2D"){
+        for(int y = 0; y < (n - 2); ++y)
+          ::memcpy(&(out[y*(n - 2)]), &(in[(y + 1)*n + 1]), (n - 2)*sizeof(float));
+      }
+      else if(op == "gather"){
+        for(int i = 0; i < entries; ++i)
+          out[i] = in[indices[i]];
+      }
+      else if(op == "scatter"){
+        for(int i = 0; i < entries; ++i)
+          out[indices[i]] = in[i];
+      }
+      else {
+        for(int i = 0; i < entries; ++i)
+          out[indices[i]] += in[i];
+      }
+    }
+
+    void run(occa::kernel &copy){
+      if(onHost)
+        runOnHost();
+      else
+        runOn(o_in, o_out, o_indices, entries, n);
+    }
+
+    void free(){
+      if(onHost)
+        return;
+
+      o_in.free();
+      o_out.free();
+      o_indices.free();
+    }
+
+    double bytes(const size_t size){
+      if((op == "fill") || (op == "iota"))
+        return (sizeof(float) * size);
+
+      if(op == "copy2D"){
+        const double interior = std::sqrt((double) size) - 2;
+
+        return (2 * sizeof(float) * interior * interior);
+      }
+
+      return (((op == "scatterAdd") ? 4 : 3) * sizeof(float) * size);
+    }
+  };
+  //==============================================
+
+  void addMemoryPrimitiveBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    const char *ops[6] = {"fill", "iota", "copy2D", "gather", "scatter", "scatterAdd"};
+
+    for(int i = 0; i < 6; ++i){
+      benchmarks.push_back(new memoryPrimitiveBench(ops[i], false));
+      benchmarks.push_back(new memoryPrimitiveBench(ops[i], true));
+    }
+  }
+}
@@ -0,0 +1,71 @@
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ 2-D Outer Loops ]------------------------
+  //  A [2 x size/2] grid with outer1 over the 2 rows, OpenMP only
+  //    scales past two threads when outer1 and outer0 are collapsed.
+  //    [schedule] is passed as OCCA_OPENMP_SCHEDULE when set
+  class outer2d : public benchmark_t {
+  public:
+    static const int rows = 2;
+
+    std::string schedule;
+
+    int columns;
+    occa::memory o_x, o_px;
+
+    outer2d(const std::string &schedule_ = "") :
+      benchmark_t(schedule_.size()                         ?
+                  ("outer2d:" + schedule_.substr(0, schedule_.find(','))) :
+                  "outer2d"),
+      schedule(schedule_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      if(schedule.size())
+        info.addDefine("OCCA_OPENMP_SCHEDULE", schedule);
+
+      return device.buildKernelFromSource(kernelPath("kernels/outer2d.okl"),
+                                          "polynomial",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      columns = (int) ((size + rows - 1) / rows);
+
+      std::vector<float> x(rows*columns, 0.5);
+
+      o_x  = device.malloc(rows*columns*sizeof(float), &(x[0]));
+      o_px = device.malloc(rows*columns*sizeof(float));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(rows, columns, o_x, o_px);
+    }
+
+    void free(){
+      o_x.free();
+      o_px.free();
+    }
+
+    double flops(const size_t size){
+      return (2 * 16 * size);
+    }
+
+    double bytes(const size_t size){
+      return (2 * sizeof(float) * size);
+    }
+  };
+
+  const int outer2d::rows;
+  //==============================================
+
+  void addOuterLoopBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new outer2d());
+    benchmarks.push_back(new outer2d("dynamic,16"));
+  }
+}
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Primitives ]-----------------------------
+  //  Scans, compaction and radix sort next to their std:: counterparts
+  //    on the host, GB/s count every entry (and value) read and
+  //    written once
+  //
+  //  Sorts restore the unsorted keys before each run, the copy is
+  //    timed for both the device and std::sort
+  class primitiveBench : public benchmark_t {
+  public:
+    std::string op;
+    bool onHost;
+
+    int entries;
+    occa::memory o_in, o_out, o_keys, o_values;
+    std::vector<int> in, out;
+
+    primitiveBench(const std::string &op_, const bool onHost_) :
+      benchmark_t(op_ + (onHost_ ? ":std" : ":occa")),
+      op(op_),
+      onHost(onHost_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      if(!onHost){
+        occa::memory o_tmp = device.malloc(4*sizeof(int));
+        occa::memory o_tmp2 = device.malloc(4*sizeof(int));
+
+        runOn(o_tmp, o_tmp2, o_tmp, o_tmp2, 2);
+
+        o_tmp.free();
+        o_tmp2.free();
+      }
+
+      return device.buildKernelFromSource(kernelPath("kernels/stream.okl"),
+                                          "copy",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      in.resize(entries);
+      out.resize(entries);
+
+      srand(entries);
+
+      for(int i = 0; i < entries; ++i)
+        in[i] = ((op == "scan") ? (i % 17) : (rand() - (RAND_MAX / 2)));
+
+      if(onHost)
+        return;
+
+      o_in     = device.malloc(entries*sizeof(int), &(in[0]));
+      o_out    = device.malloc(entries*sizeof(int));
+      o_keys   = device.malloc(entries*sizeof(int));
+      o_values = device.malloc(entries*sizeof(int), &(in[0]));
+    }
+
+    void runOn(occa::memory in_,
+               occa::memory out_,
+               occa::memory keys,
+               occa::memory values,
+               const int count){
+      if(op == "scan"){
+        occa::exclusiveScan<int>(in_, out_, count);
+      }
+      else if(op == "copyIf"){
+        occa::copyIf<int>(in_, out_, "0 < x", count);
+      }
+      else {
+        keys.copyFrom(in_, count*sizeof(int));
+
+        if(op == "sort")
+          occa::radixSort<int>(keys, count);
+        else
+          occa::radixSort<int, int>(keys, values, count);
+      }
+    }
+
+    void runOnHost(){
+      if(op == "scan"){
+        std::partial_sum(in.begin(), in.end(), out.begin());
+      }
+      else if(op == "copyIf"){
+        int count = 0;
+
+        for(int i = 0; i < entries; ++i){
+          if(0 < in[i])
+            out[count++] = in[i];
+        }
+      }
+      else {
+        out = in;
+        std::sort(out.begin(), out.end());
+      }
+    }
+
+    void run(occa::kernel &copy){
+      if(onHost)
+        runOnHost();
+      else
+        runOn(o_in, o_out, o_keys, o_values, entries);
+    }
+
+    void free(){
+      if(onHost)
+        return;
+
+      o_in.free();
+      o_out.free();
+      o_keys.free();
+      o_values.free();
+    }
+
+    double bytes(const size_t size){
+      return (((op == "sortPairs") ? 4 : 2) * sizeof(int) * size);
+    }
+  };
+  //==============================================
+
+  void addPrimitiveBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new primitiveBench("scan"     , false));
+    benchmarks.push_back(new primitiveBench("scan"     , true));
+    benchmarks.push_back(new primitiveBench("copyIf"   , false));
+    benchmarks.push_back(new primitiveBench("copyIf"   , true));
+    benchmarks.push_back(new primitiveBench("sort"     , false));
+    benchmarks.push_back(new primitiveBench("sort"     , true));
+    benchmarks.push_back(new primitiveBench("sortPairs", false));
+  }
+}
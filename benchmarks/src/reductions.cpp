@@ -0,0 +1,99 @@
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Reductions ]-----------------------------
+  //  Built-in reductions next to a STREAM copy on the same device,
+  //    reductions only read their input and should get close to
+  //    the copy's GB/s for large sizes
+  //
+  //  Reduction kernels are cached by the library, the build times
+  //    are the first reduction (cold) and the cached lookup (warm)
+  class reductionBench : public benchmark_t {
+  public:
+    std::string op;
+
+    int entries;
+    occa::memory o_x, o_y;
+
+    reductionBench(const std::string &op_) :
+      benchmark_t(op_ == "copy" ? "stream:copy" : ("reduction:" + op_)),
+      op(op_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      if(op != "copy"){
+        occa::memory o_tmp = device.malloc(2*sizeof(float));
+
+        reduce(o_tmp, o_tmp, 2);
+
+        o_tmp.free();
+      }
+
+      return device.buildKernelFromSource(kernelPath("kernels/stream.okl"),
+                                          "copy",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) size;
+
+      std::vector<float> x(entries);
+
+      for(int i = 0; i < entries; ++i)
+        x[i] = (float) (i % 17);
+
+      o_x = device.malloc(entries*sizeof(float), &(x[0]));
+      o_y = device.malloc(entries*sizeof(float), &(x[0]));
+    }
+
+    float reduce(occa::memory x, occa::memory y, const int count){
+      if(op == "sum")
+        return occa::sum<float>(x, count);
+      if(op == "max")
+        return occa::max<float>(x, count);
+      if(op == "dot")
+        return occa::dot<float>(x, y, count);
+      if(op == "norm2")
+        return occa::norm2<float>(x, count);
+
+      return (float) occa::argmax<float>(x, count);
+    }
+
+    void run(occa::kernel &copy){
+      if(op == "copy")
+        copy(entries, o_x, o_y);
+      else
+        reduce(o_x, o_y, entries);
+    }
+
+    void free(){
+      o_x.free();
+      o_y.free();
+    }
+
+    double flops(const size_t size){
+      if(op == "copy")
+        return 0;
+
+      return (((op == "dot") || (op == "norm2")) ? (2 * size) : size);
+    }
+
+    double bytes(const size_t size){
+      return (((op == "copy") || (op == "dot") ? 2 : 1) * sizeof(float) * size);
+    }
+  };
+  //==============================================
+
+  void addReductionBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new reductionBench("copy"));
+    benchmarks.push_back(new reductionBench("sum"));
+    benchmarks.push_back(new reductionBench("max"));
+    benchmarks.push_back(new reductionBench("dot"));
+    benchmarks.push_back(new reductionBench("norm2"));
+    benchmarks.push_back(new reductionBench("argmax"));
+  }
+}
@@ -0,0 +1,103 @@
+#include <cmath>
+
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Texture Layouts ]------------------------
+  //  A 9-point stencil reading a square float texture with [size]
+  //    entries in 16x16 blocks, the texture is stored row-major,
+  //    in 8x8 row-major tiles or in 8x8 Z-order tiles
+  //
+  //  The layout is a device property, the benchmark builds and
+  //    runs on a device like the runner's with [textureLayout] set
+  class textureStencil : public benchmark_t {
+  public:
+    std::string layout;
+
+    occa::device layoutDevice;
+    bool hasLayoutDevice;
+
+    int n;
+    occa::memory o_tex, o_out;
+
+    textureStencil(const std::string &layout_) :
+      benchmark_t("textureLayout:" + layout_),
+      layout(layout_),
+      hasLayoutDevice(false) {}
+
+    void prepare(occa::device &device,
+                 occa::kernelInfo info){
+
+      std::stringstream deviceInfo;
+
+      deviceInfo << "mode = " << device.mode()
+                 << ", textureLayout = " << layout;
+
+      if(device.mode() == "Pthreads"){
+        deviceInfo << ", threadCount = " << device.getProperty<int>("threadCount")
+                   << ", schedule = compact";
+      }
+
+      if(hasLayoutDevice)
+        layoutDevice.free();
+
+      layoutDevice.setup(deviceInfo.str());
+      hasLayoutDevice = true;
+    }
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+      return layoutDevice.buildKernelFromSource(kernelPath("kernels/textureStencil.occa"),
+                                                "stencil",
+                                                info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      n = (int) std::sqrt((double) size);
+
+      std::vector<float> tex(n*n);
+
+      for(int i = 0; i < (n*n); ++i)
+        tex[i] = (float) (i % 17);
+
+      o_tex = layoutDevice.textureAlloc(2, occa::dim(n, n),
+                                        &(tex[0]),
+                                        occa::floatFormat);
+
+      o_out = layoutDevice.malloc(n*n*sizeof(float), &(tex[0]));
+    }
+
+    void run(occa::kernel &stencil){
+      const int blocks = ((n + 15) / 16);
+
+      stencil.setWorkingDims(2, occa::dim(16, 16), occa::dim(blocks, blocks));
+
+      stencil(n, o_tex, o_out);
+
+      layoutDevice.finish();
+    }
+
+    void free(){
+      o_tex.free();
+      o_out.free();
+    }
+
+    double flops(const size_t size){
+      return (9 * (double) size);
+    }
+
+    double bytes(const size_t size){
+      return (2 * sizeof(float) * (double) size);
+    }
+  };
+  //==============================================
+
+  void addTextureLayoutBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new textureStencil("rowMajor"));
+    benchmarks.push_back(new textureStencil("tiled"));
+    benchmarks.push_back(new textureStencil("morton"));
+  }
+}
@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include "benchmark.hpp"
+
+namespace bench {
+  //---[ Vector Types ]---------------------------
+  //  float4 math with CPU vector types on vector extensions or,
+  //    with [scalar], on their component-wise fallback
+  //
+  //  [size] counts float4 entries, each reading [neighbors] points
+  //    that stay in cache
+  class vectorMath : public benchmark_t {
+  public:
+    static const int neighbors = 512;
+
+    bool scalar;
+
+    int entries;
+    occa::memory o_points, o_sums;
+
+    vectorMath(const bool scalar_) :
+      benchmark_t(scalar_ ? "vectorTypes:scalar" : "vectorTypes:simd"),
+      scalar(scalar_) {}
+
+    occa::kernel build(occa::device &device,
+                       const size_t size,
+                       occa::kernelInfo info){
+
+      info.addDefine("p_neighbors", neighbors);
+
+      // The vector types are defined before the kernel header
+      if(scalar)
+        info.addCompilerFlag("-DOCCA_VECTOR_EXTENSIONS=0");
+
+      return device.buildKernelFromSource(kernelPath("kernels/vectorTypes.okl"),
+                                          "vectorMath",
+                                          info);
+    }
+
+    void setup(occa::device &device,
+               const size_t size){
+
+      entries = (int) std::max(size, (size_t) neighbors);
+
+      std::vector<float> points(4*entries);
+
+      for(int i = 0; i < (4*entries); ++i)
+        points[i] = 0.5f + (0.25f * (i % 3));
+
+      o_points = device.malloc(4*entries*sizeof(float), &(points[0]));
+      o_sums   = device.malloc(4*entries*sizeof(float));
+    }
+
+    void run(occa::kernel &kernel){
+      kernel(entries, o_points, o_sums);
+    }
+
+    void free(){
+      o_points.free();
+      o_sums.free();
+    }
+
+    double flops(const size_t size){
+      return (3 * 4 * neighbors * (double) size);
+    }
+
+    double bytes(const size_t size){
+      return (2 * 4 * sizeof(float) * (double) size);
+    }
+  };
+
+  const int vectorMath::neighbors;
+  //==============================================
+
+  void addVectorTypeBenchmarks(std::vector<benchmark_t*> &benchmarks){
+    benchmarks.push_back(new vectorMath(false));
+    benchmarks.push_back(new vectorMath(true));
+  }
+}
@@ -50,6 +50,20 @@ int main(int argc, char **argv){
   std::cout << "After:\n";
   printMatrix(a);
 
+  //---[ Testing Views ]----------------
+  std::cout << "Testing Views:\n";
+
+  // Views share a's entries, nothing is copied
+  occa::array<int> corner = a.slice(0, 1, 2).slice(1, 1, 2);
+
+  corner(0,0) = -1;
+
+  std::cout << "Corner:\n";
+  printMatrix(corner);
+
+  std::cout << "After writing to the corner:\n";
+  printMatrix(a);
+
   return 0;
 }
 
@@ -9,6 +9,11 @@
 #include "occa/base.hpp"
 #include "occa/library.hpp"
 #include "occa/timer.hpp"
+#include "occa/capture.hpp"
+#include "occa/aot.hpp"
+#include "occa/compileServer.hpp"
+#include "occa/autotune.hpp"
+#include "occa/fusion.hpp"
 
 #include "occa/Serial.hpp"
 #include "occa/OpenCL.hpp"
@@ -18,5 +23,6 @@
 #include "occa/defines/vector.hpp"
 
 #include "occa/miniLib.hpp"
+#include "occa/reduction.hpp"
 
 #endif
@@ -31,6 +31,7 @@ namespace occa {
     int vendor;
     bool supportsOpenMP;
     std::string OpenMPFlag;
+    stringVector_t isaLevels;
   };
   //==================================
 
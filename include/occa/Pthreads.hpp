@@ -29,6 +29,7 @@ namespace occa {
   // [-] Hard-coded for now
   struct PthreadsDeviceData_t {
     int vendor;
+    stringVector_t isaLevels;
 
     int coreCount;
 
@@ -81,6 +82,10 @@ namespace occa {
 
     int argc;
     void **args;
+
+    // Launches are queued, values are copied since the kernel's
+    //   arguments can change before the job runs
+    kernelArgData_t *argValues;
   };
 
   static const int compact = (1 << 10);
@@ -36,6 +36,7 @@ namespace occa {
 
   struct SerialDeviceData_t {
     int vendor;
+    stringVector_t isaLevels;
   };
   //==================================
 
@@ -98,6 +99,83 @@ namespace occa {
     std::string getCPUINFOField(const std::string &field,
 				bool ignoreCase = false);
 
+    ///
+    /// CPU topology and capabilities, read once per process
+    /// from /proc and /sys on Linux without running any tools.
+    ///
+    class topology_t {
+    public:
+      std::string processorName, vendor;
+      int frequency; // MHz
+
+      int logicalCores, physicalCores, threadsPerCore;
+      int sockets, numaNodes;
+
+      // Socket of each logical core, indexed by core id
+      std::vector<int> coreSockets;
+
+      // Bytes for [level] 1, 2 and 3, level 1 is the data cache
+      uintptr_t cacheSizes[4];
+      int cacheLineSize;
+
+      // Lower-case flags from /proc/cpuinfo (sse4_2, avx2, avx512f, asimd, ...)
+      stringVector_t isaFlags;
+
+      topology_t();
+
+      bool hasISAFlag(const std::string &flag) const;
+
+      // Widest vector set the CPU supports: AVX-512, AVX2, AVX, SSE4.2, SSE2, NEON or ""
+      std::string vectorSet() const;
+
+      // Logical cores ordered to spread threads across sockets
+      std::vector<int> scatterOrder() const;
+    };
+
+    const topology_t& getTopology();
+
+    // Sets topology properties ([physicalCores], [L2CacheSize], ...)
+    //   that weren't given in the device info
+    void addTopologyTo(argInfoMap &properties);
+
+    //---[ ISA Variants ]-------------
+    //  Devices created with [isa = [x86-64-v2, x86-64-v3, x86-64-v4]]
+    //    compile every kernel for each level into the cache and load
+    //    the highest level this CPU runs, [isa = auto] only compiles
+    //    for the host's level
+    //
+    //  The level is part of the kernel hash, nodes sharing a cache
+    //    each load the variant their CPU supports
+
+    // 2, 3 or 4 for x86-64-v2, x86-64-v3 or x86-64-v4, 0 otherwise
+    int isaLevel(const std::string &isa);
+
+    bool hostSupportsISA(const std::string &isa);
+
+    // Highest x86-64 level this CPU runs, "" if it isn't x86-64
+    std::string hostISA();
+
+    // ISA targeted by [-march] flags, [native] flags resolve to the host
+    std::string targetISA(const std::string &flags);
+
+    // Levels from the [isa] device property
+    stringVector_t isaLevelsFrom(const std::string &isaInfo);
+
+    ///
+    /// Compiles the [isaLevels] variants other than the one loaded
+    /// here into the cache and adds the [-march] flag of the highest
+    /// level this CPU runs to [info].
+    ///
+    /// [extraFlags] are backend flags added at compile time (-fopenmp).
+    ///
+    void buildISAVariants(device_v *dHandle,
+                          const std::string &filename,
+                          const std::string &functionName,
+                          kernelInfo &info,
+                          const stringVector_t &isaLevels,
+                          const std::string &extraFlags = "");
+    //================================
+
     std::string getProcessorName();
     int getCoreCount();
     int getProcessorFrequency();
@@ -115,12 +193,66 @@ namespace occa {
     void addSharedBinaryFlagsTo(const std::string &compiler, std::string &flags);
     void addSharedBinaryFlagsTo(const int vendor_, std::string &flags);
 
+    ///
+    /// Header that includes the OCCA defines used by [info.mode],
+    /// precompiled once for each compiler and [flags] in the cache.
+    ///
+    /// Compiling with [-include <header>] picks up the precompiled
+    /// header, "" is returned if the compiler does not support it.
+    ///
+    std::string precompiledHeaderFor(const std::string &compilerEnvScript,
+                                     const std::string &compiler,
+                                     const std::string &flags,
+                                     const kernelInfo &info);
+
+    ///
+    /// Compiles [source] through the compiler's stdin into a memfd
+    /// and loads it without touching the cache directory.
+    ///
+    /// [dlHandle] is set and true is returned on success, false is
+    /// returned if in-memory compilation is not available and the
+    /// caller should compile through the cache instead.
+    /// The binary is also saved in [binaryFilename] if it is given.
+    ///
+    bool compileInMemory(const std::string &compiler,
+                         const std::string &flags,
+                         const std::string &source,
+                         const std::string &binaryFilename,
+                         const std::string &hash,
+                         void *&dlHandle);
+
     void* malloc(uintptr_t bytes);
     void free(void *ptr);
 
+    //---[ Texture Layouts ]----------
+    //  CPU devices created with [textureLayout = tiled] or
+    //    [textureLayout = morton] store their 2D textures in 8x8
+    //    tiles (see occa::textureLayout), fetches inside a tile stay
+    //    in a few cache lines for both x and y neighbors
+
+    // rowMajor unless the [textureLayout] property is [tiled] or [morton]
+    int textureLayoutFrom(argInfoMap &properties);
+
+    // Bytes stored for [info], tiled layouts pad to whole tiles
+    uintptr_t textureBytes(const textureInfo_t &info);
+
+    ///
+    /// Copies [bytes] from [src] + [srcOffset] to [dest] + [destOffset].
+    ///
+    /// [destTexture] and [srcTexture] are NULL for buffers, textures
+    /// with a tiled or morton layout are read and written as row-major
+    /// entries, offsets and [bytes] are in row-major bytes.
+    ///
+    void textureMemcpy(void *dest, const textureInfo_t *destTexture, const uintptr_t destOffset,
+                       const void *src, const textureInfo_t *srcTexture, const uintptr_t srcOffset,
+                       const uintptr_t bytes);
+    //================================
+
     void* dlopen(const std::string &filename,
                  const std::string &hash = "");
 
+    void dlclose(void *dlHandle);
+
     handleFunction_t dlsym(void *dlHandle,
                            const std::string &functionName,
                            const std::string &hash = "");
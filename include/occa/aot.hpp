@@ -0,0 +1,105 @@
+#ifndef OCCA_AOT_HEADER
+#define OCCA_AOT_HEADER
+
+#include "occa/tools.hpp"
+#include "occa/base.hpp"
+
+namespace occa {
+  //---[ Ahead-of-Time Bundles ]------------------
+  //  [occa aot <manifest>] builds every kernel listed in the manifest
+  //    into one shared object with an index:
+  //
+  //      $OCCA_CACHE_DIR/aot/<name>/bundle.so
+  //      $OCCA_CACHE_DIR/aot/<name>/index
+  //
+  //  Bundles in $OCCA_CACHE_DIR/aot/ are loaded on the first build,
+  //    kernels found in an index are loaded from the bundle without
+  //    parsing or compiling
+  namespace aot {
+    // Sources compiled by the CPU backends while recording
+    class unit_t {
+    public:
+      std::string hash, functionName;
+      std::string source;
+      std::string compilerEnvScript, compiler, flags;
+
+      unit_t();
+
+      std::string symbol() const;
+    };
+
+    class kernelEntry_t {
+    public:
+      std::string hash, functionName;
+      std::string bundle;
+
+      bool usesParser;
+      parsedKernelInfo metaInfo;
+
+      // Launcher (or kernel) symbol followed by nested kernel symbols
+      stringVector_t symbols;
+
+      kernelEntry_t();
+    };
+
+    extern bool recording_f;
+
+    extern std::vector<unit_t> units;
+    extern std::vector<kernelEntry_t> recordedKernels;
+
+    void recordUnit(const std::string &hash,
+                    const std::string &functionName,
+                    const std::string &source,
+                    const std::string &compilerEnvScript,
+                    const std::string &compiler,
+                    const std::string &flags);
+
+    void recordKernel(const std::string &hash,
+                      const std::string &functionName,
+                      const bool usesParser,
+                      const parsedKernelInfo &metaInfo,
+                      const size_t firstUnit);
+
+    //---[ Runtime ]----------------------
+    bool hasBundles();
+
+    void load(const std::string &bundleDir);
+
+    const kernelEntry_t* find(const std::string &hash,
+                              const std::string &functionName);
+    //====================================
+
+    //---[ Bundling ]---------------------
+    //  Manifest entries are blocks of [key: value] lines:
+    //
+    //    kernel:
+    //      file:     addVectors.okl
+    //      function: addVectors
+    //      mode:     mode = OpenMP, schedule = compact, chunk = 10
+    //      define:   TILE_SIZE = 16
+    //      include:  common.hpp
+    //      flags:    -O3
+    //
+    //  [file] and [include] are relative to the manifest
+    class manifestEntry_t {
+    public:
+      std::string filename, functionName;
+      std::string deviceInfo;
+      kernelInfo info;
+
+      manifestEntry_t();
+    };
+
+    std::vector<manifestEntry_t> readManifest(const std::string &manifestFile);
+
+    void build(const std::string &manifestFile,
+               const std::string &bundleDir);
+
+    void writeIndex(const std::string &indexFile,
+                    const std::vector<kernelEntry_t> &kernels);
+    //====================================
+  }
+  //==============================================
+}
+
+#endif
@@ -2,6 +2,8 @@
 #define OCCA_ARRAY_HEADER
 
 #include "occa/base.hpp"
+#include "occa/reduction.hpp"
+#include "occa/array/expression.hpp"
 
 namespace occa {
   typedef uintptr_t dim_t;
@@ -24,6 +26,12 @@ namespace occa {
     int ks_[6];     // Passed to the kernel, not a problem for 32-bit
     dim_t s_[6];    // Strides
 
+    // Views share the allocation of the array they were taken from,
+    //   they start [offset_] entries into [memory] and keep its
+    //   sizes in [ks_] as pitches
+    dim_t offset_;
+    bool isView_;
+
     int idxCount;
     dim_t fs_[7];   // Full Strides (used with idxOrder)
     int sOrder_[6]; // Stride Ordering
@@ -57,6 +65,15 @@ namespace occa {
       return s_[i];
     }
 
+    inline bool isView() const {
+      return isView_;
+    }
+
+    bool isContiguous() const;
+
+    // Only CPU modes can offset the pointer of a view
+    void* kernelPointer();
+
     inline operator occa::kernelArg () {
       occa::kernelArg ret;
 
@@ -65,7 +82,7 @@ namespace occa {
       ret.args[0].mHandle = memory.getMHandle();
       ret.args[0].dHandle = memory.getDHandle();
 
-      ret.args[0].data.void_ = memory.getMemoryHandle();
+      ret.args[0].data.void_ = kernelPointer();
       ret.args[0].size       = sizeof(void*);
       ret.args[0].info       = kArgInfo::usePointer;
 
@@ -177,6 +194,35 @@ namespace occa {
     void reshape(const dim_t d0, const dim_t d1, const dim_t d2,
                  const dim_t d3, const dim_t d4, const dim_t d5);
 
+    //---[ Views ]----------------------
+    //  Views don't allocate or copy, kernels taking them as
+    //    @arrayArg arguments work on the sub-block in place
+    //
+    //      // Interior of a 2D array
+    //      occa::array<float> interior = a.slice(0, 1, nx - 2).slice(1, 1, ny - 2);
+    //
+    //  Views need a unit stride in the first dimension like the
+    //    @arrayArg indexing, reshaped() views need contiguous entries
+    array<TM,idxType> slice(const int dim_,
+                            const dim_t start,
+                            const dim_t count);
+
+    array<TM,idxType> view(const int dim,
+                           const dim_t *offsets,
+                           const dim_t *d);
+
+    array<TM,idxType> reshaped(const int dim, const dim_t *d);
+
+    array<TM,idxType> reshaped(const dim_t d0);
+    array<TM,idxType> reshaped(const dim_t d0, const dim_t d1);
+    array<TM,idxType> reshaped(const dim_t d0, const dim_t d1, const dim_t d2);
+    array<TM,idxType> reshaped(const dim_t d0, const dim_t d1, const dim_t d2,
+                               const dim_t d3);
+    array<TM,idxType> reshaped(const dim_t d0, const dim_t d1, const dim_t d2,
+                               const dim_t d3, const dim_t d4);
+    array<TM,idxType> reshaped(const dim_t d0, const dim_t d1, const dim_t d2,
+                               const dim_t d3, const dim_t d4, const dim_t d5);
+
     //---[ setIdxOrder(...) ]-----------
     void updateFS(const int idxCount_ = 1);
 
@@ -207,6 +253,53 @@ namespace occa {
     inline TM& operator () (const dim_t i0, const dim_t i1, const dim_t i2,
                             const dim_t i3, const dim_t i4, const dim_t i5);
 
+    //---[ Reductions ]-----------------
+    // Reductions run on whole arrays or contiguous views at their start
+    occa::memory reductionMemory();
+
+    TM sum();
+    TM min();
+    TM max();
+    TM norm2();
+
+    dim_t argmin();
+    dim_t argmax();
+
+    template <const int idxType2>
+    TM dot(array<TM,idxType2> &v);
+
+    TM reduce(const reductionOp &op, const TM &identity);
+
+    //---[ Expressions ]----------------
+    OCCA_ARRAY_EXPR_OPERATIONS(OCCA_ARRAY_BINARY_FRIENDS,
+                               OCCA_ARRAY_UNARY_FRIENDS)
+
+    template <class E>
+    array& operator = (const arrayExpr<E> &e);
+
+    template <class E>
+    array& operator += (const arrayExpr<E> &e);
+    template <class E>
+    array& operator -= (const arrayExpr<E> &e);
+    template <class E>
+    array& operator *= (const arrayExpr<E> &e);
+    template <class E>
+    array& operator /= (const arrayExpr<E> &e);
+
+    template <const int idxType2>
+    array& operator += (const array<TM,idxType2> &v);
+    template <const int idxType2>
+    array& operator -= (const array<TM,idxType2> &v);
+    template <const int idxType2>
+    array& operator *= (const array<TM,idxType2> &v);
+    template <const int idxType2>
+    array& operator /= (const array<TM,idxType2> &v);
+
+    array& operator += (const TM &value);
+    array& operator -= (const TM &value);
+    array& operator *= (const TM &value);
+    array& operator /= (const TM &value);
+
     //---[ Syncs ]----------------------
     void startManaging();
     void stopManaging();
@@ -220,6 +313,12 @@ namespace occa {
   };
 }
 
+#undef OCCA_ARRAY_EXPR_OPERATIONS
+#undef OCCA_ARRAY_EXPR_BINARY_FRIENDS
+#undef OCCA_ARRAY_EXPR_UNARY_FRIENDS
+#undef OCCA_ARRAY_BINARY_FRIENDS
+#undef OCCA_ARRAY_UNARY_FRIENDS
+
 #include "occa/array/array.tpp"
 
 #endif
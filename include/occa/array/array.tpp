@@ -1,7 +1,9 @@
 namespace occa {
   template <class TM, const int idxType>
   array<TM,idxType>::array() :
-    data_(NULL) {
+    data_(NULL),
+    offset_(0),
+    isView_(false) {
 
     initSOrder();
   }
@@ -21,6 +23,9 @@ namespace occa {
 
     data_ = v.data_;
 
+    offset_ = v.offset_;
+    isView_ = v.isView_;
+
     initSOrder(v.idxCount);
 
     for(int i = 0; i < idxCount; ++i){
@@ -31,6 +36,8 @@ namespace occa {
 
     if(idxType == occa::useIdxOrder)
       updateFS(v.idxCount);
+
+    return *this;
   }
 
   template <class TM, const int idxType>
@@ -48,10 +55,15 @@ namespace occa {
     if(data_ == NULL)
       return;
 
-    occa::free(data_);
+    // Views leave the allocation to the array they came from
+    if(!isView_)
+      occa::free(data_);
 
     data_ = NULL;
 
+    offset_ = 0;
+    isView_ = false;
+
     for(int i = 0; i < 6; ++i){
       ks_[i]     = 0;
       s_[i]      = 0;
@@ -60,6 +72,33 @@ namespace occa {
   }
 
   //---[ Info ]-------------------------
+  template <class TM, const int idxType>
+  bool array<TM,idxType>::isContiguous() const {
+    // Only the last dimension larger than 1 can be cut short
+    int last = 5;
+
+    while((0 < last) && (s_[last] == 1))
+      --last;
+
+    for(int i = 0; i < last; ++i){
+      if(s_[i] != (dim_t) ks_[i])
+        return false;
+    }
+
+    return true;
+  }
+
+  template <class TM, const int idxType>
+  void* array<TM,idxType>::kernelPointer(){
+    if(offset_ == 0)
+      return memory.getMemoryHandle();
+
+    OCCA_CHECK(reduction::usesCPULayout(device),
+               "Views starting inside their array can only be passed to kernels in the Serial, OpenMP and Pthreads modes");
+
+    return (((char*) memory.getMemoryHandle()) + (offset_ * sizeof(TM)));
+  }
+
   template <class TM, const int idxType>
   std::string array<TM,idxType>::idxOrderStr(){
     if(idxType == occa::useIdxOrder){
@@ -113,9 +152,35 @@ namespace occa {
 
     clone_.allocate(device_, idxCount, s_);
 
-    occa::memcpy(clone_.data_,
-                 data_,
-                 bytes());
+    if(isContiguous()){
+      occa::memcpy(clone_.data_,
+                   data_,
+                   bytes());
+
+      return clone_;
+    }
+
+    // Views with pitches are copied one unit-stride row at a time
+    const dim_t rows = (entries() / s_[0]);
+    dim_t idx[6] = {0, 0, 0, 0, 0, 0};
+
+    for(dim_t row = 0; row < rows; ++row){
+      dim_t offset = 0;
+
+      for(int i = 5; 0 < i; --i)
+        offset = (idx[i] + ks_[i]*offset);
+
+      occa::memcpy(clone_.data_ + (row * s_[0]),
+                   data_ + (offset * ks_[0]),
+                   s_[0] * sizeof(TM));
+
+      for(int i = 1; i < 6; ++i){
+        if(++idx[i] < s_[i])
+          break;
+
+        idx[i] = 0;
+      }
+    }
 
     return clone_;
   }
@@ -274,6 +339,9 @@ namespace occa {
     data_ = (TM*) device.managedAlloc(bytes());
 
     memory = occa::memory(data_);
+
+    offset_ = 0;
+    isView_ = false;
   }
 
   template <class TM, const int idxType>
@@ -512,6 +580,118 @@ namespace occa {
     updateFS(6);
   }
 
+  //---[ Views ]------------------------
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::slice(const int dim_,
+                                             const dim_t start,
+                                             const dim_t count){
+
+    OCCA_CHECK(idxType == occa::dontUseIdxOrder,
+               "Only occa::array<TM, occa::dontUseIdxOrder> can take views");
+
+    OCCA_CHECK((0 <= dim_) && (dim_ < 6),
+               "occa::array::slice() dimension must be [0-5], not [" << dim_ << ']');
+
+    OCCA_CHECK((start <= s_[dim_]) && (count <= (s_[dim_] - start)),
+               "Slice [" << start << ", " << (start + count) << ") is out of bounds in dimension ["
+               << dim_ << "] with [" << s_[dim_] << "] entries");
+
+    array<TM,idxType> view_ = *this;
+
+    dim_t pitch = 1;
+
+    for(int i = 0; i < dim_; ++i)
+      pitch *= ks_[i];
+
+    view_.data_   += (start * pitch);
+    view_.offset_ += (start * pitch);
+
+    view_.s_[dim_] = count;
+    view_.isView_  = true;
+
+    return view_;
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::view(const int dim,
+                                            const dim_t *offsets,
+                                            const dim_t *d){
+
+    OCCA_CHECK((0 < dim) && (dim <= 6),
+               "Number of dimensions must be [1-6]");
+
+    array<TM,idxType> view_ = *this;
+
+    for(int i = 0; i < dim; ++i)
+      view_ = view_.slice(i, offsets[i], d[i]);
+
+    return view_;
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::reshaped(const int dim, const dim_t *d){
+    OCCA_CHECK(idxType == occa::dontUseIdxOrder,
+               "Only occa::array<TM, occa::dontUseIdxOrder> can take views");
+
+    OCCA_CHECK(isContiguous(),
+               "occa::array::reshaped() needs contiguous entries, clone() the view first");
+
+    dim_t entries_ = 1;
+
+    for(int i = 0; i < dim; ++i)
+      entries_ *= d[i];
+
+    OCCA_CHECK(entries_ == entries(),
+               "occa::array::reshaped() can't change the number of entries from ["
+               << entries() << "] to [" << entries_ << ']');
+
+    array<TM,idxType> view_ = *this;
+
+    view_.reshape(dim, d);
+    view_.isView_ = true;
+
+    return view_;
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::reshaped(const dim_t d0){
+    const dim_t d[1] = {d0};
+    return reshaped(1, d);
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::reshaped(const dim_t d0, const dim_t d1){
+    const dim_t d[2] = {d0, d1};
+    return reshaped(2, d);
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::reshaped(const dim_t d0, const dim_t d1, const dim_t d2){
+    const dim_t d[3] = {d0, d1, d2};
+    return reshaped(3, d);
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::reshaped(const dim_t d0, const dim_t d1, const dim_t d2,
+                                                const dim_t d3){
+    const dim_t d[4] = {d0, d1, d2, d3};
+    return reshaped(4, d);
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::reshaped(const dim_t d0, const dim_t d1, const dim_t d2,
+                                                const dim_t d3, const dim_t d4){
+    const dim_t d[5] = {d0, d1, d2, d3, d4};
+    return reshaped(5, d);
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType> array<TM,idxType>::reshaped(const dim_t d0, const dim_t d1, const dim_t d2,
+                                                const dim_t d3, const dim_t d4, const dim_t d5){
+    const dim_t d[6] = {d0, d1, d2, d3, d4, d5};
+    return reshaped(6, d);
+  }
+
   //---[ setIdxOrder(...) ]-------------
   template <class TM, const int idxType>
   void array<TM,idxType>::updateFS(const int idxCount_){
@@ -740,7 +920,7 @@ namespace occa {
   template <class TM, const int idxType>
   inline TM& array<TM,idxType>::operator () (const dim_t i0, const dim_t i1){
     if(idxType == occa::dontUseIdxOrder)
-      return data_[i0 + s_[0]*i1];
+      return data_[i0 + ks_[0]*i1];
     else
       return data_[fs_[0]*i0 + fs_[1]*i1];
   }
@@ -748,7 +928,7 @@ namespace occa {
   template <class TM, const int idxType>
   inline TM& array<TM,idxType>::operator () (const dim_t i0, const dim_t i1, const dim_t i2){
     if(idxType == occa::dontUseIdxOrder)
-      return data_[i0 + s_[0]*(i1 + s_[1]*i2)];
+      return data_[i0 + ks_[0]*(i1 + ks_[1]*i2)];
     else
       return data_[fs_[0]*i0 + fs_[1]*i1 + fs_[2]*i2];
   }
@@ -757,7 +937,7 @@ namespace occa {
   inline TM& array<TM,idxType>::operator () (const dim_t i0, const dim_t i1, const dim_t i2,
                                              const dim_t i3){
     if(idxType == occa::dontUseIdxOrder)
-      return data_[i0 + s_[0]*(i1 + s_[1]*(i2 + s_[2]*i3))];
+      return data_[i0 + ks_[0]*(i1 + ks_[1]*(i2 + ks_[2]*i3))];
     else
       return data_[fs_[0]*i0 + fs_[1]*i1 + fs_[2]*i2 + fs_[3]*i3];
   }
@@ -766,7 +946,7 @@ namespace occa {
   inline TM& array<TM,idxType>::operator () (const dim_t i0, const dim_t i1, const dim_t i2,
                                              const dim_t i3, const dim_t i4){
     if(idxType == occa::dontUseIdxOrder)
-      return data_[i0 + s_[0]*(i1 + s_[1]*(i2 + s_[2]*(i3 + s_[3]*i4)))];
+      return data_[i0 + ks_[0]*(i1 + ks_[1]*(i2 + ks_[2]*(i3 + ks_[3]*i4)))];
     else
       return data_[fs_[0]*i0 + fs_[1]*i1 + fs_[2]*i2 + fs_[3]*i3 + fs_[4]*i4];
   }
@@ -775,11 +955,152 @@ namespace occa {
   inline TM& array<TM,idxType>::operator () (const dim_t i0, const dim_t i1, const dim_t i2,
                                              const dim_t i3, const dim_t i4, const dim_t i5){
     if(idxType == occa::dontUseIdxOrder)
-      return data_[i0 + s_[0]*(i1 + s_[1]*(i2 + s_[2]*(i3 + s_[3]*(i4 + s_[4]*i5))))];
+      return data_[i0 + ks_[0]*(i1 + ks_[1]*(i2 + ks_[2]*(i3 + ks_[3]*(i4 + ks_[4]*i5))))];
     else
       return data_[fs_[0]*i0 + fs_[1]*i1 + fs_[2]*i2 + fs_[3]*i3 + fs_[4]*i4 + fs_[5]*i5];
   }
 
+  //---[ Reductions ]------------------
+  template <class TM, const int idxType>
+  occa::memory array<TM,idxType>::reductionMemory(){
+    OCCA_CHECK((offset_ == 0) && isContiguous(),
+               "Reductions on views need contiguous entries at the start of their array, clone() the view first");
+
+    return memory;
+  }
+
+  template <class TM, const int idxType>
+  TM array<TM,idxType>::sum(){
+    return occa::sum<TM>(reductionMemory(), entries());
+  }
+
+  template <class TM, const int idxType>
+  TM array<TM,idxType>::min(){
+    return occa::min<TM>(reductionMemory(), entries());
+  }
+
+  template <class TM, const int idxType>
+  TM array<TM,idxType>::max(){
+    return occa::max<TM>(reductionMemory(), entries());
+  }
+
+  template <class TM, const int idxType>
+  TM array<TM,idxType>::norm2(){
+    return occa::norm2<TM>(reductionMemory(), entries());
+  }
+
+  template <class TM, const int idxType>
+  dim_t array<TM,idxType>::argmin(){
+    return occa::argmin<TM>(reductionMemory(), entries());
+  }
+
+  template <class TM, const int idxType>
+  dim_t array<TM,idxType>::argmax(){
+    return occa::argmax<TM>(reductionMemory(), entries());
+  }
+
+  template <class TM, const int idxType>
+  template <const int idxType2>
+  TM array<TM,idxType>::dot(array<TM,idxType2> &v){
+    OCCA_CHECK(entries() == v.entries(),
+               "occa::array::dot() needs arrays with the same number of entries");
+
+    return occa::dot<TM>(reductionMemory(), v.reductionMemory(), entries());
+  }
+
+  template <class TM, const int idxType>
+  TM array<TM,idxType>::reduce(const reductionOp &op, const TM &identity){
+    return occa::reduce<TM>(reductionMemory(), op, identity, entries());
+  }
+
+  //---[ Expressions ]------------------
+  template <class TM, const int idxType>
+  template <class E>
+  array<TM,idxType>& array<TM,idxType>::operator = (const arrayExpr<E> &e){
+    e.evaluate(*this, "=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class E>
+  array<TM,idxType>& array<TM,idxType>::operator += (const arrayExpr<E> &e){
+    e.evaluate(*this, "+=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class E>
+  array<TM,idxType>& array<TM,idxType>::operator -= (const arrayExpr<E> &e){
+    e.evaluate(*this, "-=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class E>
+  array<TM,idxType>& array<TM,idxType>::operator *= (const arrayExpr<E> &e){
+    e.evaluate(*this, "*=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class E>
+  array<TM,idxType>& array<TM,idxType>::operator /= (const arrayExpr<E> &e){
+    e.evaluate(*this, "/=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <const int idxType2>
+  array<TM,idxType>& array<TM,idxType>::operator += (const array<TM,idxType2> &v){
+    arrayExpr<arrayExpression::leaf_t<TM> >(arrayExpression::leafOf(v)).evaluate(*this, "+=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <const int idxType2>
+  array<TM,idxType>& array<TM,idxType>::operator -= (const array<TM,idxType2> &v){
+    arrayExpr<arrayExpression::leaf_t<TM> >(arrayExpression::leafOf(v)).evaluate(*this, "-=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <const int idxType2>
+  array<TM,idxType>& array<TM,idxType>::operator *= (const array<TM,idxType2> &v){
+    arrayExpr<arrayExpression::leaf_t<TM> >(arrayExpression::leafOf(v)).evaluate(*this, "*=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <const int idxType2>
+  array<TM,idxType>& array<TM,idxType>::operator /= (const array<TM,idxType2> &v){
+    arrayExpr<arrayExpression::leaf_t<TM> >(arrayExpression::leafOf(v)).evaluate(*this, "/=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType>& array<TM,idxType>::operator += (const TM &value){
+    arrayExpr<arrayExpression::scalar_t<TM> >(value).evaluate(*this, "+=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType>& array<TM,idxType>::operator -= (const TM &value){
+    arrayExpr<arrayExpression::scalar_t<TM> >(value).evaluate(*this, "-=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType>& array<TM,idxType>::operator *= (const TM &value){
+    arrayExpr<arrayExpression::scalar_t<TM> >(value).evaluate(*this, "*=");
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  array<TM,idxType>& array<TM,idxType>::operator /= (const TM &value){
+    arrayExpr<arrayExpression::scalar_t<TM> >(value).evaluate(*this, "/=");
+    return *this;
+  }
+
   //---[ Syncs ]------------------------
   template <class TM, const int idxType>
   void array<TM,idxType>::startManaging(){
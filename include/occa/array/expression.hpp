@@ -0,0 +1,306 @@
+#ifndef OCCA_ARRAY_EXPRESSION_HEADER
+#define OCCA_ARRAY_EXPRESSION_HEADER
+
+#include <sstream>
+#include <vector>
+
+#include "occa/base.hpp"
+#include "occa/reduction.hpp"
+
+namespace occa {
+  template <class TM, const int idxType>
+  class array;
+
+  //---[ Array Expressions ]----------------------
+  //  Elementwise math on occa::array builds an expression tree
+  //    instead of running it, assigning the tree to an array runs
+  //    one generated kernel over all entries
+  //
+  //      y  = a*x + y;
+  //      z  = sqrt(x*x + y*y);
+  //      z *= 0.5;
+  //
+  //  Kernels are cached per device by the shape of the expression,
+  //    the arrays and scalars it reads are passed as arguments
+  namespace arrayExpression {
+    class builder_t {
+    public:
+      occa::device device;
+      uintptr_t entries;
+
+      std::stringstream params, expr;
+      std::vector<kernelArg> args;
+
+      // Arrays read more than once are passed once
+      struct arrayArg_t {
+        memory_v *mHandle;
+        uintptr_t offset;
+        int arg;
+      };
+
+      std::vector<arrayArg_t> arrays;
+
+      builder_t(occa::device device_,
+                const uintptr_t entries_);
+
+      // Views starting [offset] entries into [memory] also pass
+      //   their offset
+      void addArray(const std::string &type,
+                    occa::memory memory,
+                    const uintptr_t entries_,
+                    const uintptr_t offset);
+
+      void addScalar(const std::string &type,
+                     const kernelArg &value);
+
+      ///
+      /// Runs [out] [assignment] (TM) expr over all entries,
+      /// [assignment] is "=" or a compound assignment like "+="
+      ///
+      void evaluate(const std::string &type,
+                    occa::memory out,
+                    const uintptr_t outOffset,
+                    const std::string &assignment);
+    };
+
+    template <class TM>
+    class leaf_t {
+    public:
+      typedef TM type_t;
+
+      occa::memory memory;
+      uintptr_t entries, offset;
+
+      leaf_t(occa::memory memory_,
+             const uintptr_t entries_,
+             const uintptr_t offset_) :
+        memory(memory_),
+        entries(entries_),
+        offset(offset_) {}
+
+      void build(builder_t &b) const {
+        b.addArray(reduction::type_t<TM>::name(), memory, entries, offset);
+      }
+    };
+
+    template <class TM>
+    class scalar_t {
+    public:
+      typedef TM type_t;
+
+      TM value;
+
+      scalar_t(const TM &value_) :
+        value(value_) {}
+
+      void build(builder_t &b) const {
+        b.addScalar(reduction::type_t<TM>::name(), value);
+      }
+    };
+
+    // [func] is an OKL function or a prefix operator
+    template <class E>
+    class unary_t {
+    public:
+      typedef typename E::type_t type_t;
+
+      const char *func;
+      E e;
+
+      unary_t(const char *func_, const E &e_) :
+        func(func_),
+        e(e_) {}
+
+      void build(builder_t &b) const {
+        b.expr << func << '(';
+        e.build(b);
+        b.expr << ')';
+      }
+    };
+
+    // [op] is an infix operator or, if [isFunction], an OKL function
+    template <class L, class R>
+    class binary_t {
+    public:
+      typedef typename L::type_t type_t;
+
+      const char *op;
+      bool isFunction;
+      L l;
+      R r;
+
+      binary_t(const char *op_, const bool isFunction_,
+               const L &l_, const R &r_) :
+        op(op_),
+        isFunction(isFunction_),
+        l(l_),
+        r(r_) {}
+
+      void build(builder_t &b) const {
+        if(isFunction){
+          b.expr << op << '(';
+          l.build(b);
+          b.expr << ", ";
+          r.build(b);
+          b.expr << ')';
+        }
+        else {
+          b.expr << '(';
+          l.build(b);
+          b.expr << ' ' << op << ' ';
+          r.build(b);
+          b.expr << ')';
+        }
+      }
+    };
+
+    // Views need contiguous entries
+    template <class TM, const int idxType>
+    leaf_t<TM> leafOf(const array<TM,idxType> &a){
+      OCCA_CHECK(a.isContiguous(),
+                 "Array expressions need contiguous views, clone() the view first");
+
+      return leaf_t<TM>(a.memory,
+                        (a.s_[0] * a.s_[1] * a.s_[2] *
+                         a.s_[3] * a.s_[4] * a.s_[5]),
+                        a.offset_);
+    }
+  }
+
+  // The operators and math functions are friends of arrayExpr and
+  //   array, they are only found through their arguments and don't
+  //   hide ::sqrt and others inside namespace occa
+#define OCCA_ARRAY_EXPR_OPERATIONS(BINARY, UNARY)   \
+  BINARY(operator +, "+", false)                    \
+  BINARY(operator -, "-", false)                    \
+  BINARY(operator *, "*", false)                    \
+  BINARY(operator /, "/", false)                    \
+                                                    \
+  BINARY(pow  , "occaPow"  , true)                  \
+  BINARY(atan2, "occaAtan2", true)                  \
+                                                    \
+  UNARY(operator -, "-")                            \
+                                                    \
+  UNARY(fabs , "occaFabs")                          \
+  UNARY(sqrt , "occaSqrt")                          \
+  UNARY(cbrt , "occaCbrt")                          \
+  UNARY(exp  , "occaExp")                           \
+  UNARY(log2 , "occaLog2")                          \
+  UNARY(log10, "occaLog10")                         \
+  UNARY(sin  , "occaSin")                           \
+  UNARY(cos  , "occaCos")                           \
+  UNARY(tan  , "occaTan")                           \
+  UNARY(sinh , "occaSinh")                          \
+  UNARY(cosh , "occaCosh")                          \
+  UNARY(tanh , "occaTanh")
+
+  // Expressions with an expression, array or scalar
+#define OCCA_ARRAY_EXPR_BINARY_FRIENDS(FUNC, OP, IS_FUNCTION)                                  \
+  template <class R>                                                                          \
+  friend arrayExpr<arrayExpression::binary_t<E, R> >                                          \
+  FUNC (const arrayExpr &l, const arrayExpr<R> &r){                                           \
+    return arrayExpression::binary_t<E, R>(OP, IS_FUNCTION, l.e, r.e);                        \
+  }                                                                                           \
+                                                                                              \
+  template <class TM, const int idxType>                                                      \
+  friend arrayExpr<arrayExpression::binary_t<E, arrayExpression::leaf_t<TM> > >               \
+  FUNC (const arrayExpr &l, const array<TM,idxType> &r){                                      \
+    return arrayExpression::binary_t<E, arrayExpression::leaf_t<TM> >(OP, IS_FUNCTION,        \
+                                                                      l.e,                    \
+                                                                      arrayExpression::leafOf(r)); \
+  }                                                                                           \
+                                                                                              \
+  template <class TM, const int idxType>                                                      \
+  friend arrayExpr<arrayExpression::binary_t<arrayExpression::leaf_t<TM>, E> >                \
+  FUNC (const array<TM,idxType> &l, const arrayExpr &r){                                      \
+    return arrayExpression::binary_t<arrayExpression::leaf_t<TM>, E>(OP, IS_FUNCTION,         \
+                                                                     arrayExpression::leafOf(l), \
+                                                                     r.e);                    \
+  }                                                                                           \
+                                                                                              \
+  friend arrayExpr<arrayExpression::binary_t<E, arrayExpression::scalar_t<type_t> > >         \
+  FUNC (const arrayExpr &l, const type_t &r){                                                 \
+    return arrayExpression::binary_t<E, arrayExpression::scalar_t<type_t> >(OP, IS_FUNCTION,  \
+                                                                             l.e, r);         \
+  }                                                                                           \
+                                                                                              \
+  friend arrayExpr<arrayExpression::binary_t<arrayExpression::scalar_t<type_t>, E> >          \
+  FUNC (const type_t &l, const arrayExpr &r){                                                 \
+    return arrayExpression::binary_t<arrayExpression::scalar_t<type_t>, E>(OP, IS_FUNCTION,   \
+                                                                            l, r.e);          \
+  }
+
+#define OCCA_ARRAY_EXPR_UNARY_FRIENDS(FUNC, OKL_FUNC)                                         \
+  friend arrayExpr<arrayExpression::unary_t<E> >                                              \
+  FUNC (const arrayExpr &e){                                                                  \
+    return arrayExpression::unary_t<E>(OKL_FUNC, e.e);                                        \
+  }
+
+  // Arrays with an array or scalar, occa::array<TM,idxType> expands them
+#define OCCA_ARRAY_BINARY_FRIENDS(FUNC, OP, IS_FUNCTION)                                       \
+  template <const int idxType2>                                                               \
+  friend arrayExpr<arrayExpression::binary_t<arrayExpression::leaf_t<TM>,                     \
+                                             arrayExpression::leaf_t<TM> > >                  \
+  FUNC (const array &l, const array<TM,idxType2> &r){                                         \
+    return arrayExpression::binary_t<arrayExpression::leaf_t<TM>,                             \
+                                     arrayExpression::leaf_t<TM> >(OP, IS_FUNCTION,           \
+                                                                   arrayExpression::leafOf(l), \
+                                                                   arrayExpression::leafOf(r)); \
+  }                                                                                           \
+                                                                                              \
+  friend arrayExpr<arrayExpression::binary_t<arrayExpression::leaf_t<TM>,                     \
+                                             arrayExpression::scalar_t<TM> > >                \
+  FUNC (const array &l, const TM &r){                                                         \
+    return arrayExpression::binary_t<arrayExpression::leaf_t<TM>,                             \
+                                     arrayExpression::scalar_t<TM> >(OP, IS_FUNCTION,         \
+                                                                     arrayExpression::leafOf(l), \
+                                                                     r);                      \
+  }                                                                                           \
+                                                                                              \
+  friend arrayExpr<arrayExpression::binary_t<arrayExpression::scalar_t<TM>,                   \
+                                             arrayExpression::leaf_t<TM> > >                  \
+  FUNC (const TM &l, const array &r){                                                         \
+    return arrayExpression::binary_t<arrayExpression::scalar_t<TM>,                           \
+                                     arrayExpression::leaf_t<TM> >(OP, IS_FUNCTION,           \
+                                                                   l,                         \
+                                                                   arrayExpression::leafOf(r)); \
+  }
+
+#define OCCA_ARRAY_UNARY_FRIENDS(FUNC, OKL_FUNC)                                              \
+  friend arrayExpr<arrayExpression::unary_t<arrayExpression::leaf_t<TM> > >                   \
+  FUNC (const array &a){                                                                      \
+    return arrayExpression::unary_t<arrayExpression::leaf_t<TM> >(OKL_FUNC,                   \
+                                                                  arrayExpression::leafOf(a)); \
+  }
+
+  template <class E>
+  class arrayExpr {
+  public:
+    typedef typename E::type_t type_t;
+
+    E e;
+
+    arrayExpr(const E &e_) :
+      e(e_) {}
+
+    template <class TM, const int idxType>
+    void evaluate(array<TM,idxType> &out,
+                  const std::string &assignment) const {
+
+      OCCA_CHECK(out.isContiguous(),
+                 "Array expressions need contiguous views, clone() the view first");
+
+      arrayExpression::builder_t b(out.device, out.entries());
+
+      e.build(b);
+
+      b.evaluate(reduction::type_t<TM>::name(), out.memory, out.offset_, assignment);
+    }
+
+    OCCA_ARRAY_EXPR_OPERATIONS(OCCA_ARRAY_EXPR_BINARY_FRIENDS,
+                               OCCA_ARRAY_EXPR_UNARY_FRIENDS)
+  };
+  //==============================================
+}
+
+#endif
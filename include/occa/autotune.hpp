@@ -0,0 +1,133 @@
+#ifndef OCCA_AUTOTUNE_HEADER
+#define OCCA_AUTOTUNE_HEADER
+
+#include "occa/tools.hpp"
+#include "occa/base.hpp"
+
+namespace occa {
+  //---[ Auto-Tuning ]----------------------------
+  //  [autotuner] builds a kernel for every point in a space of defines,
+  //    times each variant on representative arguments and stores the
+  //    fastest in a per-device tuning database:
+  //
+  //      $OCCA_CACHE_DIR/tuning/<device hash>
+  //
+  //  Tile and inner sizes are tuned through the defines they use,
+  //    for example [tile(TILE_SIZE)] or [i < INNER_SIZE; ++i; inner0]
+  //
+  //  Later buildKernel() calls for the same source, function, kernelInfo
+  //    and device add the tuned defines, unless they are already defined
+  class autotuner {
+  public:
+    occa::device device;
+    std::string filename, functionName;
+    kernelInfo info;
+
+    stringVector_t defineNames;
+    std::vector<stringVector_t> defineValues;
+
+    std::vector<kernelArg> arguments;
+
+    bool hasWorkingDims;
+    int dims;
+    dim inner, outer;
+
+    int warmups, iterations;
+
+    autotuner(occa::device device_,
+              const std::string &filename_,
+              const std::string &functionName_,
+              const kernelInfo &info_ = defaultKernelInfo);
+
+    template <class TM>
+    autotuner& addDefine(const std::string &name,
+                         const std::vector<TM> &values) {
+      stringVector_t values_;
+
+      for(size_t i = 0; i < values.size(); ++i)
+        values_.push_back(toString(values[i]));
+
+      return addDefineValues(name, values_);
+    }
+
+    template <class TM>
+    autotuner& addDefine(const std::string &name,
+                         const TM *values,
+                         const int count) {
+      return addDefine(name, std::vector<TM>(values, values + count));
+    }
+
+    // Tries every power of two in [minValue, maxValue]
+    autotuner& addPowersOfTwo(const std::string &name,
+                              const int minValue,
+                              const int maxValue);
+
+    autotuner& addDefineValues(const std::string &name,
+                               const stringVector_t &values);
+
+    // Arguments are passed to every variant in the order they were added
+    autotuner& addArgument(const kernelArg &arg);
+
+    // Only needed for kernels that are not parsed
+    autotuner& setWorkingDims(int dims_, dim inner_, dim outer_);
+
+    int variantCount() const;
+    strToStrMap_t variantDefines(const int variant) const;
+
+    ///
+    /// Builds every variant (in parallel for CPU modes),
+    /// times them and stores the fastest in the tuning database.
+    ///
+    /// Returns the fastest variant, built with the tuned defines.
+    ///
+    kernel tune();
+
+    double timeVariant(kernel &variant);
+  };
+
+  namespace tuning {
+    class entry_t {
+    public:
+      double time;
+      strToStrMap_t defines;
+
+      entry_t();
+    };
+
+    typedef std::map<std::string, entry_t> database_t;
+
+    std::string databaseFor(occa::device device);
+
+    std::string kernelKey(const std::string &filename,
+                          const std::string &functionName,
+                          const kernelInfo &info);
+
+    bool find(occa::device device,
+              const std::string &filename,
+              const std::string &functionName,
+              const kernelInfo &info,
+              entry_t &entry);
+
+    void store(occa::device device,
+               const std::string &filename,
+               const std::string &functionName,
+               const kernelInfo &info,
+               const entry_t &entry);
+
+    void addDefines(kernelInfo &info,
+                    const strToStrMap_t &defines);
+
+    // Adds the tuned defines for [functionName], if any
+    void applyTo(occa::device device,
+                 const std::string &filename,
+                 const std::string &functionName,
+                 kernelInfo &info);
+
+    database_t readDatabase(const std::string &databaseFile);
+    void writeDatabase(const std::string &databaseFile,
+                       const database_t &database);
+  }
+  //==============================================
+}
+
+#endif
@@ -69,6 +69,8 @@ namespace occa {
   class kernelInfo;
   class deviceInfo;
   class kernelDatabase;
+  class kernelCapture;
+  class kernelSequence;
 
   //---[ Typedefs ]-----------------------
   typedef std::vector<int>          intVector_t;
@@ -87,8 +89,16 @@ namespace occa {
 
   extern bool uvaEnabledByDefault_f;
   extern bool verboseCompilation_f;
+  extern bool usePrecompiledHeaders_f;
+  extern bool inMemoryCompilation_f;
+  extern bool persistInMemoryCompilation_f;
+  extern bool useCompileServer_f;
 
   void setVerboseCompilation(const bool value);
+  void setUsePrecompiledHeaders(const bool value);
+  void setInMemoryCompilation(const bool value,
+                              const bool persist = false);
+  void setUseCompileServer(const bool value);
 
   namespace flags {
     extern const int checkCacheDir;
@@ -328,11 +338,53 @@ namespace occa {
 #endif
   };
 
+  // CPU layouts of 2D textures, set with the [textureLayout] device
+  //   property. Tiled and Morton textures store 8x8 tiles of entries
+  //   contiguously, in row-major or Z-order inside the tile, tiles
+  //   are in row-major order
+  //
+  // Kernels fetch through index2D(), copies to and from the texture
+  //   convert from and to row-major entries
+  namespace textureLayout {
+    static const int rowMajor = 0;
+    static const int tiled    = 1;
+    static const int morton   = 2;
+
+    // Spreads the 3 bits of [v] to every other bit
+    inline uintptr_t spreadBits(const uintptr_t v) {
+      return ((v & 1) | ((v & 2) << 1) | ((v & 4) << 2));
+    }
+
+    // Entry of (x, y) in a texture with [w] entries per row
+    inline uintptr_t index2D(const int layout, const uintptr_t w,
+                             const uintptr_t x, const uintptr_t y) {
+      if (layout == rowMajor)
+        return ((y * w) + x);
+
+      const uintptr_t tile = ((((y >> 3) * ((w + 7) >> 3)) + (x >> 3)) << 6);
+
+      if (layout == tiled)
+        return (tile + ((y & 7) << 3) + (x & 7));
+
+      return (tile + spreadBits(x & 7) + (spreadBits(y & 7) << 1));
+    }
+
+    // Entries stored for a [w] x [h] texture, tiles are padded
+    inline uintptr_t entries2D(const int layout,
+                               const uintptr_t w, const uintptr_t h) {
+      if (layout == rowMajor)
+        return (w * h);
+
+      return ((((w + 7) >> 3) * ((h + 7) >> 3)) << 6);
+    }
+  }
+
   struct textureInfo_t {
     void *arg;
     int dim;
     int bytesInEntry;
     uintptr_t w, h, d;
+    int layout;
   };
 
   extern const int uint8FormatIndex;
@@ -381,6 +433,8 @@ namespace occa {
     template <occa::mode> friend class occa::device_t;
     friend class occa::kernel;
     friend class occa::device;
+    friend class occa::kernelCapture;
+    friend class occa::kernelSequence;
 
   private:
     std::string strMode;
@@ -391,6 +445,11 @@ namespace occa {
     std::string name;
     std::string sourceFilename, binaryFilename;
 
+    // Original source and kernelInfo used in device::buildKernel
+    std::string buildFilename;
+    std::string buildHeader, buildFlags;
+    flags_t buildParserFlags;
+
     parsedKernelInfo metaInfo;
 
     uintptr_t maximumInnerDimSize_;
@@ -515,6 +574,39 @@ namespace occa {
 
     void runFromArguments();
 
+    //---[ Cost Estimates ]-----------
+    // Parser estimates using the last launch's arguments
+    const kernelCostInfo& costInfo();
+
+    double estimatedFlops();
+    double estimatedBytes();
+    //================================
+
+    //---[ Specialization ]-----------
+    // Rebuilds the kernel with scalar arguments replaced by constants,
+    //   the specialized kernel is launched with the same arguments
+    //   but ignores the values passed for specialized ones
+    kernel specialize(const strToStrMap_t &argValues);
+
+    template <class TM>
+    kernel specialize(const std::string &argName, const TM &value) {
+      strToStrMap_t argValues;
+      argValues[argName] = toString(value);
+
+      return specialize(argValues);
+    }
+
+    template <class TM1, class TM2>
+    kernel specialize(const std::string &argName1, const TM1 &value1,
+                      const std::string &argName2, const TM2 &value2) {
+      strToStrMap_t argValues;
+      argValues[argName1] = toString(value1);
+      argValues[argName2] = toString(value2);
+
+      return specialize(argValues);
+    }
+    //================================
+
 #include "occa/operators/declarations.hpp"
 
     void free();
@@ -1293,6 +1385,8 @@ namespace occa {
     int modeID();
     const std::string& mode();
 
+    // Serial, OpenMP and Pthreads devices also have the CPU topology,
+    //   for example [physicalCores], [numaNodes] or [vectorSet]
     template <class TM>
     TM getProperty(const std::string &prop) {
       if (dHandle->properties.has(prop)) {
@@ -1410,6 +1504,10 @@ namespace occa {
     int simdWidth();
   };
 
+  // Keeps whitespace, for example in [processorName]
+  template <>
+  std::string device::getProperty<std::string>(const std::string &prop);
+
   //   ---[ Device Functions ]----------
   extern device currentDevice;
   device getCurrentDevice();
@@ -1529,7 +1627,11 @@ namespace occa {
       args[0].mHandle = mHandle;
       args[0].dHandle = mHandle->dHandle;
 
-      args[0].data.void_ = mHandle->handle;
+      // Pointers inside an allocation keep their offset
+      //   if the device uses them directly
+      args[0].data.void_ = (mHandle->dHandle->fakesUva() ?
+                            mHandle->handle              :
+                            (void*) arg_);
       args[0].size       = sizeof(void*);
       args[0].info       = kArgInfo::usePointer;
     }
@@ -1556,7 +1658,11 @@ namespace occa {
       args[0].mHandle = mHandle;
       args[0].dHandle = mHandle->dHandle;
 
-      args[0].data.void_ = mHandle->handle;
+      // Pointers inside an allocation keep their offset
+      //   if the device uses them directly
+      args[0].data.void_ = (mHandle->dHandle->fakesUva() ?
+                            mHandle->handle              :
+                            (void*) arg_);
       args[0].size       = sizeof(void*);
       args[0].info       = kArgInfo::usePointer;
     }
@@ -1604,6 +1710,10 @@ namespace occa {
     else{
       argc = 1;
 
+      // Kept for kernel captures, UVA setup checks fakesUva()
+      args[0].mHandle = m.mHandle;
+      args[0].dHandle = m.mHandle->dHandle;
+
       args[0].data.void_ = m.mHandle->handle;
       args[0].size       = sizeof(void*);
       args[0].info       = kArgInfo::usePointer;
@@ -0,0 +1,72 @@
+#ifndef OCCA_CAPTURE_HEADER
+#define OCCA_CAPTURE_HEADER
+
+#include <fstream>
+
+#include "occa/tools.hpp"
+#include "occa/base.hpp"
+
+namespace occa {
+  //---[ Kernel Capture ]-------------------------
+  //  Setting OCCA_CAPTURE=<kernelName> records the first launch of
+  //    <kernelName> in $OCCA_CACHE_DIR/captures/<kernelName>.capture
+  //  which can be re-run with [occa replay <capture file>]
+  namespace capture {
+    bool isEnabledFor(const std::string &kernelName);
+
+    std::string filenameFor(const std::string &kernelName);
+  }
+
+  namespace capturedArgType {
+    static const char value   = 0;
+    static const char pointer = 1; // Bytes the argument pointed to
+    static const char memory  = 2;
+    static const char unknown = 3; // Non-captured pointers (passed as NULL)
+  }
+
+  class capturedArg {
+  public:
+    char type;
+    std::string bytes;
+
+    capturedArg();
+
+    capturedArg(const capturedArg &arg);
+    capturedArg& operator = (const capturedArg &arg);
+  };
+
+  class kernelCapture {
+  public:
+    std::string mode;
+
+    std::string filename, source;
+    std::string functionName;
+    std::string header, flags;
+
+    int dims;
+    occa::dim inner, outer;
+
+    std::vector<capturedArg> arguments;
+    std::vector<occa::memory> memories;
+
+    kernelCapture();
+    kernelCapture(occa::kernel &k);
+
+    void load(occa::kernel &k);
+
+    void write(const std::string &captureFilename) const;
+    void read(const std::string &captureFilename);
+
+    occa::kernel buildKernel(occa::device &device,
+                             const std::string &captureFilename);
+
+    void setArguments(occa::device &device,
+                      occa::kernel &k);
+
+    void resetMemories();
+    void freeMemories();
+  };
+  //==============================================
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef OCCA_COMPILESERVER_HEADER
+#define OCCA_COMPILESERVER_HEADER
+
+#include "occa/tools.hpp"
+#include "occa/base.hpp"
+
+namespace occa {
+  //---[ Compile Server ]-------------------------
+  //  With OCCA_COMPILE_SERVER=1, CPU kernels missing from the cache
+  //    are compiled by one server per node and cache directory:
+  //
+  //      $OCCA_CACHE_DIR/compileServer/socket
+  //      $OCCA_CACHE_DIR/compileServer/log
+  //
+  //  The first process to need it starts [occa compile-server],
+  //    which compiles requests from every process in parallel,
+  //    compiling each hash once, and exits after a minute idle
+  namespace compileServer {
+    std::string serverDir();
+    std::string socketPath();
+
+    ///
+    /// Asks the server to build [binaryFilename] from [source],
+    /// starting the server if it is not running.
+    ///
+    /// Returns true once the binary is in the cache, false if the
+    /// server is not available and the caller should compile it.
+    ///
+    bool compile(const std::string &hash,
+                 const std::string &functionName,
+                 const std::string &source,
+                 const std::string &sourceFilename,
+                 const std::string &binaryFilename,
+                 const std::string &compilerEnvScript,
+                 const std::string &compiler,
+                 const std::string &flags);
+
+    //---[ Server ]-----------------------
+    class request_t {
+    public:
+      std::string hash, functionName;
+      std::string sourceFilename, binaryFilename;
+      std::string compilerEnvScript, compiler, flags;
+      std::string source;
+
+      request_t();
+
+      std::string toString() const;
+      bool fromString(const std::string &str);
+
+      std::string command() const;
+    };
+
+    bool start();
+
+    // Serves until it is idle for [idleSeconds]
+    void serve(const int idleSeconds = 60);
+
+    bool build(const request_t &request,
+               std::string &output);
+    //====================================
+  }
+  //==============================================
+}
+
+#endif
@@ -175,6 +175,12 @@
 #  define OCCA_MIC 0
 #endif
 
+#ifdef __AVX512F__
+#  define OCCA_AVX512F 1
+#else
+#  define OCCA_AVX512F 0
+#endif
+
 #ifdef __AVX2__
 #  define OCCA_AVX2 1
 #else
@@ -245,6 +251,23 @@
 #endif
 #endif
 
+// Half precision conversions
+#ifndef OCCA_F16C
+#ifdef __F16C__
+#  define OCCA_F16C 1
+#else
+#  define OCCA_F16C 0
+#endif
+#endif
+
+#ifndef OCCA_NEON
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#  define OCCA_NEON 1
+#else
+#  define OCCA_NEON 0
+#endif
+#endif
+
 #ifndef OCCA_VECTOR_SET
 #if OCCA_MIC
 #  define OCCA_VECTOR_SET "MIC AVX-512"
@@ -262,6 +285,8 @@
 #  define OCCA_VECTOR_SET "SSE"
 #elif OCCA_MMX
 #  define OCCA_VECTOR_SET "MMX"
+#elif OCCA_NEON
+#  define OCCA_VECTOR_SET "NEON"
 #else
 #  define OCCA_VECTOR_SET "[Vector Instruction Set Not Found]"
 #endif
@@ -272,7 +297,7 @@
 #  define OCCA_SIMD_WIDTH 16
 #elif OCCA_AVX | OCCA_AVX2
 #  define OCCA_SIMD_WIDTH 8
-#elif OCCA_SSE | OCCA_SSE2 | OCCA_SSE3 | OCCA_SSE4
+#elif OCCA_SSE | OCCA_SSE2 | OCCA_SSE3 | OCCA_SSE4 | OCCA_NEON
 #  define OCCA_SIMD_WIDTH 4
 #elif OCCA_MMX
 #  define OCCA_SIMD_WIDTH 2
@@ -280,6 +305,16 @@
 #  define OCCA_SIMD_WIDTH 1
 #endif
 #endif
+
+// Vector types (float4, ...) are backed by GCC/Clang vector extensions,
+//   the compiler lowers them to whichever of SSE/AVX/NEON it targets
+#ifndef OCCA_VECTOR_EXTENSIONS
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__CUDACC__)
+#  define OCCA_VECTOR_EXTENSIONS 1
+#else
+#  define OCCA_VECTOR_EXTENSIONS 0
+#endif
+#endif
 //============================
 
 #define OCCA_MAX_ARGS 50
@@ -2,6 +2,7 @@
 #define OCCA_PTHREADS_DEFINES_HEADER
 
 #include "occa/defines/cpuMode.hpp"
+#include "occa/defines/cpuAtomics.hpp"
 
 //---[ Defines ]----------------------------------
 #define OCCA_USING_SERIAL   0
@@ -12,106 +13,15 @@
 //================================================
 
 
-//---[ Atomics ]----------------------------------
-template <class TM>
-TM occaAtomicAdd(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr += update;
+//---[ Loop Info ]--------------------------------
+// Each thread runs its [start, end) share of the outer loops
+#undef occaOuterFor2
+#undef occaOuterFor1
+#undef occaOuterFor0
 
-  return old;
-}
-
-template <class TM>
-TM occaAtomicSub(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr -= update;
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicSwap(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr = update;
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicInc(TM *ptr){
-  const TM old = *ptr;
-  ++(*ptr);
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicDec(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  --(*ptr);
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicMin(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr = ((old < update) ? old : update);
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicMax(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr = ((old < update) ? update : old);
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicAnd(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr &= update;
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicOr(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr |= update;
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicXor(TM *ptr, const TM &update){
-  const TM old = *ptr;
-  *ptr ^= update;
-
-  return old;
-}
-
-template <class TM>
-TM occaAtomicCAS(TM *ptr, const int comp, const TM &update){
-  TM old;
-
-#pragma omp critical
-  {
-    old = *ptr;
-    if(comp)
-      *ptr = update;
-  }
-
-  return old;
-}
-
-#define occaAtomicAdd64  occaAtomicAdd
-#define occaAtomicSub64  occaAtomicSub
-#define occaAtomicSwap64 occaAtomicSwap
-#define occaAtomicInc64  occaAtomicInc
-#define occaAtomicDec64  occaAtomicDec
+#define occaOuterFor2 for(int occaOuterId2 = occaKernelArgs[6]; occaOuterId2 < occaKernelArgs[7]; ++occaOuterId2)
+#define occaOuterFor1 for(int occaOuterId1 = occaKernelArgs[8]; occaOuterId1 < occaKernelArgs[9]; ++occaOuterId1)
+#define occaOuterFor0 for(int occaOuterId0 = occaKernelArgs[10]; occaOuterId0 < occaKernelArgs[11]; ++occaOuterId0)
 //================================================
 
 
@@ -94,15 +94,11 @@ TM occaAtomicXor(TM *ptr, const TM &update){
 }
 
 template <class TM>
-TM occaAtomicCAS(TM *ptr, const int comp, const TM &update){
-  TM old;
-
-#pragma omp critical
-  {
-    old = *ptr;
-    if(comp)
-      *ptr = update;
-  }
+TM occaAtomicCAS(TM *ptr, const TM &comp, const TM &update){
+  const TM old = *ptr;
+
+  if(old == comp)
+    *ptr = update;
 
   return old;
 }
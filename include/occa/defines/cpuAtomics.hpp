@@ -0,0 +1,224 @@
+#ifndef OCCA_CPU_ATOMICS_HEADER
+#define OCCA_CPU_ATOMICS_HEADER
+
+#include <cstring>
+
+//---[ Atomics ]----------------------------------
+//  Lock-free atomics for the OpenMP and Pthreads modes through the
+//    compiler's __atomic builtins
+//
+//  Integer add, sub, swap, and, or and xor are one atomic instruction,
+//    floating point updates and min/max retry a compare-and-swap.
+//    Updates are relaxed like their GPU counterparts and return
+//    the value they replaced
+//
+//  Compilers without the builtins fall back to an OpenMP critical section
+#if defined(__GNUC__) || defined(__clang__)
+#  define OCCA_CPU_ATOMIC_BUILTINS 1
+#  define OCCA_CPU_ATOMIC_ORDER    __ATOMIC_RELAXED
+#else
+#  define OCCA_CPU_ATOMIC_BUILTINS 0
+#endif
+
+namespace occa {
+  namespace cpuAtomics {
+    template <class TM> struct isInteger { static const bool value = false; };
+
+#define OCCA_CPU_ATOMIC_INTEGER(TYPE)                           \
+    template <> struct isInteger<TYPE> { static const bool value = true; }
+
+    OCCA_CPU_ATOMIC_INTEGER(char);
+    OCCA_CPU_ATOMIC_INTEGER(signed char);
+    OCCA_CPU_ATOMIC_INTEGER(unsigned char);
+    OCCA_CPU_ATOMIC_INTEGER(short);
+    OCCA_CPU_ATOMIC_INTEGER(unsigned short);
+    OCCA_CPU_ATOMIC_INTEGER(int);
+    OCCA_CPU_ATOMIC_INTEGER(unsigned int);
+    OCCA_CPU_ATOMIC_INTEGER(long);
+    OCCA_CPU_ATOMIC_INTEGER(unsigned long);
+    OCCA_CPU_ATOMIC_INTEGER(long long);
+    OCCA_CPU_ATOMIC_INTEGER(unsigned long long);
+
+#undef OCCA_CPU_ATOMIC_INTEGER
+
+    template <class TM>
+    inline TM load(TM *ptr){
+#if OCCA_CPU_ATOMIC_BUILTINS
+      TM value;
+      __atomic_load(ptr, &value, OCCA_CPU_ATOMIC_ORDER);
+      return value;
+#else
+      return *((volatile TM*) ptr);
+#endif
+    }
+
+    // Stores [update] if [ptr] still holds [expected], otherwise
+    //   [expected] is set to the current value
+    template <class TM>
+    inline bool compareExchange(TM *ptr, TM &expected, TM update){
+#if OCCA_CPU_ATOMIC_BUILTINS
+      return __atomic_compare_exchange(ptr, &expected, &update,
+                                       false,
+                                       OCCA_CPU_ATOMIC_ORDER,
+                                       OCCA_CPU_ATOMIC_ORDER);
+#else
+      bool swapped;
+
+      OCCA_PRAGMA("omp critical(occaAtomic)")
+      {
+        swapped = (std::memcmp(ptr, &expected, sizeof(TM)) == 0);
+
+        if(swapped)
+          *ptr = update;
+        else
+          expected = *ptr;
+      }
+
+      return swapped;
+#endif
+    }
+
+    template <class TM>
+    inline TM exchange(TM *ptr, TM update){
+#if OCCA_CPU_ATOMIC_BUILTINS
+      TM old;
+      __atomic_exchange(ptr, &update, &old, OCCA_CPU_ATOMIC_ORDER);
+      return old;
+#else
+      TM old = load(ptr);
+
+      while(!compareExchange(ptr, old, update))
+        ; // Do Nothing
+
+      return old;
+#endif
+    }
+
+    struct add_t { template <class TM> static TM apply(const TM &a, const TM &b){ return (a + b); } };
+    struct sub_t { template <class TM> static TM apply(const TM &a, const TM &b){ return (a - b); } };
+    struct and_t { template <class TM> static TM apply(const TM &a, const TM &b){ return (a & b); } };
+    struct or_t  { template <class TM> static TM apply(const TM &a, const TM &b){ return (a | b); } };
+    struct xor_t { template <class TM> static TM apply(const TM &a, const TM &b){ return (a ^ b); } };
+
+    // Applies [op_t] to the latest value until the swap succeeds
+    template <class op_t, class TM>
+    inline TM update(TM *ptr, const TM &value){
+      TM old = load(ptr);
+
+      while(!compareExchange(ptr, old, op_t::apply(old, value)))
+        ; // Do Nothing
+
+      return old;
+    }
+
+    template <class TM,
+              bool useFetch = (OCCA_CPU_ATOMIC_BUILTINS && isInteger<TM>::value)>
+    struct fetch_t {
+      static TM add(TM *ptr, const TM &v){ return update<add_t>(ptr, v); }
+      static TM sub(TM *ptr, const TM &v){ return update<sub_t>(ptr, v); }
+      static TM and_(TM *ptr, const TM &v){ return update<and_t>(ptr, v); }
+      static TM or_(TM *ptr, const TM &v){ return update<or_t>(ptr, v); }
+      static TM xor_(TM *ptr, const TM &v){ return update<xor_t>(ptr, v); }
+    };
+
+#if OCCA_CPU_ATOMIC_BUILTINS
+    template <class TM>
+    struct fetch_t<TM, true> {
+      static TM add(TM *ptr, const TM &v){ return __atomic_fetch_add(ptr, v, OCCA_CPU_ATOMIC_ORDER); }
+      static TM sub(TM *ptr, const TM &v){ return __atomic_fetch_sub(ptr, v, OCCA_CPU_ATOMIC_ORDER); }
+      static TM and_(TM *ptr, const TM &v){ return __atomic_fetch_and(ptr, v, OCCA_CPU_ATOMIC_ORDER); }
+      static TM or_(TM *ptr, const TM &v){ return __atomic_fetch_or(ptr, v, OCCA_CPU_ATOMIC_ORDER); }
+      static TM xor_(TM *ptr, const TM &v){ return __atomic_fetch_xor(ptr, v, OCCA_CPU_ATOMIC_ORDER); }
+    };
+#endif
+
+    // Only values that lower (raise) the minimum (maximum) are stored
+    template <class TM>
+    inline TM min(TM *ptr, const TM &value){
+      TM old = load(ptr);
+
+      while((value < old) && !compareExchange(ptr, old, value))
+        ; // Do Nothing
+
+      return old;
+    }
+
+    template <class TM>
+    inline TM max(TM *ptr, const TM &value){
+      TM old = load(ptr);
+
+      while((old < value) && !compareExchange(ptr, old, value))
+        ; // Do Nothing
+
+      return old;
+    }
+  }
+}
+
+template <class TM>
+TM occaAtomicAdd(TM *ptr, const TM &update){
+  return occa::cpuAtomics::fetch_t<TM>::add(ptr, update);
+}
+
+template <class TM>
+TM occaAtomicSub(TM *ptr, const TM &update){
+  return occa::cpuAtomics::fetch_t<TM>::sub(ptr, update);
+}
+
+template <class TM>
+TM occaAtomicSwap(TM *ptr, const TM &update){
+  return occa::cpuAtomics::exchange(ptr, update);
+}
+
+template <class TM>
+TM occaAtomicInc(TM *ptr){
+  return occa::cpuAtomics::fetch_t<TM>::add(ptr, (TM) 1);
+}
+
+template <class TM>
+TM occaAtomicDec(TM *ptr, const TM &update){
+  return occa::cpuAtomics::fetch_t<TM>::sub(ptr, (TM) 1);
+}
+
+template <class TM>
+TM occaAtomicMin(TM *ptr, const TM &update){
+  return occa::cpuAtomics::min(ptr, update);
+}
+
+template <class TM>
+TM occaAtomicMax(TM *ptr, const TM &update){
+  return occa::cpuAtomics::max(ptr, update);
+}
+
+template <class TM>
+TM occaAtomicAnd(TM *ptr, const TM &update){
+  return occa::cpuAtomics::fetch_t<TM>::and_(ptr, update);
+}
+
+template <class TM>
+TM occaAtomicOr(TM *ptr, const TM &update){
+  return occa::cpuAtomics::fetch_t<TM>::or_(ptr, update);
+}
+
+template <class TM>
+TM occaAtomicXor(TM *ptr, const TM &update){
+  return occa::cpuAtomics::fetch_t<TM>::xor_(ptr, update);
+}
+
+// Stores [update] if [ptr] holds [comp], like atomicCAS and atomic_cmpxchg
+template <class TM>
+TM occaAtomicCAS(TM *ptr, const TM &comp, const TM &update){
+  TM old = comp;
+  occa::cpuAtomics::compareExchange(ptr, old, update);
+
+  return old;
+}
+
+#define occaAtomicAdd64  occaAtomicAdd
+#define occaAtomicSub64  occaAtomicSub
+#define occaAtomicSwap64 occaAtomicSwap
+#define occaAtomicInc64  occaAtomicInc
+#define occaAtomicDec64  occaAtomicDec
+//================================================
+
+#endif
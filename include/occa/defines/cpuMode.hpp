@@ -407,13 +407,23 @@ public:
 
 
 //---[ Texture ]----------------------------------
+// Matches occa::textureInfo_t
 struct occaTexture {
   void *data;
   int dim;
+  int bytesInEntry;
 
   uintptr_t w, h, d;
+
+  int layout;
 };
 
+// Tiled and Morton 2D textures are swizzled, see occa::textureLayout
+inline uintptr_t occaTexIndex2D(const occaTexture &tex,
+                                const uintptr_t x, const uintptr_t y){
+  return occa::textureLayout::index2D(tex.layout, tex.w, x, y);
+}
+
 #define occaReadOnly  const
 #define occaWriteOnly
 
@@ -421,10 +431,10 @@ struct occaTexture {
 #define occaTexture2D(TEX) occaTexture &TEX
 
 #define occaTexGet1D(TEX, TYPE, VALUE, X)    VALUE = ((TYPE*) TEX.data)[X]
-#define occaTexGet2D(TEX, TYPE, VALUE, X, Y) VALUE = ((TYPE*) TEX.data)[(Y * TEX.w) + X]
+#define occaTexGet2D(TEX, TYPE, VALUE, X, Y) VALUE = ((TYPE*) TEX.data)[occaTexIndex2D(TEX, X, Y)]
 
-#define occaTexSet1D(TEX, TYPE, VALUE, X)    ((TYPE*) TEX.data)[X]               = VALUE
-#define occaTexSet2D(TEX, TYPE, VALUE, X, Y) ((TYPE*) TEX.data)[(Y * TEX.w) + X] = VALUE
+#define occaTexSet1D(TEX, TYPE, VALUE, X)    ((TYPE*) TEX.data)[X]                         = VALUE
+#define occaTexSet2D(TEX, TYPE, VALUE, X, Y) ((TYPE*) TEX.data)[occaTexIndex2D(TEX, X, Y)] = VALUE
 //================================================
 
 #endif
@@ -10,6 +10,20 @@
 #  include <iostream>
 #  include <cmath>
 #  include "occa/defines.hpp"
+#  include "occa/half.hpp"
+
+#  if OCCA_VECTOR_EXTENSIONS
+// Vector storage is aligned to its size, up to the 16 bytes
+//   malloc and new guarantee for host allocations
+#    define OCCA_SIMD_ALIGN(BYTES) (((BYTES) < 16) ? (BYTES) : 16)
+
+// Widens and narrows bfloat16 vectors in registers
+#    if (defined(__clang__) || (__GNUC__ >= 9))
+#      define OCCA_CONVERT_VECTOR 1
+#    else
+#      define OCCA_CONVERT_VECTOR 0
+#    endif
+#  endif
 
 #  ifndef OCCA_IN_KERNEL
 #  define occaFunction
@@ -1614,11 +1628,29 @@ inline std::ostream& operator << (std::ostream &out, const bool16& a){
 #else
 #  define OCCA_CHAR2 char2
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef char occaSimdChar2 __attribute__ ((vector_size(2*sizeof(char)),
+                                         aligned(OCCA_SIMD_ALIGN(2*sizeof(char)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class char2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdChar2 v_;
+
+    __extension__ struct {
+      union { char s0, x; };
+      union { char s1, y; };
+    };
+  };
+
+  explicit inline occaFunction char2(const occaSimdChar2 &v) : 
+    v_(v) {}
+#else
   union { char s0, x; };
   union { char s1, y; };
+#endif
 
   inline occaFunction char2() : 
     x(0),
@@ -1636,138 +1668,256 @@ public:
 #endif
 
 occaFunction inline char2 operator + (const char2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(+a.v_);
+#else
   return OCCA_CHAR2(+a.x,
                     +a.y);
+#endif
 }
 
 occaFunction inline char2 operator ++ (char2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char2 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_CHAR2(a.x++,
                     a.y++);
+#endif
 }
 
 occaFunction inline char2& operator ++ (char2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   return a;
+#endif
 }
 occaFunction inline char2 operator - (const char2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(-a.v_);
+#else
   return OCCA_CHAR2(-a.x,
                     -a.y);
+#endif
 }
 
 occaFunction inline char2 operator -- (char2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char2 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_CHAR2(a.x--,
                     a.y--);
+#endif
 }
 
 occaFunction inline char2& operator -- (char2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   return a;
+#endif
 }
 occaFunction inline char2  operator +  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ + b.v_);
+#else
   return OCCA_CHAR2(a.x + b.x,
                     a.y + b.y);
+#endif
 }
 
 occaFunction inline char2  operator +  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a + b.v_);
+#else
   return OCCA_CHAR2(a + b.x,
                     a + b.y);
+#endif
 }
 
 occaFunction inline char2  operator +  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ + b);
+#else
   return OCCA_CHAR2(a.x + b,
                     a.y + b);
+#endif
 }
 
 occaFunction inline char2& operator += (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   return a;
+#endif
 }
 
 occaFunction inline char2& operator += (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   return a;
+#endif
 }
 occaFunction inline char2  operator -  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ - b.v_);
+#else
   return OCCA_CHAR2(a.x - b.x,
                     a.y - b.y);
+#endif
 }
 
 occaFunction inline char2  operator -  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a - b.v_);
+#else
   return OCCA_CHAR2(a - b.x,
                     a - b.y);
+#endif
 }
 
 occaFunction inline char2  operator -  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ - b);
+#else
   return OCCA_CHAR2(a.x - b,
                     a.y - b);
+#endif
 }
 
 occaFunction inline char2& operator -= (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   return a;
+#endif
 }
 
 occaFunction inline char2& operator -= (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   return a;
+#endif
 }
 occaFunction inline char2  operator *  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ * b.v_);
+#else
   return OCCA_CHAR2(a.x * b.x,
                     a.y * b.y);
+#endif
 }
 
 occaFunction inline char2  operator *  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a * b.v_);
+#else
   return OCCA_CHAR2(a * b.x,
                     a * b.y);
+#endif
 }
 
 occaFunction inline char2  operator *  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ * b);
+#else
   return OCCA_CHAR2(a.x * b,
                     a.y * b);
+#endif
 }
 
 occaFunction inline char2& operator *= (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   return a;
+#endif
 }
 
 occaFunction inline char2& operator *= (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   return a;
+#endif
 }
 occaFunction inline char2  operator /  (const char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ / b.v_);
+#else
   return OCCA_CHAR2(a.x / b.x,
                     a.y / b.y);
+#endif
 }
 
 occaFunction inline char2  operator /  (const char &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a / b.v_);
+#else
   return OCCA_CHAR2(a / b.x,
                     a / b.y);
+#endif
 }
 
 occaFunction inline char2  operator /  (const char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char2(a.v_ / b);
+#else
   return OCCA_CHAR2(a.x / b,
                     a.y / b);
+#endif
 }
 
 occaFunction inline char2& operator /= (      char2 &a, const char2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   return a;
+#endif
 }
 
 occaFunction inline char2& operator /= (      char2 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -1789,13 +1939,33 @@ inline std::ostream& operator << (std::ostream &out, const char2& a){
 #else
 #  define OCCA_CHAR4 char4
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef char occaSimdChar4 __attribute__ ((vector_size(4*sizeof(char)),
+                                         aligned(OCCA_SIMD_ALIGN(4*sizeof(char)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class char4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdChar4 v_;
+
+    __extension__ struct {
+      union { char s0, x; };
+      union { char s1, y; };
+      union { char s2, z; };
+      union { char s3, w; };
+    };
+  };
+
+  explicit inline occaFunction char4(const occaSimdChar4 &v) : 
+    v_(v) {}
+#else
   union { char s0, x; };
   union { char s1, y; };
   union { char s2, z; };
   union { char s3, w; };
+#endif
 
   inline occaFunction char4() : 
     x(0),
@@ -1836,190 +2006,308 @@ public:
 #endif
 
 occaFunction inline char4 operator + (const char4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(+a.v_);
+#else
   return OCCA_CHAR4(+a.x,
                     +a.y,
                     +a.z,
                     +a.w);
+#endif
 }
 
 occaFunction inline char4 operator ++ (char4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char4 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_CHAR4(a.x++,
                     a.y++,
                     a.z++,
                     a.w++);
+#endif
 }
 
 occaFunction inline char4& operator ++ (char4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
   ++a.w;
   return a;
+#endif
 }
 occaFunction inline char4 operator - (const char4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(-a.v_);
+#else
   return OCCA_CHAR4(-a.x,
                     -a.y,
                     -a.z,
                     -a.w);
+#endif
 }
 
 occaFunction inline char4 operator -- (char4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char4 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_CHAR4(a.x--,
                     a.y--,
                     a.z--,
                     a.w--);
+#endif
 }
 
 occaFunction inline char4& operator -- (char4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
   --a.w;
   return a;
+#endif
 }
 occaFunction inline char4  operator +  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ + b.v_);
+#else
   return OCCA_CHAR4(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
                     a.w + b.w);
+#endif
 }
 
 occaFunction inline char4  operator +  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a + b.v_);
+#else
   return OCCA_CHAR4(a + b.x,
                     a + b.y,
                     a + b.z,
                     a + b.w);
+#endif
 }
 
 occaFunction inline char4  operator +  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ + b);
+#else
   return OCCA_CHAR4(a.x + b,
                     a.y + b,
                     a.z + b,
                     a.w + b);
+#endif
 }
 
 occaFunction inline char4& operator += (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
   return a;
+#endif
 }
 
 occaFunction inline char4& operator += (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
   return a;
+#endif
 }
 occaFunction inline char4  operator -  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ - b.v_);
+#else
   return OCCA_CHAR4(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
                     a.w - b.w);
+#endif
 }
 
 occaFunction inline char4  operator -  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a - b.v_);
+#else
   return OCCA_CHAR4(a - b.x,
                     a - b.y,
                     a - b.z,
                     a - b.w);
+#endif
 }
 
 occaFunction inline char4  operator -  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ - b);
+#else
   return OCCA_CHAR4(a.x - b,
                     a.y - b,
                     a.z - b,
                     a.w - b);
+#endif
 }
 
 occaFunction inline char4& operator -= (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
   return a;
+#endif
 }
 
 occaFunction inline char4& operator -= (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
   return a;
+#endif
 }
 occaFunction inline char4  operator *  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ * b.v_);
+#else
   return OCCA_CHAR4(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
                     a.w * b.w);
+#endif
 }
 
 occaFunction inline char4  operator *  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a * b.v_);
+#else
   return OCCA_CHAR4(a * b.x,
                     a * b.y,
                     a * b.z,
                     a * b.w);
+#endif
 }
 
 occaFunction inline char4  operator *  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ * b);
+#else
   return OCCA_CHAR4(a.x * b,
                     a.y * b,
                     a.z * b,
                     a.w * b);
+#endif
 }
 
 occaFunction inline char4& operator *= (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
   return a;
+#endif
 }
 
 occaFunction inline char4& operator *= (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
   return a;
+#endif
 }
 occaFunction inline char4  operator /  (const char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ / b.v_);
+#else
   return OCCA_CHAR4(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
                     a.w / b.w);
+#endif
 }
 
 occaFunction inline char4  operator /  (const char &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a / b.v_);
+#else
   return OCCA_CHAR4(a / b.x,
                     a / b.y,
                     a / b.z,
                     a / b.w);
+#endif
 }
 
 occaFunction inline char4  operator /  (const char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char4(a.v_ / b);
+#else
   return OCCA_CHAR4(a.x / b,
                     a.y / b,
                     a.z / b,
                     a.w / b);
+#endif
 }
 
 occaFunction inline char4& operator /= (      char4 &a, const char4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
   return a;
+#endif
 }
 
 occaFunction inline char4& operator /= (      char4 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -2051,8 +2339,31 @@ typedef char4 char3;
 
 //---[ char8 ]--------------------------
 #define OCCA_CHAR8 char8
+#if OCCA_VECTOR_EXTENSIONS
+typedef char occaSimdChar8 __attribute__ ((vector_size(8*sizeof(char)),
+                                         aligned(OCCA_SIMD_ALIGN(8*sizeof(char)))));
+#endif
 class char8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdChar8 v_;
+
+    __extension__ struct {
+      union { char s0, x; };
+      union { char s1, y; };
+      union { char s2, z; };
+      union { char s3, w; };
+      char s4;
+      char s5;
+      char s6;
+      char s7;
+    };
+  };
+
+  explicit inline occaFunction char8(const occaSimdChar8 &v) : 
+    v_(v) {}
+#else
   union { char s0, x; };
   union { char s1, y; };
   union { char s2, z; };
@@ -2061,6 +2372,7 @@ public:
   char s5;
   char s6;
   char s7;
+#endif
 
   inline occaFunction char8() : 
     x(0),
@@ -2182,6 +2494,9 @@ public:
 };
 
 occaFunction inline char8 operator + (const char8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(+a.v_);
+#else
   return OCCA_CHAR8(+a.x,
                     +a.y,
                     +a.z,
@@ -2190,9 +2505,15 @@ occaFunction inline char8 operator + (const char8 &a){
                     +a.s5,
                     +a.s6,
                     +a.s7);
+#endif
 }
 
 occaFunction inline char8 operator ++ (char8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char8 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_CHAR8(a.x++,
                     a.y++,
                     a.z++,
@@ -2201,9 +2522,14 @@ occaFunction inline char8 operator ++ (char8 &a, int){
                     a.s5++,
                     a.s6++,
                     a.s7++);
+#endif
 }
 
 occaFunction inline char8& operator ++ (char8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -2213,8 +2539,12 @@ occaFunction inline char8& operator ++ (char8 &a){
   ++a.s6;
   ++a.s7;
   return a;
+#endif
 }
 occaFunction inline char8 operator - (const char8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(-a.v_);
+#else
   return OCCA_CHAR8(-a.x,
                     -a.y,
                     -a.z,
@@ -2223,9 +2553,15 @@ occaFunction inline char8 operator - (const char8 &a){
                     -a.s5,
                     -a.s6,
                     -a.s7);
+#endif
 }
 
 occaFunction inline char8 operator -- (char8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char8 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_CHAR8(a.x--,
                     a.y--,
                     a.z--,
@@ -2234,9 +2570,14 @@ occaFunction inline char8 operator -- (char8 &a, int){
                     a.s5--,
                     a.s6--,
                     a.s7--);
+#endif
 }
 
 occaFunction inline char8& operator -- (char8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -2246,8 +2587,12 @@ occaFunction inline char8& operator -- (char8 &a){
   --a.s6;
   --a.s7;
   return a;
+#endif
 }
 occaFunction inline char8  operator +  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ + b.v_);
+#else
   return OCCA_CHAR8(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
@@ -2256,9 +2601,13 @@ occaFunction inline char8  operator +  (const char8 &a, const char8 &b){
                     a.s5 + b.s5,
                     a.s6 + b.s6,
                     a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline char8  operator +  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a + b.v_);
+#else
   return OCCA_CHAR8(a + b.x,
                     a + b.y,
                     a + b.z,
@@ -2267,9 +2616,13 @@ occaFunction inline char8  operator +  (const char &a, const char8 &b){
                     a + b.s5,
                     a + b.s6,
                     a + b.s7);
+#endif
 }
 
 occaFunction inline char8  operator +  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ + b);
+#else
   return OCCA_CHAR8(a.x + b,
                     a.y + b,
                     a.z + b,
@@ -2278,9 +2631,14 @@ occaFunction inline char8  operator +  (const char8 &a, const char &b){
                     a.s5 + b,
                     a.s6 + b,
                     a.s7 + b);
+#endif
 }
 
 occaFunction inline char8& operator += (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -2290,9 +2648,14 @@ occaFunction inline char8& operator += (      char8 &a, const char8 &b){
   a.s6 += b.s6;
   a.s7 += b.s7;
   return a;
+#endif
 }
 
 occaFunction inline char8& operator += (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -2302,8 +2665,12 @@ occaFunction inline char8& operator += (      char8 &a, const char &b){
   a.s6 += b;
   a.s7 += b;
   return a;
+#endif
 }
 occaFunction inline char8  operator -  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ - b.v_);
+#else
   return OCCA_CHAR8(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
@@ -2312,9 +2679,13 @@ occaFunction inline char8  operator -  (const char8 &a, const char8 &b){
                     a.s5 - b.s5,
                     a.s6 - b.s6,
                     a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline char8  operator -  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a - b.v_);
+#else
   return OCCA_CHAR8(a - b.x,
                     a - b.y,
                     a - b.z,
@@ -2323,9 +2694,13 @@ occaFunction inline char8  operator -  (const char &a, const char8 &b){
                     a - b.s5,
                     a - b.s6,
                     a - b.s7);
+#endif
 }
 
 occaFunction inline char8  operator -  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ - b);
+#else
   return OCCA_CHAR8(a.x - b,
                     a.y - b,
                     a.z - b,
@@ -2334,9 +2709,14 @@ occaFunction inline char8  operator -  (const char8 &a, const char &b){
                     a.s5 - b,
                     a.s6 - b,
                     a.s7 - b);
+#endif
 }
 
 occaFunction inline char8& operator -= (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -2346,9 +2726,14 @@ occaFunction inline char8& operator -= (      char8 &a, const char8 &b){
   a.s6 -= b.s6;
   a.s7 -= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline char8& operator -= (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -2358,8 +2743,12 @@ occaFunction inline char8& operator -= (      char8 &a, const char &b){
   a.s6 -= b;
   a.s7 -= b;
   return a;
+#endif
 }
 occaFunction inline char8  operator *  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ * b.v_);
+#else
   return OCCA_CHAR8(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
@@ -2368,9 +2757,13 @@ occaFunction inline char8  operator *  (const char8 &a, const char8 &b){
                     a.s5 * b.s5,
                     a.s6 * b.s6,
                     a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline char8  operator *  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a * b.v_);
+#else
   return OCCA_CHAR8(a * b.x,
                     a * b.y,
                     a * b.z,
@@ -2379,9 +2772,13 @@ occaFunction inline char8  operator *  (const char &a, const char8 &b){
                     a * b.s5,
                     a * b.s6,
                     a * b.s7);
+#endif
 }
 
 occaFunction inline char8  operator *  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ * b);
+#else
   return OCCA_CHAR8(a.x * b,
                     a.y * b,
                     a.z * b,
@@ -2390,9 +2787,14 @@ occaFunction inline char8  operator *  (const char8 &a, const char &b){
                     a.s5 * b,
                     a.s6 * b,
                     a.s7 * b);
+#endif
 }
 
 occaFunction inline char8& operator *= (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -2402,9 +2804,14 @@ occaFunction inline char8& operator *= (      char8 &a, const char8 &b){
   a.s6 *= b.s6;
   a.s7 *= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline char8& operator *= (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -2414,8 +2821,12 @@ occaFunction inline char8& operator *= (      char8 &a, const char &b){
   a.s6 *= b;
   a.s7 *= b;
   return a;
+#endif
 }
 occaFunction inline char8  operator /  (const char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ / b.v_);
+#else
   return OCCA_CHAR8(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
@@ -2424,9 +2835,13 @@ occaFunction inline char8  operator /  (const char8 &a, const char8 &b){
                     a.s5 / b.s5,
                     a.s6 / b.s6,
                     a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline char8  operator /  (const char &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a / b.v_);
+#else
   return OCCA_CHAR8(a / b.x,
                     a / b.y,
                     a / b.z,
@@ -2435,9 +2850,13 @@ occaFunction inline char8  operator /  (const char &a, const char8 &b){
                     a / b.s5,
                     a / b.s6,
                     a / b.s7);
+#endif
 }
 
 occaFunction inline char8  operator /  (const char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char8(a.v_ / b);
+#else
   return OCCA_CHAR8(a.x / b,
                     a.y / b,
                     a.z / b,
@@ -2446,9 +2865,14 @@ occaFunction inline char8  operator /  (const char8 &a, const char &b){
                     a.s5 / b,
                     a.s6 / b,
                     a.s7 / b);
+#endif
 }
 
 occaFunction inline char8& operator /= (      char8 &a, const char8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -2458,9 +2882,14 @@ occaFunction inline char8& operator /= (      char8 &a, const char8 &b){
   a.s6 /= b.s6;
   a.s7 /= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline char8& operator /= (      char8 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -2470,6 +2899,7 @@ occaFunction inline char8& operator /= (      char8 &a, const char &b){
   a.s6 /= b;
   a.s7 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -2493,8 +2923,39 @@ inline std::ostream& operator << (std::ostream &out, const char8& a){
 
 //---[ char16 ]-------------------------
 #define OCCA_CHAR16 char16
+#if OCCA_VECTOR_EXTENSIONS
+typedef char occaSimdChar16 __attribute__ ((vector_size(16*sizeof(char)),
+                                          aligned(OCCA_SIMD_ALIGN(16*sizeof(char)))));
+#endif
 class char16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdChar16 v_;
+
+    __extension__ struct {
+      union { char s0, x; };
+      union { char s1, y; };
+      union { char s2, z; };
+      union { char s3, w; };
+      char s4;
+      char s5;
+      char s6;
+      char s7;
+      char s8;
+      char s9;
+      char s10;
+      char s11;
+      char s12;
+      char s13;
+      char s14;
+      char s15;
+    };
+  };
+
+  explicit inline occaFunction char16(const occaSimdChar16 &v) : 
+    v_(v) {}
+#else
   union { char s0, x; };
   union { char s1, y; };
   union { char s2, z; };
@@ -2511,6 +2972,7 @@ public:
   char s13;
   char s14;
   char s15;
+#endif
 
   inline occaFunction char16() : 
     x(0),
@@ -2940,6 +3402,9 @@ public:
 };
 
 occaFunction inline char16 operator + (const char16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(+a.v_);
+#else
   return OCCA_CHAR16(+a.x,
                      +a.y,
                      +a.z,
@@ -2956,9 +3421,15 @@ occaFunction inline char16 operator + (const char16 &a){
                      +a.s13,
                      +a.s14,
                      +a.s15);
+#endif
 }
 
 occaFunction inline char16 operator ++ (char16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char16 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_CHAR16(a.x++,
                      a.y++,
                      a.z++,
@@ -2975,9 +3446,14 @@ occaFunction inline char16 operator ++ (char16 &a, int){
                      a.s13++,
                      a.s14++,
                      a.s15++);
+#endif
 }
 
 occaFunction inline char16& operator ++ (char16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -2995,8 +3471,12 @@ occaFunction inline char16& operator ++ (char16 &a){
   ++a.s14;
   ++a.s15;
   return a;
+#endif
 }
 occaFunction inline char16 operator - (const char16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(-a.v_);
+#else
   return OCCA_CHAR16(-a.x,
                      -a.y,
                      -a.z,
@@ -3013,9 +3493,15 @@ occaFunction inline char16 operator - (const char16 &a){
                      -a.s13,
                      -a.s14,
                      -a.s15);
+#endif
 }
 
 occaFunction inline char16 operator -- (char16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const char16 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_CHAR16(a.x--,
                      a.y--,
                      a.z--,
@@ -3032,9 +3518,14 @@ occaFunction inline char16 operator -- (char16 &a, int){
                      a.s13--,
                      a.s14--,
                      a.s15--);
+#endif
 }
 
 occaFunction inline char16& operator -- (char16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -3052,8 +3543,12 @@ occaFunction inline char16& operator -- (char16 &a){
   --a.s14;
   --a.s15;
   return a;
+#endif
 }
 occaFunction inline char16  operator +  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ + b.v_);
+#else
   return OCCA_CHAR16(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -3070,9 +3565,13 @@ occaFunction inline char16  operator +  (const char16 &a, const char16 &b){
                      a.s13 + b.s13,
                      a.s14 + b.s14,
                      a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline char16  operator +  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a + b.v_);
+#else
   return OCCA_CHAR16(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -3089,9 +3588,13 @@ occaFunction inline char16  operator +  (const char &a, const char16 &b){
                      a + b.s13,
                      a + b.s14,
                      a + b.s15);
+#endif
 }
 
 occaFunction inline char16  operator +  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ + b);
+#else
   return OCCA_CHAR16(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -3108,9 +3611,14 @@ occaFunction inline char16  operator +  (const char16 &a, const char &b){
                      a.s13 + b,
                      a.s14 + b,
                      a.s15 + b);
+#endif
 }
 
 occaFunction inline char16& operator += (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -3128,9 +3636,14 @@ occaFunction inline char16& operator += (      char16 &a, const char16 &b){
   a.s14 += b.s14;
   a.s15 += b.s15;
   return a;
+#endif
 }
 
 occaFunction inline char16& operator += (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -3148,8 +3661,12 @@ occaFunction inline char16& operator += (      char16 &a, const char &b){
   a.s14 += b;
   a.s15 += b;
   return a;
+#endif
 }
 occaFunction inline char16  operator -  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ - b.v_);
+#else
   return OCCA_CHAR16(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -3166,9 +3683,13 @@ occaFunction inline char16  operator -  (const char16 &a, const char16 &b){
                      a.s13 - b.s13,
                      a.s14 - b.s14,
                      a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline char16  operator -  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a - b.v_);
+#else
   return OCCA_CHAR16(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -3185,9 +3706,13 @@ occaFunction inline char16  operator -  (const char &a, const char16 &b){
                      a - b.s13,
                      a - b.s14,
                      a - b.s15);
+#endif
 }
 
 occaFunction inline char16  operator -  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ - b);
+#else
   return OCCA_CHAR16(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -3204,9 +3729,14 @@ occaFunction inline char16  operator -  (const char16 &a, const char &b){
                      a.s13 - b,
                      a.s14 - b,
                      a.s15 - b);
+#endif
 }
 
 occaFunction inline char16& operator -= (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -3224,9 +3754,14 @@ occaFunction inline char16& operator -= (      char16 &a, const char16 &b){
   a.s14 -= b.s14;
   a.s15 -= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline char16& operator -= (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -3244,8 +3779,12 @@ occaFunction inline char16& operator -= (      char16 &a, const char &b){
   a.s14 -= b;
   a.s15 -= b;
   return a;
+#endif
 }
 occaFunction inline char16  operator *  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ * b.v_);
+#else
   return OCCA_CHAR16(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -3262,9 +3801,13 @@ occaFunction inline char16  operator *  (const char16 &a, const char16 &b){
                      a.s13 * b.s13,
                      a.s14 * b.s14,
                      a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline char16  operator *  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a * b.v_);
+#else
   return OCCA_CHAR16(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -3281,9 +3824,13 @@ occaFunction inline char16  operator *  (const char &a, const char16 &b){
                      a * b.s13,
                      a * b.s14,
                      a * b.s15);
+#endif
 }
 
 occaFunction inline char16  operator *  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ * b);
+#else
   return OCCA_CHAR16(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -3300,9 +3847,14 @@ occaFunction inline char16  operator *  (const char16 &a, const char &b){
                      a.s13 * b,
                      a.s14 * b,
                      a.s15 * b);
+#endif
 }
 
 occaFunction inline char16& operator *= (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -3320,9 +3872,14 @@ occaFunction inline char16& operator *= (      char16 &a, const char16 &b){
   a.s14 *= b.s14;
   a.s15 *= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline char16& operator *= (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -3340,8 +3897,12 @@ occaFunction inline char16& operator *= (      char16 &a, const char &b){
   a.s14 *= b;
   a.s15 *= b;
   return a;
+#endif
 }
 occaFunction inline char16  operator /  (const char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ / b.v_);
+#else
   return OCCA_CHAR16(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -3358,9 +3919,13 @@ occaFunction inline char16  operator /  (const char16 &a, const char16 &b){
                      a.s13 / b.s13,
                      a.s14 / b.s14,
                      a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline char16  operator /  (const char &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a / b.v_);
+#else
   return OCCA_CHAR16(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -3377,9 +3942,13 @@ occaFunction inline char16  operator /  (const char &a, const char16 &b){
                      a / b.s13,
                      a / b.s14,
                      a / b.s15);
+#endif
 }
 
 occaFunction inline char16  operator /  (const char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return char16(a.v_ / b);
+#else
   return OCCA_CHAR16(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -3396,9 +3965,14 @@ occaFunction inline char16  operator /  (const char16 &a, const char &b){
                      a.s13 / b,
                      a.s14 / b,
                      a.s15 / b);
+#endif
 }
 
 occaFunction inline char16& operator /= (      char16 &a, const char16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -3416,9 +3990,14 @@ occaFunction inline char16& operator /= (      char16 &a, const char16 &b){
   a.s14 /= b.s14;
   a.s15 /= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline char16& operator /= (      char16 &a, const char &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -3436,6 +4015,7 @@ occaFunction inline char16& operator /= (      char16 &a, const char &b){
   a.s14 /= b;
   a.s15 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -3471,11 +4051,29 @@ inline std::ostream& operator << (std::ostream &out, const char16& a){
 #else
 #  define OCCA_SHORT2 short2
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef short occaSimdShort2 __attribute__ ((vector_size(2*sizeof(short)),
+                                           aligned(OCCA_SIMD_ALIGN(2*sizeof(short)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class short2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdShort2 v_;
+
+    __extension__ struct {
+      union { short s0, x; };
+      union { short s1, y; };
+    };
+  };
+
+  explicit inline occaFunction short2(const occaSimdShort2 &v) : 
+    v_(v) {}
+#else
   union { short s0, x; };
   union { short s1, y; };
+#endif
 
   inline occaFunction short2() : 
     x(0),
@@ -3493,138 +4091,256 @@ public:
 #endif
 
 occaFunction inline short2 operator + (const short2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(+a.v_);
+#else
   return OCCA_SHORT2(+a.x,
                      +a.y);
+#endif
 }
 
 occaFunction inline short2 operator ++ (short2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short2 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_SHORT2(a.x++,
                      a.y++);
+#endif
 }
 
 occaFunction inline short2& operator ++ (short2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   return a;
+#endif
 }
 occaFunction inline short2 operator - (const short2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(-a.v_);
+#else
   return OCCA_SHORT2(-a.x,
                      -a.y);
+#endif
 }
 
 occaFunction inline short2 operator -- (short2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short2 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_SHORT2(a.x--,
                      a.y--);
+#endif
 }
 
 occaFunction inline short2& operator -- (short2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   return a;
+#endif
 }
 occaFunction inline short2  operator +  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ + b.v_);
+#else
   return OCCA_SHORT2(a.x + b.x,
                      a.y + b.y);
+#endif
 }
 
 occaFunction inline short2  operator +  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a + b.v_);
+#else
   return OCCA_SHORT2(a + b.x,
                      a + b.y);
+#endif
 }
 
 occaFunction inline short2  operator +  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ + b);
+#else
   return OCCA_SHORT2(a.x + b,
                      a.y + b);
+#endif
 }
 
 occaFunction inline short2& operator += (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   return a;
+#endif
 }
 
 occaFunction inline short2& operator += (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   return a;
+#endif
 }
 occaFunction inline short2  operator -  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ - b.v_);
+#else
   return OCCA_SHORT2(a.x - b.x,
                      a.y - b.y);
+#endif
 }
 
 occaFunction inline short2  operator -  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a - b.v_);
+#else
   return OCCA_SHORT2(a - b.x,
                      a - b.y);
+#endif
 }
 
 occaFunction inline short2  operator -  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ - b);
+#else
   return OCCA_SHORT2(a.x - b,
                      a.y - b);
+#endif
 }
 
 occaFunction inline short2& operator -= (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   return a;
+#endif
 }
 
 occaFunction inline short2& operator -= (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   return a;
+#endif
 }
 occaFunction inline short2  operator *  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ * b.v_);
+#else
   return OCCA_SHORT2(a.x * b.x,
                      a.y * b.y);
+#endif
 }
 
 occaFunction inline short2  operator *  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a * b.v_);
+#else
   return OCCA_SHORT2(a * b.x,
                      a * b.y);
+#endif
 }
 
 occaFunction inline short2  operator *  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ * b);
+#else
   return OCCA_SHORT2(a.x * b,
                      a.y * b);
+#endif
 }
 
 occaFunction inline short2& operator *= (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   return a;
+#endif
 }
 
 occaFunction inline short2& operator *= (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   return a;
+#endif
 }
 occaFunction inline short2  operator /  (const short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ / b.v_);
+#else
   return OCCA_SHORT2(a.x / b.x,
                      a.y / b.y);
+#endif
 }
 
 occaFunction inline short2  operator /  (const short &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a / b.v_);
+#else
   return OCCA_SHORT2(a / b.x,
                      a / b.y);
+#endif
 }
 
 occaFunction inline short2  operator /  (const short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short2(a.v_ / b);
+#else
   return OCCA_SHORT2(a.x / b,
                      a.y / b);
+#endif
 }
 
 occaFunction inline short2& operator /= (      short2 &a, const short2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   return a;
+#endif
 }
 
 occaFunction inline short2& operator /= (      short2 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -3646,13 +4362,33 @@ inline std::ostream& operator << (std::ostream &out, const short2& a){
 #else
 #  define OCCA_SHORT4 short4
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef short occaSimdShort4 __attribute__ ((vector_size(4*sizeof(short)),
+                                           aligned(OCCA_SIMD_ALIGN(4*sizeof(short)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class short4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdShort4 v_;
+
+    __extension__ struct {
+      union { short s0, x; };
+      union { short s1, y; };
+      union { short s2, z; };
+      union { short s3, w; };
+    };
+  };
+
+  explicit inline occaFunction short4(const occaSimdShort4 &v) : 
+    v_(v) {}
+#else
   union { short s0, x; };
   union { short s1, y; };
   union { short s2, z; };
   union { short s3, w; };
+#endif
 
   inline occaFunction short4() : 
     x(0),
@@ -3693,190 +4429,308 @@ public:
 #endif
 
 occaFunction inline short4 operator + (const short4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(+a.v_);
+#else
   return OCCA_SHORT4(+a.x,
                      +a.y,
                      +a.z,
                      +a.w);
+#endif
 }
 
 occaFunction inline short4 operator ++ (short4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short4 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_SHORT4(a.x++,
                      a.y++,
                      a.z++,
                      a.w++);
+#endif
 }
 
 occaFunction inline short4& operator ++ (short4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
   ++a.w;
   return a;
+#endif
 }
 occaFunction inline short4 operator - (const short4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(-a.v_);
+#else
   return OCCA_SHORT4(-a.x,
                      -a.y,
                      -a.z,
                      -a.w);
+#endif
 }
 
 occaFunction inline short4 operator -- (short4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short4 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_SHORT4(a.x--,
                      a.y--,
                      a.z--,
                      a.w--);
+#endif
 }
 
 occaFunction inline short4& operator -- (short4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
   --a.w;
   return a;
+#endif
 }
 occaFunction inline short4  operator +  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ + b.v_);
+#else
   return OCCA_SHORT4(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
                      a.w + b.w);
+#endif
 }
 
 occaFunction inline short4  operator +  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a + b.v_);
+#else
   return OCCA_SHORT4(a + b.x,
                      a + b.y,
                      a + b.z,
                      a + b.w);
+#endif
 }
 
 occaFunction inline short4  operator +  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ + b);
+#else
   return OCCA_SHORT4(a.x + b,
                      a.y + b,
                      a.z + b,
                      a.w + b);
+#endif
 }
 
 occaFunction inline short4& operator += (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
   return a;
+#endif
 }
 
 occaFunction inline short4& operator += (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
   return a;
+#endif
 }
 occaFunction inline short4  operator -  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ - b.v_);
+#else
   return OCCA_SHORT4(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
                      a.w - b.w);
+#endif
 }
 
 occaFunction inline short4  operator -  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a - b.v_);
+#else
   return OCCA_SHORT4(a - b.x,
                      a - b.y,
                      a - b.z,
                      a - b.w);
+#endif
 }
 
 occaFunction inline short4  operator -  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ - b);
+#else
   return OCCA_SHORT4(a.x - b,
                      a.y - b,
                      a.z - b,
                      a.w - b);
+#endif
 }
 
 occaFunction inline short4& operator -= (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
   return a;
+#endif
 }
 
 occaFunction inline short4& operator -= (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
   return a;
+#endif
 }
 occaFunction inline short4  operator *  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ * b.v_);
+#else
   return OCCA_SHORT4(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
                      a.w * b.w);
+#endif
 }
 
 occaFunction inline short4  operator *  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a * b.v_);
+#else
   return OCCA_SHORT4(a * b.x,
                      a * b.y,
                      a * b.z,
                      a * b.w);
+#endif
 }
 
 occaFunction inline short4  operator *  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ * b);
+#else
   return OCCA_SHORT4(a.x * b,
                      a.y * b,
                      a.z * b,
                      a.w * b);
+#endif
 }
 
 occaFunction inline short4& operator *= (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
   return a;
+#endif
 }
 
 occaFunction inline short4& operator *= (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
   return a;
+#endif
 }
 occaFunction inline short4  operator /  (const short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ / b.v_);
+#else
   return OCCA_SHORT4(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
                      a.w / b.w);
+#endif
 }
 
 occaFunction inline short4  operator /  (const short &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a / b.v_);
+#else
   return OCCA_SHORT4(a / b.x,
                      a / b.y,
                      a / b.z,
                      a / b.w);
+#endif
 }
 
 occaFunction inline short4  operator /  (const short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short4(a.v_ / b);
+#else
   return OCCA_SHORT4(a.x / b,
                      a.y / b,
                      a.z / b,
                      a.w / b);
+#endif
 }
 
 occaFunction inline short4& operator /= (      short4 &a, const short4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
   return a;
+#endif
 }
 
 occaFunction inline short4& operator /= (      short4 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -3908,8 +4762,31 @@ typedef short4 short3;
 
 //---[ short8 ]-------------------------
 #define OCCA_SHORT8 short8
+#if OCCA_VECTOR_EXTENSIONS
+typedef short occaSimdShort8 __attribute__ ((vector_size(8*sizeof(short)),
+                                           aligned(OCCA_SIMD_ALIGN(8*sizeof(short)))));
+#endif
 class short8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdShort8 v_;
+
+    __extension__ struct {
+      union { short s0, x; };
+      union { short s1, y; };
+      union { short s2, z; };
+      union { short s3, w; };
+      short s4;
+      short s5;
+      short s6;
+      short s7;
+    };
+  };
+
+  explicit inline occaFunction short8(const occaSimdShort8 &v) : 
+    v_(v) {}
+#else
   union { short s0, x; };
   union { short s1, y; };
   union { short s2, z; };
@@ -3918,6 +4795,7 @@ public:
   short s5;
   short s6;
   short s7;
+#endif
 
   inline occaFunction short8() : 
     x(0),
@@ -4039,6 +4917,9 @@ public:
 };
 
 occaFunction inline short8 operator + (const short8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(+a.v_);
+#else
   return OCCA_SHORT8(+a.x,
                      +a.y,
                      +a.z,
@@ -4047,9 +4928,15 @@ occaFunction inline short8 operator + (const short8 &a){
                      +a.s5,
                      +a.s6,
                      +a.s7);
+#endif
 }
 
 occaFunction inline short8 operator ++ (short8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short8 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_SHORT8(a.x++,
                      a.y++,
                      a.z++,
@@ -4058,9 +4945,14 @@ occaFunction inline short8 operator ++ (short8 &a, int){
                      a.s5++,
                      a.s6++,
                      a.s7++);
+#endif
 }
 
 occaFunction inline short8& operator ++ (short8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -4070,8 +4962,12 @@ occaFunction inline short8& operator ++ (short8 &a){
   ++a.s6;
   ++a.s7;
   return a;
+#endif
 }
 occaFunction inline short8 operator - (const short8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(-a.v_);
+#else
   return OCCA_SHORT8(-a.x,
                      -a.y,
                      -a.z,
@@ -4080,9 +4976,15 @@ occaFunction inline short8 operator - (const short8 &a){
                      -a.s5,
                      -a.s6,
                      -a.s7);
+#endif
 }
 
 occaFunction inline short8 operator -- (short8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short8 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_SHORT8(a.x--,
                      a.y--,
                      a.z--,
@@ -4091,9 +4993,14 @@ occaFunction inline short8 operator -- (short8 &a, int){
                      a.s5--,
                      a.s6--,
                      a.s7--);
+#endif
 }
 
 occaFunction inline short8& operator -- (short8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -4103,8 +5010,12 @@ occaFunction inline short8& operator -- (short8 &a){
   --a.s6;
   --a.s7;
   return a;
+#endif
 }
 occaFunction inline short8  operator +  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ + b.v_);
+#else
   return OCCA_SHORT8(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -4113,9 +5024,13 @@ occaFunction inline short8  operator +  (const short8 &a, const short8 &b){
                      a.s5 + b.s5,
                      a.s6 + b.s6,
                      a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline short8  operator +  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a + b.v_);
+#else
   return OCCA_SHORT8(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -4124,9 +5039,13 @@ occaFunction inline short8  operator +  (const short &a, const short8 &b){
                      a + b.s5,
                      a + b.s6,
                      a + b.s7);
+#endif
 }
 
 occaFunction inline short8  operator +  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ + b);
+#else
   return OCCA_SHORT8(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -4135,9 +5054,14 @@ occaFunction inline short8  operator +  (const short8 &a, const short &b){
                      a.s5 + b,
                      a.s6 + b,
                      a.s7 + b);
+#endif
 }
 
 occaFunction inline short8& operator += (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -4147,9 +5071,14 @@ occaFunction inline short8& operator += (      short8 &a, const short8 &b){
   a.s6 += b.s6;
   a.s7 += b.s7;
   return a;
+#endif
 }
 
 occaFunction inline short8& operator += (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -4159,8 +5088,12 @@ occaFunction inline short8& operator += (      short8 &a, const short &b){
   a.s6 += b;
   a.s7 += b;
   return a;
+#endif
 }
 occaFunction inline short8  operator -  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ - b.v_);
+#else
   return OCCA_SHORT8(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -4169,9 +5102,13 @@ occaFunction inline short8  operator -  (const short8 &a, const short8 &b){
                      a.s5 - b.s5,
                      a.s6 - b.s6,
                      a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline short8  operator -  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a - b.v_);
+#else
   return OCCA_SHORT8(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -4180,9 +5117,13 @@ occaFunction inline short8  operator -  (const short &a, const short8 &b){
                      a - b.s5,
                      a - b.s6,
                      a - b.s7);
+#endif
 }
 
 occaFunction inline short8  operator -  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ - b);
+#else
   return OCCA_SHORT8(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -4191,9 +5132,14 @@ occaFunction inline short8  operator -  (const short8 &a, const short &b){
                      a.s5 - b,
                      a.s6 - b,
                      a.s7 - b);
+#endif
 }
 
 occaFunction inline short8& operator -= (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -4203,9 +5149,14 @@ occaFunction inline short8& operator -= (      short8 &a, const short8 &b){
   a.s6 -= b.s6;
   a.s7 -= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline short8& operator -= (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -4215,8 +5166,12 @@ occaFunction inline short8& operator -= (      short8 &a, const short &b){
   a.s6 -= b;
   a.s7 -= b;
   return a;
+#endif
 }
 occaFunction inline short8  operator *  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ * b.v_);
+#else
   return OCCA_SHORT8(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -4225,9 +5180,13 @@ occaFunction inline short8  operator *  (const short8 &a, const short8 &b){
                      a.s5 * b.s5,
                      a.s6 * b.s6,
                      a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline short8  operator *  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a * b.v_);
+#else
   return OCCA_SHORT8(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -4236,9 +5195,13 @@ occaFunction inline short8  operator *  (const short &a, const short8 &b){
                      a * b.s5,
                      a * b.s6,
                      a * b.s7);
+#endif
 }
 
 occaFunction inline short8  operator *  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ * b);
+#else
   return OCCA_SHORT8(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -4247,9 +5210,14 @@ occaFunction inline short8  operator *  (const short8 &a, const short &b){
                      a.s5 * b,
                      a.s6 * b,
                      a.s7 * b);
+#endif
 }
 
 occaFunction inline short8& operator *= (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -4259,9 +5227,14 @@ occaFunction inline short8& operator *= (      short8 &a, const short8 &b){
   a.s6 *= b.s6;
   a.s7 *= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline short8& operator *= (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -4271,8 +5244,12 @@ occaFunction inline short8& operator *= (      short8 &a, const short &b){
   a.s6 *= b;
   a.s7 *= b;
   return a;
+#endif
 }
 occaFunction inline short8  operator /  (const short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ / b.v_);
+#else
   return OCCA_SHORT8(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -4281,9 +5258,13 @@ occaFunction inline short8  operator /  (const short8 &a, const short8 &b){
                      a.s5 / b.s5,
                      a.s6 / b.s6,
                      a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline short8  operator /  (const short &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a / b.v_);
+#else
   return OCCA_SHORT8(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -4292,9 +5273,13 @@ occaFunction inline short8  operator /  (const short &a, const short8 &b){
                      a / b.s5,
                      a / b.s6,
                      a / b.s7);
+#endif
 }
 
 occaFunction inline short8  operator /  (const short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short8(a.v_ / b);
+#else
   return OCCA_SHORT8(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -4303,9 +5288,14 @@ occaFunction inline short8  operator /  (const short8 &a, const short &b){
                      a.s5 / b,
                      a.s6 / b,
                      a.s7 / b);
+#endif
 }
 
 occaFunction inline short8& operator /= (      short8 &a, const short8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -4315,9 +5305,14 @@ occaFunction inline short8& operator /= (      short8 &a, const short8 &b){
   a.s6 /= b.s6;
   a.s7 /= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline short8& operator /= (      short8 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -4327,6 +5322,7 @@ occaFunction inline short8& operator /= (      short8 &a, const short &b){
   a.s6 /= b;
   a.s7 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -4350,8 +5346,39 @@ inline std::ostream& operator << (std::ostream &out, const short8& a){
 
 //---[ short16 ]------------------------
 #define OCCA_SHORT16 short16
+#if OCCA_VECTOR_EXTENSIONS
+typedef short occaSimdShort16 __attribute__ ((vector_size(16*sizeof(short)),
+                                            aligned(OCCA_SIMD_ALIGN(16*sizeof(short)))));
+#endif
 class short16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdShort16 v_;
+
+    __extension__ struct {
+      union { short s0, x; };
+      union { short s1, y; };
+      union { short s2, z; };
+      union { short s3, w; };
+      short s4;
+      short s5;
+      short s6;
+      short s7;
+      short s8;
+      short s9;
+      short s10;
+      short s11;
+      short s12;
+      short s13;
+      short s14;
+      short s15;
+    };
+  };
+
+  explicit inline occaFunction short16(const occaSimdShort16 &v) : 
+    v_(v) {}
+#else
   union { short s0, x; };
   union { short s1, y; };
   union { short s2, z; };
@@ -4368,6 +5395,7 @@ public:
   short s13;
   short s14;
   short s15;
+#endif
 
   inline occaFunction short16() : 
     x(0),
@@ -4797,6 +5825,9 @@ public:
 };
 
 occaFunction inline short16 operator + (const short16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(+a.v_);
+#else
   return OCCA_SHORT16(+a.x,
                       +a.y,
                       +a.z,
@@ -4813,9 +5844,15 @@ occaFunction inline short16 operator + (const short16 &a){
                       +a.s13,
                       +a.s14,
                       +a.s15);
+#endif
 }
 
 occaFunction inline short16 operator ++ (short16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short16 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_SHORT16(a.x++,
                       a.y++,
                       a.z++,
@@ -4832,9 +5869,14 @@ occaFunction inline short16 operator ++ (short16 &a, int){
                       a.s13++,
                       a.s14++,
                       a.s15++);
+#endif
 }
 
 occaFunction inline short16& operator ++ (short16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -4852,8 +5894,12 @@ occaFunction inline short16& operator ++ (short16 &a){
   ++a.s14;
   ++a.s15;
   return a;
+#endif
 }
 occaFunction inline short16 operator - (const short16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(-a.v_);
+#else
   return OCCA_SHORT16(-a.x,
                       -a.y,
                       -a.z,
@@ -4870,9 +5916,15 @@ occaFunction inline short16 operator - (const short16 &a){
                       -a.s13,
                       -a.s14,
                       -a.s15);
+#endif
 }
 
 occaFunction inline short16 operator -- (short16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const short16 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_SHORT16(a.x--,
                       a.y--,
                       a.z--,
@@ -4889,9 +5941,14 @@ occaFunction inline short16 operator -- (short16 &a, int){
                       a.s13--,
                       a.s14--,
                       a.s15--);
+#endif
 }
 
 occaFunction inline short16& operator -- (short16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -4909,8 +5966,12 @@ occaFunction inline short16& operator -- (short16 &a){
   --a.s14;
   --a.s15;
   return a;
+#endif
 }
 occaFunction inline short16  operator +  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ + b.v_);
+#else
   return OCCA_SHORT16(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
@@ -4927,9 +5988,13 @@ occaFunction inline short16  operator +  (const short16 &a, const short16 &b){
                       a.s13 + b.s13,
                       a.s14 + b.s14,
                       a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline short16  operator +  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a + b.v_);
+#else
   return OCCA_SHORT16(a + b.x,
                       a + b.y,
                       a + b.z,
@@ -4946,9 +6011,13 @@ occaFunction inline short16  operator +  (const short &a, const short16 &b){
                       a + b.s13,
                       a + b.s14,
                       a + b.s15);
+#endif
 }
 
 occaFunction inline short16  operator +  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ + b);
+#else
   return OCCA_SHORT16(a.x + b,
                       a.y + b,
                       a.z + b,
@@ -4965,9 +6034,14 @@ occaFunction inline short16  operator +  (const short16 &a, const short &b){
                       a.s13 + b,
                       a.s14 + b,
                       a.s15 + b);
+#endif
 }
 
 occaFunction inline short16& operator += (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -4985,9 +6059,14 @@ occaFunction inline short16& operator += (      short16 &a, const short16 &b){
   a.s14 += b.s14;
   a.s15 += b.s15;
   return a;
+#endif
 }
 
 occaFunction inline short16& operator += (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -5005,8 +6084,12 @@ occaFunction inline short16& operator += (      short16 &a, const short &b){
   a.s14 += b;
   a.s15 += b;
   return a;
+#endif
 }
 occaFunction inline short16  operator -  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ - b.v_);
+#else
   return OCCA_SHORT16(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
@@ -5023,9 +6106,13 @@ occaFunction inline short16  operator -  (const short16 &a, const short16 &b){
                       a.s13 - b.s13,
                       a.s14 - b.s14,
                       a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline short16  operator -  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a - b.v_);
+#else
   return OCCA_SHORT16(a - b.x,
                       a - b.y,
                       a - b.z,
@@ -5042,9 +6129,13 @@ occaFunction inline short16  operator -  (const short &a, const short16 &b){
                       a - b.s13,
                       a - b.s14,
                       a - b.s15);
+#endif
 }
 
 occaFunction inline short16  operator -  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ - b);
+#else
   return OCCA_SHORT16(a.x - b,
                       a.y - b,
                       a.z - b,
@@ -5061,9 +6152,14 @@ occaFunction inline short16  operator -  (const short16 &a, const short &b){
                       a.s13 - b,
                       a.s14 - b,
                       a.s15 - b);
+#endif
 }
 
 occaFunction inline short16& operator -= (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -5081,9 +6177,14 @@ occaFunction inline short16& operator -= (      short16 &a, const short16 &b){
   a.s14 -= b.s14;
   a.s15 -= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline short16& operator -= (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -5101,8 +6202,12 @@ occaFunction inline short16& operator -= (      short16 &a, const short &b){
   a.s14 -= b;
   a.s15 -= b;
   return a;
+#endif
 }
 occaFunction inline short16  operator *  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ * b.v_);
+#else
   return OCCA_SHORT16(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
@@ -5119,9 +6224,13 @@ occaFunction inline short16  operator *  (const short16 &a, const short16 &b){
                       a.s13 * b.s13,
                       a.s14 * b.s14,
                       a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline short16  operator *  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a * b.v_);
+#else
   return OCCA_SHORT16(a * b.x,
                       a * b.y,
                       a * b.z,
@@ -5138,9 +6247,13 @@ occaFunction inline short16  operator *  (const short &a, const short16 &b){
                       a * b.s13,
                       a * b.s14,
                       a * b.s15);
+#endif
 }
 
 occaFunction inline short16  operator *  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ * b);
+#else
   return OCCA_SHORT16(a.x * b,
                       a.y * b,
                       a.z * b,
@@ -5157,9 +6270,14 @@ occaFunction inline short16  operator *  (const short16 &a, const short &b){
                       a.s13 * b,
                       a.s14 * b,
                       a.s15 * b);
+#endif
 }
 
 occaFunction inline short16& operator *= (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -5177,9 +6295,14 @@ occaFunction inline short16& operator *= (      short16 &a, const short16 &b){
   a.s14 *= b.s14;
   a.s15 *= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline short16& operator *= (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -5197,8 +6320,12 @@ occaFunction inline short16& operator *= (      short16 &a, const short &b){
   a.s14 *= b;
   a.s15 *= b;
   return a;
+#endif
 }
 occaFunction inline short16  operator /  (const short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ / b.v_);
+#else
   return OCCA_SHORT16(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
@@ -5215,9 +6342,13 @@ occaFunction inline short16  operator /  (const short16 &a, const short16 &b){
                       a.s13 / b.s13,
                       a.s14 / b.s14,
                       a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline short16  operator /  (const short &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a / b.v_);
+#else
   return OCCA_SHORT16(a / b.x,
                       a / b.y,
                       a / b.z,
@@ -5234,9 +6365,13 @@ occaFunction inline short16  operator /  (const short &a, const short16 &b){
                       a / b.s13,
                       a / b.s14,
                       a / b.s15);
+#endif
 }
 
 occaFunction inline short16  operator /  (const short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return short16(a.v_ / b);
+#else
   return OCCA_SHORT16(a.x / b,
                       a.y / b,
                       a.z / b,
@@ -5253,9 +6388,14 @@ occaFunction inline short16  operator /  (const short16 &a, const short &b){
                       a.s13 / b,
                       a.s14 / b,
                       a.s15 / b);
+#endif
 }
 
 occaFunction inline short16& operator /= (      short16 &a, const short16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -5273,9 +6413,14 @@ occaFunction inline short16& operator /= (      short16 &a, const short16 &b){
   a.s14 /= b.s14;
   a.s15 /= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline short16& operator /= (      short16 &a, const short &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -5293,6 +6438,7 @@ occaFunction inline short16& operator /= (      short16 &a, const short &b){
   a.s14 /= b;
   a.s15 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -5328,11 +6474,29 @@ inline std::ostream& operator << (std::ostream &out, const short16& a){
 #else
 #  define OCCA_INT2 int2
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef int occaSimdInt2 __attribute__ ((vector_size(2*sizeof(int)),
+                                       aligned(OCCA_SIMD_ALIGN(2*sizeof(int)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class int2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdInt2 v_;
+
+    __extension__ struct {
+      union { int s0, x; };
+      union { int s1, y; };
+    };
+  };
+
+  explicit inline occaFunction int2(const occaSimdInt2 &v) : 
+    v_(v) {}
+#else
   union { int s0, x; };
   union { int s1, y; };
+#endif
 
   inline occaFunction int2() : 
     x(0),
@@ -5350,138 +6514,256 @@ public:
 #endif
 
 occaFunction inline int2 operator + (const int2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(+a.v_);
+#else
   return OCCA_INT2(+a.x,
                    +a.y);
+#endif
 }
 
 occaFunction inline int2 operator ++ (int2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int2 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_INT2(a.x++,
                    a.y++);
+#endif
 }
 
 occaFunction inline int2& operator ++ (int2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   return a;
+#endif
 }
 occaFunction inline int2 operator - (const int2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(-a.v_);
+#else
   return OCCA_INT2(-a.x,
                    -a.y);
+#endif
 }
 
 occaFunction inline int2 operator -- (int2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int2 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_INT2(a.x--,
                    a.y--);
+#endif
 }
 
 occaFunction inline int2& operator -- (int2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   return a;
+#endif
 }
 occaFunction inline int2  operator +  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ + b.v_);
+#else
   return OCCA_INT2(a.x + b.x,
                    a.y + b.y);
+#endif
 }
 
 occaFunction inline int2  operator +  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a + b.v_);
+#else
   return OCCA_INT2(a + b.x,
                    a + b.y);
+#endif
 }
 
 occaFunction inline int2  operator +  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ + b);
+#else
   return OCCA_INT2(a.x + b,
                    a.y + b);
+#endif
 }
 
 occaFunction inline int2& operator += (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   return a;
+#endif
 }
 
 occaFunction inline int2& operator += (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   return a;
+#endif
 }
 occaFunction inline int2  operator -  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ - b.v_);
+#else
   return OCCA_INT2(a.x - b.x,
                    a.y - b.y);
+#endif
 }
 
 occaFunction inline int2  operator -  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a - b.v_);
+#else
   return OCCA_INT2(a - b.x,
                    a - b.y);
+#endif
 }
 
 occaFunction inline int2  operator -  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ - b);
+#else
   return OCCA_INT2(a.x - b,
                    a.y - b);
+#endif
 }
 
 occaFunction inline int2& operator -= (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   return a;
+#endif
 }
 
 occaFunction inline int2& operator -= (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   return a;
+#endif
 }
 occaFunction inline int2  operator *  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ * b.v_);
+#else
   return OCCA_INT2(a.x * b.x,
                    a.y * b.y);
+#endif
 }
 
 occaFunction inline int2  operator *  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a * b.v_);
+#else
   return OCCA_INT2(a * b.x,
                    a * b.y);
+#endif
 }
 
 occaFunction inline int2  operator *  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ * b);
+#else
   return OCCA_INT2(a.x * b,
                    a.y * b);
+#endif
 }
 
 occaFunction inline int2& operator *= (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   return a;
+#endif
 }
 
 occaFunction inline int2& operator *= (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   return a;
+#endif
 }
 occaFunction inline int2  operator /  (const int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ / b.v_);
+#else
   return OCCA_INT2(a.x / b.x,
                    a.y / b.y);
+#endif
 }
 
 occaFunction inline int2  operator /  (const int &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a / b.v_);
+#else
   return OCCA_INT2(a / b.x,
                    a / b.y);
+#endif
 }
 
 occaFunction inline int2  operator /  (const int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int2(a.v_ / b);
+#else
   return OCCA_INT2(a.x / b,
                    a.y / b);
+#endif
 }
 
 occaFunction inline int2& operator /= (      int2 &a, const int2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   return a;
+#endif
 }
 
 occaFunction inline int2& operator /= (      int2 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -5503,13 +6785,33 @@ inline std::ostream& operator << (std::ostream &out, const int2& a){
 #else
 #  define OCCA_INT4 int4
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef int occaSimdInt4 __attribute__ ((vector_size(4*sizeof(int)),
+                                       aligned(OCCA_SIMD_ALIGN(4*sizeof(int)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class int4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdInt4 v_;
+
+    __extension__ struct {
+      union { int s0, x; };
+      union { int s1, y; };
+      union { int s2, z; };
+      union { int s3, w; };
+    };
+  };
+
+  explicit inline occaFunction int4(const occaSimdInt4 &v) : 
+    v_(v) {}
+#else
   union { int s0, x; };
   union { int s1, y; };
   union { int s2, z; };
   union { int s3, w; };
+#endif
 
   inline occaFunction int4() : 
     x(0),
@@ -5550,190 +6852,308 @@ public:
 #endif
 
 occaFunction inline int4 operator + (const int4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(+a.v_);
+#else
   return OCCA_INT4(+a.x,
                    +a.y,
                    +a.z,
                    +a.w);
+#endif
 }
 
 occaFunction inline int4 operator ++ (int4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int4 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_INT4(a.x++,
                    a.y++,
                    a.z++,
                    a.w++);
+#endif
 }
 
 occaFunction inline int4& operator ++ (int4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
   ++a.w;
   return a;
+#endif
 }
 occaFunction inline int4 operator - (const int4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(-a.v_);
+#else
   return OCCA_INT4(-a.x,
                    -a.y,
                    -a.z,
                    -a.w);
+#endif
 }
 
 occaFunction inline int4 operator -- (int4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int4 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_INT4(a.x--,
                    a.y--,
                    a.z--,
                    a.w--);
+#endif
 }
 
 occaFunction inline int4& operator -- (int4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
   --a.w;
   return a;
+#endif
 }
 occaFunction inline int4  operator +  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ + b.v_);
+#else
   return OCCA_INT4(a.x + b.x,
                    a.y + b.y,
                    a.z + b.z,
                    a.w + b.w);
+#endif
 }
 
 occaFunction inline int4  operator +  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a + b.v_);
+#else
   return OCCA_INT4(a + b.x,
                    a + b.y,
                    a + b.z,
                    a + b.w);
+#endif
 }
 
 occaFunction inline int4  operator +  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ + b);
+#else
   return OCCA_INT4(a.x + b,
                    a.y + b,
                    a.z + b,
                    a.w + b);
+#endif
 }
 
 occaFunction inline int4& operator += (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
   return a;
+#endif
 }
 
 occaFunction inline int4& operator += (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
   return a;
+#endif
 }
 occaFunction inline int4  operator -  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ - b.v_);
+#else
   return OCCA_INT4(a.x - b.x,
                    a.y - b.y,
                    a.z - b.z,
                    a.w - b.w);
+#endif
 }
 
 occaFunction inline int4  operator -  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a - b.v_);
+#else
   return OCCA_INT4(a - b.x,
                    a - b.y,
                    a - b.z,
                    a - b.w);
+#endif
 }
 
 occaFunction inline int4  operator -  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ - b);
+#else
   return OCCA_INT4(a.x - b,
                    a.y - b,
                    a.z - b,
                    a.w - b);
+#endif
 }
 
 occaFunction inline int4& operator -= (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
   return a;
+#endif
 }
 
 occaFunction inline int4& operator -= (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
   return a;
+#endif
 }
 occaFunction inline int4  operator *  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ * b.v_);
+#else
   return OCCA_INT4(a.x * b.x,
                    a.y * b.y,
                    a.z * b.z,
                    a.w * b.w);
+#endif
 }
 
 occaFunction inline int4  operator *  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a * b.v_);
+#else
   return OCCA_INT4(a * b.x,
                    a * b.y,
                    a * b.z,
                    a * b.w);
+#endif
 }
 
 occaFunction inline int4  operator *  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ * b);
+#else
   return OCCA_INT4(a.x * b,
                    a.y * b,
                    a.z * b,
                    a.w * b);
+#endif
 }
 
 occaFunction inline int4& operator *= (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
   return a;
+#endif
 }
 
 occaFunction inline int4& operator *= (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
   return a;
+#endif
 }
 occaFunction inline int4  operator /  (const int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ / b.v_);
+#else
   return OCCA_INT4(a.x / b.x,
                    a.y / b.y,
                    a.z / b.z,
                    a.w / b.w);
+#endif
 }
 
 occaFunction inline int4  operator /  (const int &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a / b.v_);
+#else
   return OCCA_INT4(a / b.x,
                    a / b.y,
                    a / b.z,
                    a / b.w);
+#endif
 }
 
 occaFunction inline int4  operator /  (const int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int4(a.v_ / b);
+#else
   return OCCA_INT4(a.x / b,
                    a.y / b,
                    a.z / b,
                    a.w / b);
+#endif
 }
 
 occaFunction inline int4& operator /= (      int4 &a, const int4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
   return a;
+#endif
 }
 
 occaFunction inline int4& operator /= (      int4 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -5765,8 +7185,31 @@ typedef int4 int3;
 
 //---[ int8 ]---------------------------
 #define OCCA_INT8 int8
+#if OCCA_VECTOR_EXTENSIONS
+typedef int occaSimdInt8 __attribute__ ((vector_size(8*sizeof(int)),
+                                       aligned(OCCA_SIMD_ALIGN(8*sizeof(int)))));
+#endif
 class int8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdInt8 v_;
+
+    __extension__ struct {
+      union { int s0, x; };
+      union { int s1, y; };
+      union { int s2, z; };
+      union { int s3, w; };
+      int s4;
+      int s5;
+      int s6;
+      int s7;
+    };
+  };
+
+  explicit inline occaFunction int8(const occaSimdInt8 &v) : 
+    v_(v) {}
+#else
   union { int s0, x; };
   union { int s1, y; };
   union { int s2, z; };
@@ -5775,6 +7218,7 @@ public:
   int s5;
   int s6;
   int s7;
+#endif
 
   inline occaFunction int8() : 
     x(0),
@@ -5896,6 +7340,9 @@ public:
 };
 
 occaFunction inline int8 operator + (const int8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(+a.v_);
+#else
   return OCCA_INT8(+a.x,
                    +a.y,
                    +a.z,
@@ -5904,9 +7351,15 @@ occaFunction inline int8 operator + (const int8 &a){
                    +a.s5,
                    +a.s6,
                    +a.s7);
+#endif
 }
 
 occaFunction inline int8 operator ++ (int8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int8 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_INT8(a.x++,
                    a.y++,
                    a.z++,
@@ -5915,9 +7368,14 @@ occaFunction inline int8 operator ++ (int8 &a, int){
                    a.s5++,
                    a.s6++,
                    a.s7++);
+#endif
 }
 
 occaFunction inline int8& operator ++ (int8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -5927,8 +7385,12 @@ occaFunction inline int8& operator ++ (int8 &a){
   ++a.s6;
   ++a.s7;
   return a;
+#endif
 }
 occaFunction inline int8 operator - (const int8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(-a.v_);
+#else
   return OCCA_INT8(-a.x,
                    -a.y,
                    -a.z,
@@ -5937,9 +7399,15 @@ occaFunction inline int8 operator - (const int8 &a){
                    -a.s5,
                    -a.s6,
                    -a.s7);
+#endif
 }
 
 occaFunction inline int8 operator -- (int8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int8 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_INT8(a.x--,
                    a.y--,
                    a.z--,
@@ -5948,9 +7416,14 @@ occaFunction inline int8 operator -- (int8 &a, int){
                    a.s5--,
                    a.s6--,
                    a.s7--);
+#endif
 }
 
 occaFunction inline int8& operator -- (int8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -5960,8 +7433,12 @@ occaFunction inline int8& operator -- (int8 &a){
   --a.s6;
   --a.s7;
   return a;
+#endif
 }
 occaFunction inline int8  operator +  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ + b.v_);
+#else
   return OCCA_INT8(a.x + b.x,
                    a.y + b.y,
                    a.z + b.z,
@@ -5970,9 +7447,13 @@ occaFunction inline int8  operator +  (const int8 &a, const int8 &b){
                    a.s5 + b.s5,
                    a.s6 + b.s6,
                    a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline int8  operator +  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a + b.v_);
+#else
   return OCCA_INT8(a + b.x,
                    a + b.y,
                    a + b.z,
@@ -5981,9 +7462,13 @@ occaFunction inline int8  operator +  (const int &a, const int8 &b){
                    a + b.s5,
                    a + b.s6,
                    a + b.s7);
+#endif
 }
 
 occaFunction inline int8  operator +  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ + b);
+#else
   return OCCA_INT8(a.x + b,
                    a.y + b,
                    a.z + b,
@@ -5992,9 +7477,14 @@ occaFunction inline int8  operator +  (const int8 &a, const int &b){
                    a.s5 + b,
                    a.s6 + b,
                    a.s7 + b);
+#endif
 }
 
 occaFunction inline int8& operator += (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -6004,9 +7494,14 @@ occaFunction inline int8& operator += (      int8 &a, const int8 &b){
   a.s6 += b.s6;
   a.s7 += b.s7;
   return a;
+#endif
 }
 
 occaFunction inline int8& operator += (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -6016,8 +7511,12 @@ occaFunction inline int8& operator += (      int8 &a, const int &b){
   a.s6 += b;
   a.s7 += b;
   return a;
+#endif
 }
 occaFunction inline int8  operator -  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ - b.v_);
+#else
   return OCCA_INT8(a.x - b.x,
                    a.y - b.y,
                    a.z - b.z,
@@ -6026,9 +7525,13 @@ occaFunction inline int8  operator -  (const int8 &a, const int8 &b){
                    a.s5 - b.s5,
                    a.s6 - b.s6,
                    a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline int8  operator -  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a - b.v_);
+#else
   return OCCA_INT8(a - b.x,
                    a - b.y,
                    a - b.z,
@@ -6037,9 +7540,13 @@ occaFunction inline int8  operator -  (const int &a, const int8 &b){
                    a - b.s5,
                    a - b.s6,
                    a - b.s7);
+#endif
 }
 
 occaFunction inline int8  operator -  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ - b);
+#else
   return OCCA_INT8(a.x - b,
                    a.y - b,
                    a.z - b,
@@ -6048,9 +7555,14 @@ occaFunction inline int8  operator -  (const int8 &a, const int &b){
                    a.s5 - b,
                    a.s6 - b,
                    a.s7 - b);
+#endif
 }
 
 occaFunction inline int8& operator -= (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -6060,9 +7572,14 @@ occaFunction inline int8& operator -= (      int8 &a, const int8 &b){
   a.s6 -= b.s6;
   a.s7 -= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline int8& operator -= (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -6072,8 +7589,12 @@ occaFunction inline int8& operator -= (      int8 &a, const int &b){
   a.s6 -= b;
   a.s7 -= b;
   return a;
+#endif
 }
 occaFunction inline int8  operator *  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ * b.v_);
+#else
   return OCCA_INT8(a.x * b.x,
                    a.y * b.y,
                    a.z * b.z,
@@ -6082,9 +7603,13 @@ occaFunction inline int8  operator *  (const int8 &a, const int8 &b){
                    a.s5 * b.s5,
                    a.s6 * b.s6,
                    a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline int8  operator *  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a * b.v_);
+#else
   return OCCA_INT8(a * b.x,
                    a * b.y,
                    a * b.z,
@@ -6093,9 +7618,13 @@ occaFunction inline int8  operator *  (const int &a, const int8 &b){
                    a * b.s5,
                    a * b.s6,
                    a * b.s7);
+#endif
 }
 
 occaFunction inline int8  operator *  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ * b);
+#else
   return OCCA_INT8(a.x * b,
                    a.y * b,
                    a.z * b,
@@ -6104,9 +7633,14 @@ occaFunction inline int8  operator *  (const int8 &a, const int &b){
                    a.s5 * b,
                    a.s6 * b,
                    a.s7 * b);
+#endif
 }
 
 occaFunction inline int8& operator *= (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -6116,9 +7650,14 @@ occaFunction inline int8& operator *= (      int8 &a, const int8 &b){
   a.s6 *= b.s6;
   a.s7 *= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline int8& operator *= (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -6128,8 +7667,12 @@ occaFunction inline int8& operator *= (      int8 &a, const int &b){
   a.s6 *= b;
   a.s7 *= b;
   return a;
+#endif
 }
 occaFunction inline int8  operator /  (const int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ / b.v_);
+#else
   return OCCA_INT8(a.x / b.x,
                    a.y / b.y,
                    a.z / b.z,
@@ -6138,9 +7681,13 @@ occaFunction inline int8  operator /  (const int8 &a, const int8 &b){
                    a.s5 / b.s5,
                    a.s6 / b.s6,
                    a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline int8  operator /  (const int &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a / b.v_);
+#else
   return OCCA_INT8(a / b.x,
                    a / b.y,
                    a / b.z,
@@ -6149,9 +7696,13 @@ occaFunction inline int8  operator /  (const int &a, const int8 &b){
                    a / b.s5,
                    a / b.s6,
                    a / b.s7);
+#endif
 }
 
 occaFunction inline int8  operator /  (const int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int8(a.v_ / b);
+#else
   return OCCA_INT8(a.x / b,
                    a.y / b,
                    a.z / b,
@@ -6160,9 +7711,14 @@ occaFunction inline int8  operator /  (const int8 &a, const int &b){
                    a.s5 / b,
                    a.s6 / b,
                    a.s7 / b);
+#endif
 }
 
 occaFunction inline int8& operator /= (      int8 &a, const int8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -6172,9 +7728,14 @@ occaFunction inline int8& operator /= (      int8 &a, const int8 &b){
   a.s6 /= b.s6;
   a.s7 /= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline int8& operator /= (      int8 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -6184,6 +7745,7 @@ occaFunction inline int8& operator /= (      int8 &a, const int &b){
   a.s6 /= b;
   a.s7 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -6207,8 +7769,39 @@ inline std::ostream& operator << (std::ostream &out, const int8& a){
 
 //---[ int16 ]--------------------------
 #define OCCA_INT16 int16
+#if OCCA_VECTOR_EXTENSIONS
+typedef int occaSimdInt16 __attribute__ ((vector_size(16*sizeof(int)),
+                                        aligned(OCCA_SIMD_ALIGN(16*sizeof(int)))));
+#endif
 class int16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdInt16 v_;
+
+    __extension__ struct {
+      union { int s0, x; };
+      union { int s1, y; };
+      union { int s2, z; };
+      union { int s3, w; };
+      int s4;
+      int s5;
+      int s6;
+      int s7;
+      int s8;
+      int s9;
+      int s10;
+      int s11;
+      int s12;
+      int s13;
+      int s14;
+      int s15;
+    };
+  };
+
+  explicit inline occaFunction int16(const occaSimdInt16 &v) : 
+    v_(v) {}
+#else
   union { int s0, x; };
   union { int s1, y; };
   union { int s2, z; };
@@ -6225,6 +7818,7 @@ public:
   int s13;
   int s14;
   int s15;
+#endif
 
   inline occaFunction int16() : 
     x(0),
@@ -6654,6 +8248,9 @@ public:
 };
 
 occaFunction inline int16 operator + (const int16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(+a.v_);
+#else
   return OCCA_INT16(+a.x,
                     +a.y,
                     +a.z,
@@ -6670,9 +8267,15 @@ occaFunction inline int16 operator + (const int16 &a){
                     +a.s13,
                     +a.s14,
                     +a.s15);
+#endif
 }
 
 occaFunction inline int16 operator ++ (int16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int16 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_INT16(a.x++,
                     a.y++,
                     a.z++,
@@ -6689,9 +8292,14 @@ occaFunction inline int16 operator ++ (int16 &a, int){
                     a.s13++,
                     a.s14++,
                     a.s15++);
+#endif
 }
 
 occaFunction inline int16& operator ++ (int16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -6709,8 +8317,12 @@ occaFunction inline int16& operator ++ (int16 &a){
   ++a.s14;
   ++a.s15;
   return a;
+#endif
 }
 occaFunction inline int16 operator - (const int16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(-a.v_);
+#else
   return OCCA_INT16(-a.x,
                     -a.y,
                     -a.z,
@@ -6727,9 +8339,15 @@ occaFunction inline int16 operator - (const int16 &a){
                     -a.s13,
                     -a.s14,
                     -a.s15);
+#endif
 }
 
 occaFunction inline int16 operator -- (int16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const int16 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_INT16(a.x--,
                     a.y--,
                     a.z--,
@@ -6746,9 +8364,14 @@ occaFunction inline int16 operator -- (int16 &a, int){
                     a.s13--,
                     a.s14--,
                     a.s15--);
+#endif
 }
 
 occaFunction inline int16& operator -- (int16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -6766,8 +8389,12 @@ occaFunction inline int16& operator -- (int16 &a){
   --a.s14;
   --a.s15;
   return a;
+#endif
 }
 occaFunction inline int16  operator +  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ + b.v_);
+#else
   return OCCA_INT16(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
@@ -6784,9 +8411,13 @@ occaFunction inline int16  operator +  (const int16 &a, const int16 &b){
                     a.s13 + b.s13,
                     a.s14 + b.s14,
                     a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline int16  operator +  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a + b.v_);
+#else
   return OCCA_INT16(a + b.x,
                     a + b.y,
                     a + b.z,
@@ -6803,9 +8434,13 @@ occaFunction inline int16  operator +  (const int &a, const int16 &b){
                     a + b.s13,
                     a + b.s14,
                     a + b.s15);
+#endif
 }
 
 occaFunction inline int16  operator +  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ + b);
+#else
   return OCCA_INT16(a.x + b,
                     a.y + b,
                     a.z + b,
@@ -6822,9 +8457,14 @@ occaFunction inline int16  operator +  (const int16 &a, const int &b){
                     a.s13 + b,
                     a.s14 + b,
                     a.s15 + b);
+#endif
 }
 
 occaFunction inline int16& operator += (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -6842,9 +8482,14 @@ occaFunction inline int16& operator += (      int16 &a, const int16 &b){
   a.s14 += b.s14;
   a.s15 += b.s15;
   return a;
+#endif
 }
 
 occaFunction inline int16& operator += (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -6862,8 +8507,12 @@ occaFunction inline int16& operator += (      int16 &a, const int &b){
   a.s14 += b;
   a.s15 += b;
   return a;
+#endif
 }
 occaFunction inline int16  operator -  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ - b.v_);
+#else
   return OCCA_INT16(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
@@ -6880,9 +8529,13 @@ occaFunction inline int16  operator -  (const int16 &a, const int16 &b){
                     a.s13 - b.s13,
                     a.s14 - b.s14,
                     a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline int16  operator -  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a - b.v_);
+#else
   return OCCA_INT16(a - b.x,
                     a - b.y,
                     a - b.z,
@@ -6899,9 +8552,13 @@ occaFunction inline int16  operator -  (const int &a, const int16 &b){
                     a - b.s13,
                     a - b.s14,
                     a - b.s15);
+#endif
 }
 
 occaFunction inline int16  operator -  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ - b);
+#else
   return OCCA_INT16(a.x - b,
                     a.y - b,
                     a.z - b,
@@ -6918,9 +8575,14 @@ occaFunction inline int16  operator -  (const int16 &a, const int &b){
                     a.s13 - b,
                     a.s14 - b,
                     a.s15 - b);
+#endif
 }
 
 occaFunction inline int16& operator -= (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -6938,9 +8600,14 @@ occaFunction inline int16& operator -= (      int16 &a, const int16 &b){
   a.s14 -= b.s14;
   a.s15 -= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline int16& operator -= (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -6958,8 +8625,12 @@ occaFunction inline int16& operator -= (      int16 &a, const int &b){
   a.s14 -= b;
   a.s15 -= b;
   return a;
+#endif
 }
 occaFunction inline int16  operator *  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ * b.v_);
+#else
   return OCCA_INT16(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
@@ -6976,9 +8647,13 @@ occaFunction inline int16  operator *  (const int16 &a, const int16 &b){
                     a.s13 * b.s13,
                     a.s14 * b.s14,
                     a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline int16  operator *  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a * b.v_);
+#else
   return OCCA_INT16(a * b.x,
                     a * b.y,
                     a * b.z,
@@ -6995,9 +8670,13 @@ occaFunction inline int16  operator *  (const int &a, const int16 &b){
                     a * b.s13,
                     a * b.s14,
                     a * b.s15);
+#endif
 }
 
 occaFunction inline int16  operator *  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ * b);
+#else
   return OCCA_INT16(a.x * b,
                     a.y * b,
                     a.z * b,
@@ -7014,9 +8693,14 @@ occaFunction inline int16  operator *  (const int16 &a, const int &b){
                     a.s13 * b,
                     a.s14 * b,
                     a.s15 * b);
+#endif
 }
 
 occaFunction inline int16& operator *= (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -7034,9 +8718,14 @@ occaFunction inline int16& operator *= (      int16 &a, const int16 &b){
   a.s14 *= b.s14;
   a.s15 *= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline int16& operator *= (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -7054,8 +8743,12 @@ occaFunction inline int16& operator *= (      int16 &a, const int &b){
   a.s14 *= b;
   a.s15 *= b;
   return a;
+#endif
 }
 occaFunction inline int16  operator /  (const int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ / b.v_);
+#else
   return OCCA_INT16(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
@@ -7072,9 +8765,13 @@ occaFunction inline int16  operator /  (const int16 &a, const int16 &b){
                     a.s13 / b.s13,
                     a.s14 / b.s14,
                     a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline int16  operator /  (const int &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a / b.v_);
+#else
   return OCCA_INT16(a / b.x,
                     a / b.y,
                     a / b.z,
@@ -7091,9 +8788,13 @@ occaFunction inline int16  operator /  (const int &a, const int16 &b){
                     a / b.s13,
                     a / b.s14,
                     a / b.s15);
+#endif
 }
 
 occaFunction inline int16  operator /  (const int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return int16(a.v_ / b);
+#else
   return OCCA_INT16(a.x / b,
                     a.y / b,
                     a.z / b,
@@ -7110,9 +8811,14 @@ occaFunction inline int16  operator /  (const int16 &a, const int &b){
                     a.s13 / b,
                     a.s14 / b,
                     a.s15 / b);
+#endif
 }
 
 occaFunction inline int16& operator /= (      int16 &a, const int16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -7130,9 +8836,14 @@ occaFunction inline int16& operator /= (      int16 &a, const int16 &b){
   a.s14 /= b.s14;
   a.s15 /= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline int16& operator /= (      int16 &a, const int &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -7150,6 +8861,7 @@ occaFunction inline int16& operator /= (      int16 &a, const int &b){
   a.s14 /= b;
   a.s15 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -7185,11 +8897,29 @@ inline std::ostream& operator << (std::ostream &out, const int16& a){
 #else
 #  define OCCA_LONG2 long2
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef long occaSimdLong2 __attribute__ ((vector_size(2*sizeof(long)),
+                                         aligned(OCCA_SIMD_ALIGN(2*sizeof(long)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class long2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdLong2 v_;
+
+    __extension__ struct {
+      union { long s0, x; };
+      union { long s1, y; };
+    };
+  };
+
+  explicit inline occaFunction long2(const occaSimdLong2 &v) : 
+    v_(v) {}
+#else
   union { long s0, x; };
   union { long s1, y; };
+#endif
 
   inline occaFunction long2() : 
     x(0),
@@ -7207,138 +8937,256 @@ public:
 #endif
 
 occaFunction inline long2 operator + (const long2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(+a.v_);
+#else
   return OCCA_LONG2(+a.x,
                     +a.y);
+#endif
 }
 
 occaFunction inline long2 operator ++ (long2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long2 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_LONG2(a.x++,
                     a.y++);
+#endif
 }
 
 occaFunction inline long2& operator ++ (long2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   return a;
+#endif
 }
 occaFunction inline long2 operator - (const long2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(-a.v_);
+#else
   return OCCA_LONG2(-a.x,
                     -a.y);
+#endif
 }
 
 occaFunction inline long2 operator -- (long2 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long2 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_LONG2(a.x--,
                     a.y--);
+#endif
 }
 
 occaFunction inline long2& operator -- (long2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   return a;
+#endif
 }
 occaFunction inline long2  operator +  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ + b.v_);
+#else
   return OCCA_LONG2(a.x + b.x,
                     a.y + b.y);
+#endif
 }
 
 occaFunction inline long2  operator +  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a + b.v_);
+#else
   return OCCA_LONG2(a + b.x,
                     a + b.y);
+#endif
 }
 
 occaFunction inline long2  operator +  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ + b);
+#else
   return OCCA_LONG2(a.x + b,
                     a.y + b);
+#endif
 }
 
 occaFunction inline long2& operator += (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   return a;
+#endif
 }
 
 occaFunction inline long2& operator += (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   return a;
+#endif
 }
 occaFunction inline long2  operator -  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ - b.v_);
+#else
   return OCCA_LONG2(a.x - b.x,
                     a.y - b.y);
+#endif
 }
 
 occaFunction inline long2  operator -  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a - b.v_);
+#else
   return OCCA_LONG2(a - b.x,
                     a - b.y);
+#endif
 }
 
 occaFunction inline long2  operator -  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ - b);
+#else
   return OCCA_LONG2(a.x - b,
                     a.y - b);
+#endif
 }
 
 occaFunction inline long2& operator -= (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   return a;
+#endif
 }
 
 occaFunction inline long2& operator -= (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   return a;
+#endif
 }
 occaFunction inline long2  operator *  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ * b.v_);
+#else
   return OCCA_LONG2(a.x * b.x,
                     a.y * b.y);
+#endif
 }
 
 occaFunction inline long2  operator *  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a * b.v_);
+#else
   return OCCA_LONG2(a * b.x,
                     a * b.y);
+#endif
 }
 
 occaFunction inline long2  operator *  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ * b);
+#else
   return OCCA_LONG2(a.x * b,
                     a.y * b);
+#endif
 }
 
 occaFunction inline long2& operator *= (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   return a;
+#endif
 }
 
 occaFunction inline long2& operator *= (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   return a;
+#endif
 }
 occaFunction inline long2  operator /  (const long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ / b.v_);
+#else
   return OCCA_LONG2(a.x / b.x,
                     a.y / b.y);
+#endif
 }
 
 occaFunction inline long2  operator /  (const long &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a / b.v_);
+#else
   return OCCA_LONG2(a / b.x,
                     a / b.y);
+#endif
 }
 
 occaFunction inline long2  operator /  (const long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long2(a.v_ / b);
+#else
   return OCCA_LONG2(a.x / b,
                     a.y / b);
+#endif
 }
 
 occaFunction inline long2& operator /= (      long2 &a, const long2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   return a;
+#endif
 }
 
 occaFunction inline long2& operator /= (      long2 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -7360,13 +9208,33 @@ inline std::ostream& operator << (std::ostream &out, const long2& a){
 #else
 #  define OCCA_LONG4 long4
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef long occaSimdLong4 __attribute__ ((vector_size(4*sizeof(long)),
+                                         aligned(OCCA_SIMD_ALIGN(4*sizeof(long)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class long4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdLong4 v_;
+
+    __extension__ struct {
+      union { long s0, x; };
+      union { long s1, y; };
+      union { long s2, z; };
+      union { long s3, w; };
+    };
+  };
+
+  explicit inline occaFunction long4(const occaSimdLong4 &v) : 
+    v_(v) {}
+#else
   union { long s0, x; };
   union { long s1, y; };
   union { long s2, z; };
   union { long s3, w; };
+#endif
 
   inline occaFunction long4() : 
     x(0),
@@ -7407,190 +9275,308 @@ public:
 #endif
 
 occaFunction inline long4 operator + (const long4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(+a.v_);
+#else
   return OCCA_LONG4(+a.x,
                     +a.y,
                     +a.z,
                     +a.w);
+#endif
 }
 
 occaFunction inline long4 operator ++ (long4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long4 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_LONG4(a.x++,
                     a.y++,
                     a.z++,
                     a.w++);
+#endif
 }
 
 occaFunction inline long4& operator ++ (long4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
   ++a.w;
   return a;
+#endif
 }
 occaFunction inline long4 operator - (const long4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(-a.v_);
+#else
   return OCCA_LONG4(-a.x,
                     -a.y,
                     -a.z,
                     -a.w);
+#endif
 }
 
 occaFunction inline long4 operator -- (long4 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long4 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_LONG4(a.x--,
                     a.y--,
                     a.z--,
                     a.w--);
+#endif
 }
 
 occaFunction inline long4& operator -- (long4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
   --a.w;
   return a;
+#endif
 }
 occaFunction inline long4  operator +  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ + b.v_);
+#else
   return OCCA_LONG4(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
                     a.w + b.w);
+#endif
 }
 
 occaFunction inline long4  operator +  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a + b.v_);
+#else
   return OCCA_LONG4(a + b.x,
                     a + b.y,
                     a + b.z,
                     a + b.w);
+#endif
 }
 
 occaFunction inline long4  operator +  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ + b);
+#else
   return OCCA_LONG4(a.x + b,
                     a.y + b,
                     a.z + b,
                     a.w + b);
+#endif
 }
 
 occaFunction inline long4& operator += (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
   return a;
+#endif
 }
 
 occaFunction inline long4& operator += (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
   return a;
+#endif
 }
 occaFunction inline long4  operator -  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ - b.v_);
+#else
   return OCCA_LONG4(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
                     a.w - b.w);
+#endif
 }
 
 occaFunction inline long4  operator -  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a - b.v_);
+#else
   return OCCA_LONG4(a - b.x,
                     a - b.y,
                     a - b.z,
                     a - b.w);
+#endif
 }
 
 occaFunction inline long4  operator -  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ - b);
+#else
   return OCCA_LONG4(a.x - b,
                     a.y - b,
                     a.z - b,
                     a.w - b);
+#endif
 }
 
 occaFunction inline long4& operator -= (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
   return a;
+#endif
 }
 
 occaFunction inline long4& operator -= (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
   return a;
+#endif
 }
 occaFunction inline long4  operator *  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ * b.v_);
+#else
   return OCCA_LONG4(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
                     a.w * b.w);
+#endif
 }
 
 occaFunction inline long4  operator *  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a * b.v_);
+#else
   return OCCA_LONG4(a * b.x,
                     a * b.y,
                     a * b.z,
                     a * b.w);
+#endif
 }
 
 occaFunction inline long4  operator *  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ * b);
+#else
   return OCCA_LONG4(a.x * b,
                     a.y * b,
                     a.z * b,
                     a.w * b);
+#endif
 }
 
 occaFunction inline long4& operator *= (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
   return a;
+#endif
 }
 
 occaFunction inline long4& operator *= (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
   return a;
+#endif
 }
 occaFunction inline long4  operator /  (const long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ / b.v_);
+#else
   return OCCA_LONG4(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
                     a.w / b.w);
+#endif
 }
 
 occaFunction inline long4  operator /  (const long &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a / b.v_);
+#else
   return OCCA_LONG4(a / b.x,
                     a / b.y,
                     a / b.z,
                     a / b.w);
+#endif
 }
 
 occaFunction inline long4  operator /  (const long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long4(a.v_ / b);
+#else
   return OCCA_LONG4(a.x / b,
                     a.y / b,
                     a.z / b,
                     a.w / b);
+#endif
 }
 
 occaFunction inline long4& operator /= (      long4 &a, const long4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
   return a;
+#endif
 }
 
 occaFunction inline long4& operator /= (      long4 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -7622,8 +9608,31 @@ typedef long4 long3;
 
 //---[ long8 ]--------------------------
 #define OCCA_LONG8 long8
+#if OCCA_VECTOR_EXTENSIONS
+typedef long occaSimdLong8 __attribute__ ((vector_size(8*sizeof(long)),
+                                         aligned(OCCA_SIMD_ALIGN(8*sizeof(long)))));
+#endif
 class long8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdLong8 v_;
+
+    __extension__ struct {
+      union { long s0, x; };
+      union { long s1, y; };
+      union { long s2, z; };
+      union { long s3, w; };
+      long s4;
+      long s5;
+      long s6;
+      long s7;
+    };
+  };
+
+  explicit inline occaFunction long8(const occaSimdLong8 &v) : 
+    v_(v) {}
+#else
   union { long s0, x; };
   union { long s1, y; };
   union { long s2, z; };
@@ -7632,6 +9641,7 @@ public:
   long s5;
   long s6;
   long s7;
+#endif
 
   inline occaFunction long8() : 
     x(0),
@@ -7753,6 +9763,9 @@ public:
 };
 
 occaFunction inline long8 operator + (const long8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(+a.v_);
+#else
   return OCCA_LONG8(+a.x,
                     +a.y,
                     +a.z,
@@ -7761,9 +9774,15 @@ occaFunction inline long8 operator + (const long8 &a){
                     +a.s5,
                     +a.s6,
                     +a.s7);
+#endif
 }
 
 occaFunction inline long8 operator ++ (long8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long8 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_LONG8(a.x++,
                     a.y++,
                     a.z++,
@@ -7772,9 +9791,14 @@ occaFunction inline long8 operator ++ (long8 &a, int){
                     a.s5++,
                     a.s6++,
                     a.s7++);
+#endif
 }
 
 occaFunction inline long8& operator ++ (long8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -7784,8 +9808,12 @@ occaFunction inline long8& operator ++ (long8 &a){
   ++a.s6;
   ++a.s7;
   return a;
+#endif
 }
 occaFunction inline long8 operator - (const long8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(-a.v_);
+#else
   return OCCA_LONG8(-a.x,
                     -a.y,
                     -a.z,
@@ -7794,9 +9822,15 @@ occaFunction inline long8 operator - (const long8 &a){
                     -a.s5,
                     -a.s6,
                     -a.s7);
+#endif
 }
 
 occaFunction inline long8 operator -- (long8 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long8 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_LONG8(a.x--,
                     a.y--,
                     a.z--,
@@ -7805,9 +9839,14 @@ occaFunction inline long8 operator -- (long8 &a, int){
                     a.s5--,
                     a.s6--,
                     a.s7--);
+#endif
 }
 
 occaFunction inline long8& operator -- (long8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -7817,8 +9856,12 @@ occaFunction inline long8& operator -- (long8 &a){
   --a.s6;
   --a.s7;
   return a;
+#endif
 }
 occaFunction inline long8  operator +  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ + b.v_);
+#else
   return OCCA_LONG8(a.x + b.x,
                     a.y + b.y,
                     a.z + b.z,
@@ -7827,9 +9870,13 @@ occaFunction inline long8  operator +  (const long8 &a, const long8 &b){
                     a.s5 + b.s5,
                     a.s6 + b.s6,
                     a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline long8  operator +  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a + b.v_);
+#else
   return OCCA_LONG8(a + b.x,
                     a + b.y,
                     a + b.z,
@@ -7838,9 +9885,13 @@ occaFunction inline long8  operator +  (const long &a, const long8 &b){
                     a + b.s5,
                     a + b.s6,
                     a + b.s7);
+#endif
 }
 
 occaFunction inline long8  operator +  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ + b);
+#else
   return OCCA_LONG8(a.x + b,
                     a.y + b,
                     a.z + b,
@@ -7849,9 +9900,14 @@ occaFunction inline long8  operator +  (const long8 &a, const long &b){
                     a.s5 + b,
                     a.s6 + b,
                     a.s7 + b);
+#endif
 }
 
 occaFunction inline long8& operator += (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -7861,9 +9917,14 @@ occaFunction inline long8& operator += (      long8 &a, const long8 &b){
   a.s6 += b.s6;
   a.s7 += b.s7;
   return a;
+#endif
 }
 
 occaFunction inline long8& operator += (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -7873,8 +9934,12 @@ occaFunction inline long8& operator += (      long8 &a, const long &b){
   a.s6 += b;
   a.s7 += b;
   return a;
+#endif
 }
 occaFunction inline long8  operator -  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ - b.v_);
+#else
   return OCCA_LONG8(a.x - b.x,
                     a.y - b.y,
                     a.z - b.z,
@@ -7883,9 +9948,13 @@ occaFunction inline long8  operator -  (const long8 &a, const long8 &b){
                     a.s5 - b.s5,
                     a.s6 - b.s6,
                     a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline long8  operator -  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a - b.v_);
+#else
   return OCCA_LONG8(a - b.x,
                     a - b.y,
                     a - b.z,
@@ -7894,9 +9963,13 @@ occaFunction inline long8  operator -  (const long &a, const long8 &b){
                     a - b.s5,
                     a - b.s6,
                     a - b.s7);
+#endif
 }
 
 occaFunction inline long8  operator -  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ - b);
+#else
   return OCCA_LONG8(a.x - b,
                     a.y - b,
                     a.z - b,
@@ -7905,9 +9978,14 @@ occaFunction inline long8  operator -  (const long8 &a, const long &b){
                     a.s5 - b,
                     a.s6 - b,
                     a.s7 - b);
+#endif
 }
 
 occaFunction inline long8& operator -= (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -7917,9 +9995,14 @@ occaFunction inline long8& operator -= (      long8 &a, const long8 &b){
   a.s6 -= b.s6;
   a.s7 -= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline long8& operator -= (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -7929,8 +10012,12 @@ occaFunction inline long8& operator -= (      long8 &a, const long &b){
   a.s6 -= b;
   a.s7 -= b;
   return a;
+#endif
 }
 occaFunction inline long8  operator *  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ * b.v_);
+#else
   return OCCA_LONG8(a.x * b.x,
                     a.y * b.y,
                     a.z * b.z,
@@ -7939,9 +10026,13 @@ occaFunction inline long8  operator *  (const long8 &a, const long8 &b){
                     a.s5 * b.s5,
                     a.s6 * b.s6,
                     a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline long8  operator *  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a * b.v_);
+#else
   return OCCA_LONG8(a * b.x,
                     a * b.y,
                     a * b.z,
@@ -7950,9 +10041,13 @@ occaFunction inline long8  operator *  (const long &a, const long8 &b){
                     a * b.s5,
                     a * b.s6,
                     a * b.s7);
+#endif
 }
 
 occaFunction inline long8  operator *  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ * b);
+#else
   return OCCA_LONG8(a.x * b,
                     a.y * b,
                     a.z * b,
@@ -7961,9 +10056,14 @@ occaFunction inline long8  operator *  (const long8 &a, const long &b){
                     a.s5 * b,
                     a.s6 * b,
                     a.s7 * b);
+#endif
 }
 
 occaFunction inline long8& operator *= (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -7973,9 +10073,14 @@ occaFunction inline long8& operator *= (      long8 &a, const long8 &b){
   a.s6 *= b.s6;
   a.s7 *= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline long8& operator *= (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -7985,8 +10090,12 @@ occaFunction inline long8& operator *= (      long8 &a, const long &b){
   a.s6 *= b;
   a.s7 *= b;
   return a;
+#endif
 }
 occaFunction inline long8  operator /  (const long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ / b.v_);
+#else
   return OCCA_LONG8(a.x / b.x,
                     a.y / b.y,
                     a.z / b.z,
@@ -7995,9 +10104,13 @@ occaFunction inline long8  operator /  (const long8 &a, const long8 &b){
                     a.s5 / b.s5,
                     a.s6 / b.s6,
                     a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline long8  operator /  (const long &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a / b.v_);
+#else
   return OCCA_LONG8(a / b.x,
                     a / b.y,
                     a / b.z,
@@ -8006,9 +10119,13 @@ occaFunction inline long8  operator /  (const long &a, const long8 &b){
                     a / b.s5,
                     a / b.s6,
                     a / b.s7);
+#endif
 }
 
 occaFunction inline long8  operator /  (const long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long8(a.v_ / b);
+#else
   return OCCA_LONG8(a.x / b,
                     a.y / b,
                     a.z / b,
@@ -8017,9 +10134,14 @@ occaFunction inline long8  operator /  (const long8 &a, const long &b){
                     a.s5 / b,
                     a.s6 / b,
                     a.s7 / b);
+#endif
 }
 
 occaFunction inline long8& operator /= (      long8 &a, const long8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -8029,9 +10151,14 @@ occaFunction inline long8& operator /= (      long8 &a, const long8 &b){
   a.s6 /= b.s6;
   a.s7 /= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline long8& operator /= (      long8 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -8041,6 +10168,7 @@ occaFunction inline long8& operator /= (      long8 &a, const long &b){
   a.s6 /= b;
   a.s7 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -8064,8 +10192,39 @@ inline std::ostream& operator << (std::ostream &out, const long8& a){
 
 //---[ long16 ]-------------------------
 #define OCCA_LONG16 long16
+#if OCCA_VECTOR_EXTENSIONS
+typedef long occaSimdLong16 __attribute__ ((vector_size(16*sizeof(long)),
+                                          aligned(OCCA_SIMD_ALIGN(16*sizeof(long)))));
+#endif
 class long16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdLong16 v_;
+
+    __extension__ struct {
+      union { long s0, x; };
+      union { long s1, y; };
+      union { long s2, z; };
+      union { long s3, w; };
+      long s4;
+      long s5;
+      long s6;
+      long s7;
+      long s8;
+      long s9;
+      long s10;
+      long s11;
+      long s12;
+      long s13;
+      long s14;
+      long s15;
+    };
+  };
+
+  explicit inline occaFunction long16(const occaSimdLong16 &v) : 
+    v_(v) {}
+#else
   union { long s0, x; };
   union { long s1, y; };
   union { long s2, z; };
@@ -8082,6 +10241,7 @@ public:
   long s13;
   long s14;
   long s15;
+#endif
 
   inline occaFunction long16() : 
     x(0),
@@ -8511,6 +10671,9 @@ public:
 };
 
 occaFunction inline long16 operator + (const long16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(+a.v_);
+#else
   return OCCA_LONG16(+a.x,
                      +a.y,
                      +a.z,
@@ -8527,9 +10690,15 @@ occaFunction inline long16 operator + (const long16 &a){
                      +a.s13,
                      +a.s14,
                      +a.s15);
+#endif
 }
 
 occaFunction inline long16 operator ++ (long16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long16 ret(a.v_);
+  a.v_ += 1;
+  return ret;
+#else
   return OCCA_LONG16(a.x++,
                      a.y++,
                      a.z++,
@@ -8546,9 +10715,14 @@ occaFunction inline long16 operator ++ (long16 &a, int){
                      a.s13++,
                      a.s14++,
                      a.s15++);
+#endif
 }
 
 occaFunction inline long16& operator ++ (long16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += 1;
+  return a;
+#else
   ++a.x;
   ++a.y;
   ++a.z;
@@ -8566,8 +10740,12 @@ occaFunction inline long16& operator ++ (long16 &a){
   ++a.s14;
   ++a.s15;
   return a;
+#endif
 }
 occaFunction inline long16 operator - (const long16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(-a.v_);
+#else
   return OCCA_LONG16(-a.x,
                      -a.y,
                      -a.z,
@@ -8584,9 +10762,15 @@ occaFunction inline long16 operator - (const long16 &a){
                      -a.s13,
                      -a.s14,
                      -a.s15);
+#endif
 }
 
 occaFunction inline long16 operator -- (long16 &a, int){
+#if OCCA_VECTOR_EXTENSIONS
+  const long16 ret(a.v_);
+  a.v_ -= 1;
+  return ret;
+#else
   return OCCA_LONG16(a.x--,
                      a.y--,
                      a.z--,
@@ -8603,9 +10787,14 @@ occaFunction inline long16 operator -- (long16 &a, int){
                      a.s13--,
                      a.s14--,
                      a.s15--);
+#endif
 }
 
 occaFunction inline long16& operator -- (long16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= 1;
+  return a;
+#else
   --a.x;
   --a.y;
   --a.z;
@@ -8623,8 +10812,12 @@ occaFunction inline long16& operator -- (long16 &a){
   --a.s14;
   --a.s15;
   return a;
+#endif
 }
 occaFunction inline long16  operator +  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ + b.v_);
+#else
   return OCCA_LONG16(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -8641,9 +10834,13 @@ occaFunction inline long16  operator +  (const long16 &a, const long16 &b){
                      a.s13 + b.s13,
                      a.s14 + b.s14,
                      a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline long16  operator +  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a + b.v_);
+#else
   return OCCA_LONG16(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -8660,9 +10857,13 @@ occaFunction inline long16  operator +  (const long &a, const long16 &b){
                      a + b.s13,
                      a + b.s14,
                      a + b.s15);
+#endif
 }
 
 occaFunction inline long16  operator +  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ + b);
+#else
   return OCCA_LONG16(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -8679,9 +10880,14 @@ occaFunction inline long16  operator +  (const long16 &a, const long &b){
                      a.s13 + b,
                      a.s14 + b,
                      a.s15 + b);
+#endif
 }
 
 occaFunction inline long16& operator += (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -8699,9 +10905,14 @@ occaFunction inline long16& operator += (      long16 &a, const long16 &b){
   a.s14 += b.s14;
   a.s15 += b.s15;
   return a;
+#endif
 }
 
 occaFunction inline long16& operator += (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -8719,8 +10930,12 @@ occaFunction inline long16& operator += (      long16 &a, const long &b){
   a.s14 += b;
   a.s15 += b;
   return a;
+#endif
 }
 occaFunction inline long16  operator -  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ - b.v_);
+#else
   return OCCA_LONG16(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -8737,9 +10952,13 @@ occaFunction inline long16  operator -  (const long16 &a, const long16 &b){
                      a.s13 - b.s13,
                      a.s14 - b.s14,
                      a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline long16  operator -  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a - b.v_);
+#else
   return OCCA_LONG16(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -8756,9 +10975,13 @@ occaFunction inline long16  operator -  (const long &a, const long16 &b){
                      a - b.s13,
                      a - b.s14,
                      a - b.s15);
+#endif
 }
 
 occaFunction inline long16  operator -  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ - b);
+#else
   return OCCA_LONG16(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -8775,9 +10998,14 @@ occaFunction inline long16  operator -  (const long16 &a, const long &b){
                      a.s13 - b,
                      a.s14 - b,
                      a.s15 - b);
+#endif
 }
 
 occaFunction inline long16& operator -= (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -8795,9 +11023,14 @@ occaFunction inline long16& operator -= (      long16 &a, const long16 &b){
   a.s14 -= b.s14;
   a.s15 -= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline long16& operator -= (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -8815,8 +11048,12 @@ occaFunction inline long16& operator -= (      long16 &a, const long &b){
   a.s14 -= b;
   a.s15 -= b;
   return a;
+#endif
 }
 occaFunction inline long16  operator *  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ * b.v_);
+#else
   return OCCA_LONG16(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -8833,9 +11070,13 @@ occaFunction inline long16  operator *  (const long16 &a, const long16 &b){
                      a.s13 * b.s13,
                      a.s14 * b.s14,
                      a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline long16  operator *  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a * b.v_);
+#else
   return OCCA_LONG16(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -8852,9 +11093,13 @@ occaFunction inline long16  operator *  (const long &a, const long16 &b){
                      a * b.s13,
                      a * b.s14,
                      a * b.s15);
+#endif
 }
 
 occaFunction inline long16  operator *  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ * b);
+#else
   return OCCA_LONG16(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -8871,9 +11116,14 @@ occaFunction inline long16  operator *  (const long16 &a, const long &b){
                      a.s13 * b,
                      a.s14 * b,
                      a.s15 * b);
+#endif
 }
 
 occaFunction inline long16& operator *= (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -8891,9 +11141,14 @@ occaFunction inline long16& operator *= (      long16 &a, const long16 &b){
   a.s14 *= b.s14;
   a.s15 *= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline long16& operator *= (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -8911,8 +11166,12 @@ occaFunction inline long16& operator *= (      long16 &a, const long &b){
   a.s14 *= b;
   a.s15 *= b;
   return a;
+#endif
 }
 occaFunction inline long16  operator /  (const long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ / b.v_);
+#else
   return OCCA_LONG16(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -8929,9 +11188,13 @@ occaFunction inline long16  operator /  (const long16 &a, const long16 &b){
                      a.s13 / b.s13,
                      a.s14 / b.s14,
                      a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline long16  operator /  (const long &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a / b.v_);
+#else
   return OCCA_LONG16(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -8948,9 +11211,13 @@ occaFunction inline long16  operator /  (const long &a, const long16 &b){
                      a / b.s13,
                      a / b.s14,
                      a / b.s15);
+#endif
 }
 
 occaFunction inline long16  operator /  (const long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return long16(a.v_ / b);
+#else
   return OCCA_LONG16(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -8967,9 +11234,14 @@ occaFunction inline long16  operator /  (const long16 &a, const long &b){
                      a.s13 / b,
                      a.s14 / b,
                      a.s15 / b);
+#endif
 }
 
 occaFunction inline long16& operator /= (      long16 &a, const long16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -8987,9 +11259,14 @@ occaFunction inline long16& operator /= (      long16 &a, const long16 &b){
   a.s14 /= b.s14;
   a.s15 /= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline long16& operator /= (      long16 &a, const long &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -9007,6 +11284,7 @@ occaFunction inline long16& operator /= (      long16 &a, const long &b){
   a.s14 /= b;
   a.s15 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -9042,11 +11320,29 @@ inline std::ostream& operator << (std::ostream &out, const long16& a){
 #else
 #  define OCCA_FLOAT2 float2
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef float occaSimdFloat2 __attribute__ ((vector_size(2*sizeof(float)),
+                                           aligned(OCCA_SIMD_ALIGN(2*sizeof(float)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class float2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdFloat2 v_;
+
+    __extension__ struct {
+      union { float s0, x; };
+      union { float s1, y; };
+    };
+  };
+
+  explicit inline occaFunction float2(const occaSimdFloat2 &v) : 
+    v_(v) {}
+#else
   union { float s0, x; };
   union { float s1, y; };
+#endif
 
   inline occaFunction float2() : 
     x(0),
@@ -9064,116 +11360,212 @@ public:
 #endif
 
 occaFunction inline float2 operator + (const float2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(+a.v_);
+#else
   return OCCA_FLOAT2(+a.x,
                      +a.y);
+#endif
 }
 occaFunction inline float2 operator - (const float2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(-a.v_);
+#else
   return OCCA_FLOAT2(-a.x,
                      -a.y);
+#endif
 }
 occaFunction inline float2  operator +  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ + b.v_);
+#else
   return OCCA_FLOAT2(a.x + b.x,
                      a.y + b.y);
+#endif
 }
 
 occaFunction inline float2  operator +  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a + b.v_);
+#else
   return OCCA_FLOAT2(a + b.x,
                      a + b.y);
+#endif
 }
 
 occaFunction inline float2  operator +  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ + b);
+#else
   return OCCA_FLOAT2(a.x + b,
                      a.y + b);
+#endif
 }
 
 occaFunction inline float2& operator += (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   return a;
+#endif
 }
 
 occaFunction inline float2& operator += (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   return a;
+#endif
 }
 occaFunction inline float2  operator -  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ - b.v_);
+#else
   return OCCA_FLOAT2(a.x - b.x,
                      a.y - b.y);
+#endif
 }
 
 occaFunction inline float2  operator -  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a - b.v_);
+#else
   return OCCA_FLOAT2(a - b.x,
                      a - b.y);
+#endif
 }
 
 occaFunction inline float2  operator -  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ - b);
+#else
   return OCCA_FLOAT2(a.x - b,
                      a.y - b);
+#endif
 }
 
 occaFunction inline float2& operator -= (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   return a;
+#endif
 }
 
 occaFunction inline float2& operator -= (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   return a;
+#endif
 }
 occaFunction inline float2  operator *  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ * b.v_);
+#else
   return OCCA_FLOAT2(a.x * b.x,
                      a.y * b.y);
+#endif
 }
 
 occaFunction inline float2  operator *  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a * b.v_);
+#else
   return OCCA_FLOAT2(a * b.x,
                      a * b.y);
+#endif
 }
 
 occaFunction inline float2  operator *  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ * b);
+#else
   return OCCA_FLOAT2(a.x * b,
                      a.y * b);
+#endif
 }
 
 occaFunction inline float2& operator *= (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   return a;
+#endif
 }
 
 occaFunction inline float2& operator *= (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   return a;
+#endif
 }
 occaFunction inline float2  operator /  (const float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ / b.v_);
+#else
   return OCCA_FLOAT2(a.x / b.x,
                      a.y / b.y);
+#endif
 }
 
 occaFunction inline float2  operator /  (const float &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a / b.v_);
+#else
   return OCCA_FLOAT2(a / b.x,
                      a / b.y);
+#endif
 }
 
 occaFunction inline float2  operator /  (const float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float2(a.v_ / b);
+#else
   return OCCA_FLOAT2(a.x / b,
                      a.y / b);
+#endif
 }
 
 occaFunction inline float2& operator /= (      float2 &a, const float2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   return a;
+#endif
 }
 
 occaFunction inline float2& operator /= (      float2 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -9195,13 +11587,33 @@ inline std::ostream& operator << (std::ostream &out, const float2& a){
 #else
 #  define OCCA_FLOAT4 float4
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef float occaSimdFloat4 __attribute__ ((vector_size(4*sizeof(float)),
+                                           aligned(OCCA_SIMD_ALIGN(4*sizeof(float)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class float4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdFloat4 v_;
+
+    __extension__ struct {
+      union { float s0, x; };
+      union { float s1, y; };
+      union { float s2, z; };
+      union { float s3, w; };
+    };
+  };
+
+  explicit inline occaFunction float4(const occaSimdFloat4 &v) : 
+    v_(v) {}
+#else
   union { float s0, x; };
   union { float s1, y; };
   union { float s2, z; };
   union { float s3, w; };
+#endif
 
   inline occaFunction float4() : 
     x(0),
@@ -9242,160 +11654,256 @@ public:
 #endif
 
 occaFunction inline float4 operator + (const float4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(+a.v_);
+#else
   return OCCA_FLOAT4(+a.x,
                      +a.y,
                      +a.z,
                      +a.w);
+#endif
 }
 occaFunction inline float4 operator - (const float4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(-a.v_);
+#else
   return OCCA_FLOAT4(-a.x,
                      -a.y,
                      -a.z,
                      -a.w);
+#endif
 }
 occaFunction inline float4  operator +  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ + b.v_);
+#else
   return OCCA_FLOAT4(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
                      a.w + b.w);
+#endif
 }
 
 occaFunction inline float4  operator +  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a + b.v_);
+#else
   return OCCA_FLOAT4(a + b.x,
                      a + b.y,
                      a + b.z,
                      a + b.w);
+#endif
 }
 
 occaFunction inline float4  operator +  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ + b);
+#else
   return OCCA_FLOAT4(a.x + b,
                      a.y + b,
                      a.z + b,
                      a.w + b);
+#endif
 }
 
 occaFunction inline float4& operator += (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
   return a;
+#endif
 }
 
 occaFunction inline float4& operator += (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
   return a;
+#endif
 }
 occaFunction inline float4  operator -  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ - b.v_);
+#else
   return OCCA_FLOAT4(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
                      a.w - b.w);
+#endif
 }
 
 occaFunction inline float4  operator -  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a - b.v_);
+#else
   return OCCA_FLOAT4(a - b.x,
                      a - b.y,
                      a - b.z,
                      a - b.w);
+#endif
 }
 
 occaFunction inline float4  operator -  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ - b);
+#else
   return OCCA_FLOAT4(a.x - b,
                      a.y - b,
                      a.z - b,
                      a.w - b);
+#endif
 }
 
 occaFunction inline float4& operator -= (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
   return a;
+#endif
 }
 
 occaFunction inline float4& operator -= (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
   return a;
+#endif
 }
 occaFunction inline float4  operator *  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ * b.v_);
+#else
   return OCCA_FLOAT4(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
                      a.w * b.w);
+#endif
 }
 
 occaFunction inline float4  operator *  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a * b.v_);
+#else
   return OCCA_FLOAT4(a * b.x,
                      a * b.y,
                      a * b.z,
                      a * b.w);
+#endif
 }
 
 occaFunction inline float4  operator *  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ * b);
+#else
   return OCCA_FLOAT4(a.x * b,
                      a.y * b,
                      a.z * b,
                      a.w * b);
+#endif
 }
 
 occaFunction inline float4& operator *= (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
   return a;
+#endif
 }
 
 occaFunction inline float4& operator *= (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
   return a;
+#endif
 }
 occaFunction inline float4  operator /  (const float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ / b.v_);
+#else
   return OCCA_FLOAT4(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
                      a.w / b.w);
+#endif
 }
 
 occaFunction inline float4  operator /  (const float &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a / b.v_);
+#else
   return OCCA_FLOAT4(a / b.x,
                      a / b.y,
                      a / b.z,
                      a / b.w);
+#endif
 }
 
 occaFunction inline float4  operator /  (const float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float4(a.v_ / b);
+#else
   return OCCA_FLOAT4(a.x / b,
                      a.y / b,
                      a.z / b,
                      a.w / b);
+#endif
 }
 
 occaFunction inline float4& operator /= (      float4 &a, const float4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
   return a;
+#endif
 }
 
 occaFunction inline float4& operator /= (      float4 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -9427,8 +11935,31 @@ typedef float4 float3;
 
 //---[ float8 ]-------------------------
 #define OCCA_FLOAT8 float8
+#if OCCA_VECTOR_EXTENSIONS
+typedef float occaSimdFloat8 __attribute__ ((vector_size(8*sizeof(float)),
+                                           aligned(OCCA_SIMD_ALIGN(8*sizeof(float)))));
+#endif
 class float8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdFloat8 v_;
+
+    __extension__ struct {
+      union { float s0, x; };
+      union { float s1, y; };
+      union { float s2, z; };
+      union { float s3, w; };
+      float s4;
+      float s5;
+      float s6;
+      float s7;
+    };
+  };
+
+  explicit inline occaFunction float8(const occaSimdFloat8 &v) : 
+    v_(v) {}
+#else
   union { float s0, x; };
   union { float s1, y; };
   union { float s2, z; };
@@ -9437,6 +11968,7 @@ public:
   float s5;
   float s6;
   float s7;
+#endif
 
   inline occaFunction float8() : 
     x(0),
@@ -9558,6 +12090,9 @@ public:
 };
 
 occaFunction inline float8 operator + (const float8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(+a.v_);
+#else
   return OCCA_FLOAT8(+a.x,
                      +a.y,
                      +a.z,
@@ -9566,8 +12101,12 @@ occaFunction inline float8 operator + (const float8 &a){
                      +a.s5,
                      +a.s6,
                      +a.s7);
+#endif
 }
 occaFunction inline float8 operator - (const float8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(-a.v_);
+#else
   return OCCA_FLOAT8(-a.x,
                      -a.y,
                      -a.z,
@@ -9576,8 +12115,12 @@ occaFunction inline float8 operator - (const float8 &a){
                      -a.s5,
                      -a.s6,
                      -a.s7);
+#endif
 }
 occaFunction inline float8  operator +  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ + b.v_);
+#else
   return OCCA_FLOAT8(a.x + b.x,
                      a.y + b.y,
                      a.z + b.z,
@@ -9586,9 +12129,13 @@ occaFunction inline float8  operator +  (const float8 &a, const float8 &b){
                      a.s5 + b.s5,
                      a.s6 + b.s6,
                      a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline float8  operator +  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a + b.v_);
+#else
   return OCCA_FLOAT8(a + b.x,
                      a + b.y,
                      a + b.z,
@@ -9597,9 +12144,13 @@ occaFunction inline float8  operator +  (const float &a, const float8 &b){
                      a + b.s5,
                      a + b.s6,
                      a + b.s7);
+#endif
 }
 
 occaFunction inline float8  operator +  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ + b);
+#else
   return OCCA_FLOAT8(a.x + b,
                      a.y + b,
                      a.z + b,
@@ -9608,9 +12159,14 @@ occaFunction inline float8  operator +  (const float8 &a, const float &b){
                      a.s5 + b,
                      a.s6 + b,
                      a.s7 + b);
+#endif
 }
 
 occaFunction inline float8& operator += (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -9620,9 +12176,14 @@ occaFunction inline float8& operator += (      float8 &a, const float8 &b){
   a.s6 += b.s6;
   a.s7 += b.s7;
   return a;
+#endif
 }
 
 occaFunction inline float8& operator += (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -9632,8 +12193,12 @@ occaFunction inline float8& operator += (      float8 &a, const float &b){
   a.s6 += b;
   a.s7 += b;
   return a;
+#endif
 }
 occaFunction inline float8  operator -  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ - b.v_);
+#else
   return OCCA_FLOAT8(a.x - b.x,
                      a.y - b.y,
                      a.z - b.z,
@@ -9642,9 +12207,13 @@ occaFunction inline float8  operator -  (const float8 &a, const float8 &b){
                      a.s5 - b.s5,
                      a.s6 - b.s6,
                      a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline float8  operator -  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a - b.v_);
+#else
   return OCCA_FLOAT8(a - b.x,
                      a - b.y,
                      a - b.z,
@@ -9653,9 +12222,13 @@ occaFunction inline float8  operator -  (const float &a, const float8 &b){
                      a - b.s5,
                      a - b.s6,
                      a - b.s7);
+#endif
 }
 
 occaFunction inline float8  operator -  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ - b);
+#else
   return OCCA_FLOAT8(a.x - b,
                      a.y - b,
                      a.z - b,
@@ -9664,9 +12237,14 @@ occaFunction inline float8  operator -  (const float8 &a, const float &b){
                      a.s5 - b,
                      a.s6 - b,
                      a.s7 - b);
+#endif
 }
 
 occaFunction inline float8& operator -= (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -9676,9 +12254,14 @@ occaFunction inline float8& operator -= (      float8 &a, const float8 &b){
   a.s6 -= b.s6;
   a.s7 -= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline float8& operator -= (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -9688,8 +12271,12 @@ occaFunction inline float8& operator -= (      float8 &a, const float &b){
   a.s6 -= b;
   a.s7 -= b;
   return a;
+#endif
 }
 occaFunction inline float8  operator *  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ * b.v_);
+#else
   return OCCA_FLOAT8(a.x * b.x,
                      a.y * b.y,
                      a.z * b.z,
@@ -9698,9 +12285,13 @@ occaFunction inline float8  operator *  (const float8 &a, const float8 &b){
                      a.s5 * b.s5,
                      a.s6 * b.s6,
                      a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline float8  operator *  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a * b.v_);
+#else
   return OCCA_FLOAT8(a * b.x,
                      a * b.y,
                      a * b.z,
@@ -9709,9 +12300,13 @@ occaFunction inline float8  operator *  (const float &a, const float8 &b){
                      a * b.s5,
                      a * b.s6,
                      a * b.s7);
+#endif
 }
 
 occaFunction inline float8  operator *  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ * b);
+#else
   return OCCA_FLOAT8(a.x * b,
                      a.y * b,
                      a.z * b,
@@ -9720,9 +12315,14 @@ occaFunction inline float8  operator *  (const float8 &a, const float &b){
                      a.s5 * b,
                      a.s6 * b,
                      a.s7 * b);
+#endif
 }
 
 occaFunction inline float8& operator *= (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -9732,9 +12332,14 @@ occaFunction inline float8& operator *= (      float8 &a, const float8 &b){
   a.s6 *= b.s6;
   a.s7 *= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline float8& operator *= (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -9744,8 +12349,12 @@ occaFunction inline float8& operator *= (      float8 &a, const float &b){
   a.s6 *= b;
   a.s7 *= b;
   return a;
+#endif
 }
 occaFunction inline float8  operator /  (const float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ / b.v_);
+#else
   return OCCA_FLOAT8(a.x / b.x,
                      a.y / b.y,
                      a.z / b.z,
@@ -9754,9 +12363,13 @@ occaFunction inline float8  operator /  (const float8 &a, const float8 &b){
                      a.s5 / b.s5,
                      a.s6 / b.s6,
                      a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline float8  operator /  (const float &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a / b.v_);
+#else
   return OCCA_FLOAT8(a / b.x,
                      a / b.y,
                      a / b.z,
@@ -9765,9 +12378,13 @@ occaFunction inline float8  operator /  (const float &a, const float8 &b){
                      a / b.s5,
                      a / b.s6,
                      a / b.s7);
+#endif
 }
 
 occaFunction inline float8  operator /  (const float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float8(a.v_ / b);
+#else
   return OCCA_FLOAT8(a.x / b,
                      a.y / b,
                      a.z / b,
@@ -9776,9 +12393,14 @@ occaFunction inline float8  operator /  (const float8 &a, const float &b){
                      a.s5 / b,
                      a.s6 / b,
                      a.s7 / b);
+#endif
 }
 
 occaFunction inline float8& operator /= (      float8 &a, const float8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -9788,9 +12410,14 @@ occaFunction inline float8& operator /= (      float8 &a, const float8 &b){
   a.s6 /= b.s6;
   a.s7 /= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline float8& operator /= (      float8 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -9800,6 +12427,7 @@ occaFunction inline float8& operator /= (      float8 &a, const float &b){
   a.s6 /= b;
   a.s7 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -9823,8 +12451,39 @@ inline std::ostream& operator << (std::ostream &out, const float8& a){
 
 //---[ float16 ]------------------------
 #define OCCA_FLOAT16 float16
+#if OCCA_VECTOR_EXTENSIONS
+typedef float occaSimdFloat16 __attribute__ ((vector_size(16*sizeof(float)),
+                                            aligned(OCCA_SIMD_ALIGN(16*sizeof(float)))));
+#endif
 class float16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdFloat16 v_;
+
+    __extension__ struct {
+      union { float s0, x; };
+      union { float s1, y; };
+      union { float s2, z; };
+      union { float s3, w; };
+      float s4;
+      float s5;
+      float s6;
+      float s7;
+      float s8;
+      float s9;
+      float s10;
+      float s11;
+      float s12;
+      float s13;
+      float s14;
+      float s15;
+    };
+  };
+
+  explicit inline occaFunction float16(const occaSimdFloat16 &v) : 
+    v_(v) {}
+#else
   union { float s0, x; };
   union { float s1, y; };
   union { float s2, z; };
@@ -9841,6 +12500,7 @@ public:
   float s13;
   float s14;
   float s15;
+#endif
 
   inline occaFunction float16() : 
     x(0),
@@ -10270,6 +12930,9 @@ public:
 };
 
 occaFunction inline float16 operator + (const float16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(+a.v_);
+#else
   return OCCA_FLOAT16(+a.x,
                       +a.y,
                       +a.z,
@@ -10286,8 +12949,12 @@ occaFunction inline float16 operator + (const float16 &a){
                       +a.s13,
                       +a.s14,
                       +a.s15);
+#endif
 }
 occaFunction inline float16 operator - (const float16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(-a.v_);
+#else
   return OCCA_FLOAT16(-a.x,
                       -a.y,
                       -a.z,
@@ -10304,8 +12971,12 @@ occaFunction inline float16 operator - (const float16 &a){
                       -a.s13,
                       -a.s14,
                       -a.s15);
+#endif
 }
 occaFunction inline float16  operator +  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ + b.v_);
+#else
   return OCCA_FLOAT16(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
@@ -10322,9 +12993,13 @@ occaFunction inline float16  operator +  (const float16 &a, const float16 &b){
                       a.s13 + b.s13,
                       a.s14 + b.s14,
                       a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline float16  operator +  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a + b.v_);
+#else
   return OCCA_FLOAT16(a + b.x,
                       a + b.y,
                       a + b.z,
@@ -10341,9 +13016,13 @@ occaFunction inline float16  operator +  (const float &a, const float16 &b){
                       a + b.s13,
                       a + b.s14,
                       a + b.s15);
+#endif
 }
 
 occaFunction inline float16  operator +  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ + b);
+#else
   return OCCA_FLOAT16(a.x + b,
                       a.y + b,
                       a.z + b,
@@ -10360,9 +13039,14 @@ occaFunction inline float16  operator +  (const float16 &a, const float &b){
                       a.s13 + b,
                       a.s14 + b,
                       a.s15 + b);
+#endif
 }
 
 occaFunction inline float16& operator += (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -10380,9 +13064,14 @@ occaFunction inline float16& operator += (      float16 &a, const float16 &b){
   a.s14 += b.s14;
   a.s15 += b.s15;
   return a;
+#endif
 }
 
 occaFunction inline float16& operator += (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -10400,8 +13089,12 @@ occaFunction inline float16& operator += (      float16 &a, const float &b){
   a.s14 += b;
   a.s15 += b;
   return a;
+#endif
 }
 occaFunction inline float16  operator -  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ - b.v_);
+#else
   return OCCA_FLOAT16(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
@@ -10418,9 +13111,13 @@ occaFunction inline float16  operator -  (const float16 &a, const float16 &b){
                       a.s13 - b.s13,
                       a.s14 - b.s14,
                       a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline float16  operator -  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a - b.v_);
+#else
   return OCCA_FLOAT16(a - b.x,
                       a - b.y,
                       a - b.z,
@@ -10437,9 +13134,13 @@ occaFunction inline float16  operator -  (const float &a, const float16 &b){
                       a - b.s13,
                       a - b.s14,
                       a - b.s15);
+#endif
 }
 
 occaFunction inline float16  operator -  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ - b);
+#else
   return OCCA_FLOAT16(a.x - b,
                       a.y - b,
                       a.z - b,
@@ -10456,9 +13157,14 @@ occaFunction inline float16  operator -  (const float16 &a, const float &b){
                       a.s13 - b,
                       a.s14 - b,
                       a.s15 - b);
+#endif
 }
 
 occaFunction inline float16& operator -= (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -10476,9 +13182,14 @@ occaFunction inline float16& operator -= (      float16 &a, const float16 &b){
   a.s14 -= b.s14;
   a.s15 -= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline float16& operator -= (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -10496,8 +13207,12 @@ occaFunction inline float16& operator -= (      float16 &a, const float &b){
   a.s14 -= b;
   a.s15 -= b;
   return a;
+#endif
 }
 occaFunction inline float16  operator *  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ * b.v_);
+#else
   return OCCA_FLOAT16(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
@@ -10514,9 +13229,13 @@ occaFunction inline float16  operator *  (const float16 &a, const float16 &b){
                       a.s13 * b.s13,
                       a.s14 * b.s14,
                       a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline float16  operator *  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a * b.v_);
+#else
   return OCCA_FLOAT16(a * b.x,
                       a * b.y,
                       a * b.z,
@@ -10533,9 +13252,13 @@ occaFunction inline float16  operator *  (const float &a, const float16 &b){
                       a * b.s13,
                       a * b.s14,
                       a * b.s15);
+#endif
 }
 
 occaFunction inline float16  operator *  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ * b);
+#else
   return OCCA_FLOAT16(a.x * b,
                       a.y * b,
                       a.z * b,
@@ -10552,9 +13275,14 @@ occaFunction inline float16  operator *  (const float16 &a, const float &b){
                       a.s13 * b,
                       a.s14 * b,
                       a.s15 * b);
+#endif
 }
 
 occaFunction inline float16& operator *= (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -10572,9 +13300,14 @@ occaFunction inline float16& operator *= (      float16 &a, const float16 &b){
   a.s14 *= b.s14;
   a.s15 *= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline float16& operator *= (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -10592,8 +13325,12 @@ occaFunction inline float16& operator *= (      float16 &a, const float &b){
   a.s14 *= b;
   a.s15 *= b;
   return a;
+#endif
 }
 occaFunction inline float16  operator /  (const float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ / b.v_);
+#else
   return OCCA_FLOAT16(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
@@ -10610,9 +13347,13 @@ occaFunction inline float16  operator /  (const float16 &a, const float16 &b){
                       a.s13 / b.s13,
                       a.s14 / b.s14,
                       a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline float16  operator /  (const float &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a / b.v_);
+#else
   return OCCA_FLOAT16(a / b.x,
                       a / b.y,
                       a / b.z,
@@ -10629,9 +13370,13 @@ occaFunction inline float16  operator /  (const float &a, const float16 &b){
                       a / b.s13,
                       a / b.s14,
                       a / b.s15);
+#endif
 }
 
 occaFunction inline float16  operator /  (const float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return float16(a.v_ / b);
+#else
   return OCCA_FLOAT16(a.x / b,
                       a.y / b,
                       a.z / b,
@@ -10648,9 +13393,14 @@ occaFunction inline float16  operator /  (const float16 &a, const float &b){
                       a.s13 / b,
                       a.s14 / b,
                       a.s15 / b);
+#endif
 }
 
 occaFunction inline float16& operator /= (      float16 &a, const float16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -10668,9 +13418,14 @@ occaFunction inline float16& operator /= (      float16 &a, const float16 &b){
   a.s14 /= b.s14;
   a.s15 /= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline float16& operator /= (      float16 &a, const float &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -10688,6 +13443,7 @@ occaFunction inline float16& operator /= (      float16 &a, const float &b){
   a.s14 /= b;
   a.s15 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -10723,11 +13479,29 @@ inline std::ostream& operator << (std::ostream &out, const float16& a){
 #else
 #  define OCCA_DOUBLE2 double2
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef double occaSimdDouble2 __attribute__ ((vector_size(2*sizeof(double)),
+                                             aligned(OCCA_SIMD_ALIGN(2*sizeof(double)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class double2{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdDouble2 v_;
+
+    __extension__ struct {
+      union { double s0, x; };
+      union { double s1, y; };
+    };
+  };
+
+  explicit inline occaFunction double2(const occaSimdDouble2 &v) : 
+    v_(v) {}
+#else
   union { double s0, x; };
   union { double s1, y; };
+#endif
 
   inline occaFunction double2() : 
     x(0),
@@ -10745,116 +13519,212 @@ public:
 #endif
 
 occaFunction inline double2 operator + (const double2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(+a.v_);
+#else
   return OCCA_DOUBLE2(+a.x,
                       +a.y);
+#endif
 }
 occaFunction inline double2 operator - (const double2 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(-a.v_);
+#else
   return OCCA_DOUBLE2(-a.x,
                       -a.y);
+#endif
 }
 occaFunction inline double2  operator +  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ + b.v_);
+#else
   return OCCA_DOUBLE2(a.x + b.x,
                       a.y + b.y);
+#endif
 }
 
 occaFunction inline double2  operator +  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a + b.v_);
+#else
   return OCCA_DOUBLE2(a + b.x,
                       a + b.y);
+#endif
 }
 
 occaFunction inline double2  operator +  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ + b);
+#else
   return OCCA_DOUBLE2(a.x + b,
                       a.y + b);
+#endif
 }
 
 occaFunction inline double2& operator += (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   return a;
+#endif
 }
 
 occaFunction inline double2& operator += (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   return a;
+#endif
 }
 occaFunction inline double2  operator -  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ - b.v_);
+#else
   return OCCA_DOUBLE2(a.x - b.x,
                       a.y - b.y);
+#endif
 }
 
 occaFunction inline double2  operator -  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a - b.v_);
+#else
   return OCCA_DOUBLE2(a - b.x,
                       a - b.y);
+#endif
 }
 
 occaFunction inline double2  operator -  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ - b);
+#else
   return OCCA_DOUBLE2(a.x - b,
                       a.y - b);
+#endif
 }
 
 occaFunction inline double2& operator -= (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   return a;
+#endif
 }
 
 occaFunction inline double2& operator -= (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   return a;
+#endif
 }
 occaFunction inline double2  operator *  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ * b.v_);
+#else
   return OCCA_DOUBLE2(a.x * b.x,
                       a.y * b.y);
+#endif
 }
 
 occaFunction inline double2  operator *  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a * b.v_);
+#else
   return OCCA_DOUBLE2(a * b.x,
                       a * b.y);
+#endif
 }
 
 occaFunction inline double2  operator *  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ * b);
+#else
   return OCCA_DOUBLE2(a.x * b,
                       a.y * b);
+#endif
 }
 
 occaFunction inline double2& operator *= (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   return a;
+#endif
 }
 
 occaFunction inline double2& operator *= (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   return a;
+#endif
 }
 occaFunction inline double2  operator /  (const double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ / b.v_);
+#else
   return OCCA_DOUBLE2(a.x / b.x,
                       a.y / b.y);
+#endif
 }
 
 occaFunction inline double2  operator /  (const double &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a / b.v_);
+#else
   return OCCA_DOUBLE2(a / b.x,
                       a / b.y);
+#endif
 }
 
 occaFunction inline double2  operator /  (const double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double2(a.v_ / b);
+#else
   return OCCA_DOUBLE2(a.x / b,
                       a.y / b);
+#endif
 }
 
 occaFunction inline double2& operator /= (      double2 &a, const double2 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   return a;
+#endif
 }
 
 occaFunction inline double2& operator /= (      double2 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -10876,13 +13746,33 @@ inline std::ostream& operator << (std::ostream &out, const double2& a){
 #else
 #  define OCCA_DOUBLE4 double4
 #endif
+#if OCCA_VECTOR_EXTENSIONS
+typedef double occaSimdDouble4 __attribute__ ((vector_size(4*sizeof(double)),
+                                             aligned(OCCA_SIMD_ALIGN(4*sizeof(double)))));
+#endif
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))
 class double4{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdDouble4 v_;
+
+    __extension__ struct {
+      union { double s0, x; };
+      union { double s1, y; };
+      union { double s2, z; };
+      union { double s3, w; };
+    };
+  };
+
+  explicit inline occaFunction double4(const occaSimdDouble4 &v) : 
+    v_(v) {}
+#else
   union { double s0, x; };
   union { double s1, y; };
   union { double s2, z; };
   union { double s3, w; };
+#endif
 
   inline occaFunction double4() : 
     x(0),
@@ -10923,160 +13813,256 @@ public:
 #endif
 
 occaFunction inline double4 operator + (const double4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(+a.v_);
+#else
   return OCCA_DOUBLE4(+a.x,
                       +a.y,
                       +a.z,
                       +a.w);
+#endif
 }
 occaFunction inline double4 operator - (const double4 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(-a.v_);
+#else
   return OCCA_DOUBLE4(-a.x,
                       -a.y,
                       -a.z,
                       -a.w);
+#endif
 }
 occaFunction inline double4  operator +  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ + b.v_);
+#else
   return OCCA_DOUBLE4(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
                       a.w + b.w);
+#endif
 }
 
 occaFunction inline double4  operator +  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a + b.v_);
+#else
   return OCCA_DOUBLE4(a + b.x,
                       a + b.y,
                       a + b.z,
                       a + b.w);
+#endif
 }
 
 occaFunction inline double4  operator +  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ + b);
+#else
   return OCCA_DOUBLE4(a.x + b,
                       a.y + b,
                       a.z + b,
                       a.w + b);
+#endif
 }
 
 occaFunction inline double4& operator += (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
   a.w += b.w;
   return a;
+#endif
 }
 
 occaFunction inline double4& operator += (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
   a.w += b;
   return a;
+#endif
 }
 occaFunction inline double4  operator -  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ - b.v_);
+#else
   return OCCA_DOUBLE4(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
                       a.w - b.w);
+#endif
 }
 
 occaFunction inline double4  operator -  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a - b.v_);
+#else
   return OCCA_DOUBLE4(a - b.x,
                       a - b.y,
                       a - b.z,
                       a - b.w);
+#endif
 }
 
 occaFunction inline double4  operator -  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ - b);
+#else
   return OCCA_DOUBLE4(a.x - b,
                       a.y - b,
                       a.z - b,
                       a.w - b);
+#endif
 }
 
 occaFunction inline double4& operator -= (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
   a.w -= b.w;
   return a;
+#endif
 }
 
 occaFunction inline double4& operator -= (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
   a.w -= b;
   return a;
+#endif
 }
 occaFunction inline double4  operator *  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ * b.v_);
+#else
   return OCCA_DOUBLE4(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
                       a.w * b.w);
+#endif
 }
 
 occaFunction inline double4  operator *  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a * b.v_);
+#else
   return OCCA_DOUBLE4(a * b.x,
                       a * b.y,
                       a * b.z,
                       a * b.w);
+#endif
 }
 
 occaFunction inline double4  operator *  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ * b);
+#else
   return OCCA_DOUBLE4(a.x * b,
                       a.y * b,
                       a.z * b,
                       a.w * b);
+#endif
 }
 
 occaFunction inline double4& operator *= (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
   a.w *= b.w;
   return a;
+#endif
 }
 
 occaFunction inline double4& operator *= (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
   a.w *= b;
   return a;
+#endif
 }
 occaFunction inline double4  operator /  (const double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ / b.v_);
+#else
   return OCCA_DOUBLE4(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
                       a.w / b.w);
+#endif
 }
 
 occaFunction inline double4  operator /  (const double &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a / b.v_);
+#else
   return OCCA_DOUBLE4(a / b.x,
                       a / b.y,
                       a / b.z,
                       a / b.w);
+#endif
 }
 
 occaFunction inline double4  operator /  (const double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double4(a.v_ / b);
+#else
   return OCCA_DOUBLE4(a.x / b,
                       a.y / b,
                       a.z / b,
                       a.w / b);
+#endif
 }
 
 occaFunction inline double4& operator /= (      double4 &a, const double4 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
   a.w /= b.w;
   return a;
+#endif
 }
 
 occaFunction inline double4& operator /= (      double4 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
   a.w /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -11108,8 +14094,31 @@ typedef double4 double3;
 
 //---[ double8 ]------------------------
 #define OCCA_DOUBLE8 double8
+#if OCCA_VECTOR_EXTENSIONS
+typedef double occaSimdDouble8 __attribute__ ((vector_size(8*sizeof(double)),
+                                             aligned(OCCA_SIMD_ALIGN(8*sizeof(double)))));
+#endif
 class double8{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdDouble8 v_;
+
+    __extension__ struct {
+      union { double s0, x; };
+      union { double s1, y; };
+      union { double s2, z; };
+      union { double s3, w; };
+      double s4;
+      double s5;
+      double s6;
+      double s7;
+    };
+  };
+
+  explicit inline occaFunction double8(const occaSimdDouble8 &v) : 
+    v_(v) {}
+#else
   union { double s0, x; };
   union { double s1, y; };
   union { double s2, z; };
@@ -11118,6 +14127,7 @@ public:
   double s5;
   double s6;
   double s7;
+#endif
 
   inline occaFunction double8() : 
     x(0),
@@ -11239,6 +14249,9 @@ public:
 };
 
 occaFunction inline double8 operator + (const double8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(+a.v_);
+#else
   return OCCA_DOUBLE8(+a.x,
                       +a.y,
                       +a.z,
@@ -11247,8 +14260,12 @@ occaFunction inline double8 operator + (const double8 &a){
                       +a.s5,
                       +a.s6,
                       +a.s7);
+#endif
 }
 occaFunction inline double8 operator - (const double8 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(-a.v_);
+#else
   return OCCA_DOUBLE8(-a.x,
                       -a.y,
                       -a.z,
@@ -11257,8 +14274,12 @@ occaFunction inline double8 operator - (const double8 &a){
                       -a.s5,
                       -a.s6,
                       -a.s7);
+#endif
 }
 occaFunction inline double8  operator +  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ + b.v_);
+#else
   return OCCA_DOUBLE8(a.x + b.x,
                       a.y + b.y,
                       a.z + b.z,
@@ -11267,9 +14288,13 @@ occaFunction inline double8  operator +  (const double8 &a, const double8 &b){
                       a.s5 + b.s5,
                       a.s6 + b.s6,
                       a.s7 + b.s7);
+#endif
 }
 
 occaFunction inline double8  operator +  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a + b.v_);
+#else
   return OCCA_DOUBLE8(a + b.x,
                       a + b.y,
                       a + b.z,
@@ -11278,9 +14303,13 @@ occaFunction inline double8  operator +  (const double &a, const double8 &b){
                       a + b.s5,
                       a + b.s6,
                       a + b.s7);
+#endif
 }
 
 occaFunction inline double8  operator +  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ + b);
+#else
   return OCCA_DOUBLE8(a.x + b,
                       a.y + b,
                       a.z + b,
@@ -11289,9 +14318,14 @@ occaFunction inline double8  operator +  (const double8 &a, const double &b){
                       a.s5 + b,
                       a.s6 + b,
                       a.s7 + b);
+#endif
 }
 
 occaFunction inline double8& operator += (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -11301,9 +14335,14 @@ occaFunction inline double8& operator += (      double8 &a, const double8 &b){
   a.s6 += b.s6;
   a.s7 += b.s7;
   return a;
+#endif
 }
 
 occaFunction inline double8& operator += (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -11313,8 +14352,12 @@ occaFunction inline double8& operator += (      double8 &a, const double &b){
   a.s6 += b;
   a.s7 += b;
   return a;
+#endif
 }
 occaFunction inline double8  operator -  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ - b.v_);
+#else
   return OCCA_DOUBLE8(a.x - b.x,
                       a.y - b.y,
                       a.z - b.z,
@@ -11323,9 +14366,13 @@ occaFunction inline double8  operator -  (const double8 &a, const double8 &b){
                       a.s5 - b.s5,
                       a.s6 - b.s6,
                       a.s7 - b.s7);
+#endif
 }
 
 occaFunction inline double8  operator -  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a - b.v_);
+#else
   return OCCA_DOUBLE8(a - b.x,
                       a - b.y,
                       a - b.z,
@@ -11334,9 +14381,13 @@ occaFunction inline double8  operator -  (const double &a, const double8 &b){
                       a - b.s5,
                       a - b.s6,
                       a - b.s7);
+#endif
 }
 
 occaFunction inline double8  operator -  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ - b);
+#else
   return OCCA_DOUBLE8(a.x - b,
                       a.y - b,
                       a.z - b,
@@ -11345,9 +14396,14 @@ occaFunction inline double8  operator -  (const double8 &a, const double &b){
                       a.s5 - b,
                       a.s6 - b,
                       a.s7 - b);
+#endif
 }
 
 occaFunction inline double8& operator -= (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -11357,9 +14413,14 @@ occaFunction inline double8& operator -= (      double8 &a, const double8 &b){
   a.s6 -= b.s6;
   a.s7 -= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline double8& operator -= (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -11369,8 +14430,12 @@ occaFunction inline double8& operator -= (      double8 &a, const double &b){
   a.s6 -= b;
   a.s7 -= b;
   return a;
+#endif
 }
 occaFunction inline double8  operator *  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ * b.v_);
+#else
   return OCCA_DOUBLE8(a.x * b.x,
                       a.y * b.y,
                       a.z * b.z,
@@ -11379,9 +14444,13 @@ occaFunction inline double8  operator *  (const double8 &a, const double8 &b){
                       a.s5 * b.s5,
                       a.s6 * b.s6,
                       a.s7 * b.s7);
+#endif
 }
 
 occaFunction inline double8  operator *  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a * b.v_);
+#else
   return OCCA_DOUBLE8(a * b.x,
                       a * b.y,
                       a * b.z,
@@ -11390,9 +14459,13 @@ occaFunction inline double8  operator *  (const double &a, const double8 &b){
                       a * b.s5,
                       a * b.s6,
                       a * b.s7);
+#endif
 }
 
 occaFunction inline double8  operator *  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ * b);
+#else
   return OCCA_DOUBLE8(a.x * b,
                       a.y * b,
                       a.z * b,
@@ -11401,9 +14474,14 @@ occaFunction inline double8  operator *  (const double8 &a, const double &b){
                       a.s5 * b,
                       a.s6 * b,
                       a.s7 * b);
+#endif
 }
 
 occaFunction inline double8& operator *= (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -11413,9 +14491,14 @@ occaFunction inline double8& operator *= (      double8 &a, const double8 &b){
   a.s6 *= b.s6;
   a.s7 *= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline double8& operator *= (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -11425,8 +14508,12 @@ occaFunction inline double8& operator *= (      double8 &a, const double &b){
   a.s6 *= b;
   a.s7 *= b;
   return a;
+#endif
 }
 occaFunction inline double8  operator /  (const double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ / b.v_);
+#else
   return OCCA_DOUBLE8(a.x / b.x,
                       a.y / b.y,
                       a.z / b.z,
@@ -11435,9 +14522,13 @@ occaFunction inline double8  operator /  (const double8 &a, const double8 &b){
                       a.s5 / b.s5,
                       a.s6 / b.s6,
                       a.s7 / b.s7);
+#endif
 }
 
 occaFunction inline double8  operator /  (const double &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a / b.v_);
+#else
   return OCCA_DOUBLE8(a / b.x,
                       a / b.y,
                       a / b.z,
@@ -11446,9 +14537,13 @@ occaFunction inline double8  operator /  (const double &a, const double8 &b){
                       a / b.s5,
                       a / b.s6,
                       a / b.s7);
+#endif
 }
 
 occaFunction inline double8  operator /  (const double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double8(a.v_ / b);
+#else
   return OCCA_DOUBLE8(a.x / b,
                       a.y / b,
                       a.z / b,
@@ -11457,9 +14552,14 @@ occaFunction inline double8  operator /  (const double8 &a, const double &b){
                       a.s5 / b,
                       a.s6 / b,
                       a.s7 / b);
+#endif
 }
 
 occaFunction inline double8& operator /= (      double8 &a, const double8 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -11469,9 +14569,14 @@ occaFunction inline double8& operator /= (      double8 &a, const double8 &b){
   a.s6 /= b.s6;
   a.s7 /= b.s7;
   return a;
+#endif
 }
 
 occaFunction inline double8& operator /= (      double8 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -11481,6 +14586,7 @@ occaFunction inline double8& operator /= (      double8 &a, const double &b){
   a.s6 /= b;
   a.s7 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -11504,8 +14610,39 @@ inline std::ostream& operator << (std::ostream &out, const double8& a){
 
 //---[ double16 ]-----------------------
 #define OCCA_DOUBLE16 double16
+#if OCCA_VECTOR_EXTENSIONS
+typedef double occaSimdDouble16 __attribute__ ((vector_size(16*sizeof(double)),
+                                              aligned(OCCA_SIMD_ALIGN(16*sizeof(double)))));
+#endif
 class double16{
 public:
+#if OCCA_VECTOR_EXTENSIONS
+  union {
+    occaSimdDouble16 v_;
+
+    __extension__ struct {
+      union { double s0, x; };
+      union { double s1, y; };
+      union { double s2, z; };
+      union { double s3, w; };
+      double s4;
+      double s5;
+      double s6;
+      double s7;
+      double s8;
+      double s9;
+      double s10;
+      double s11;
+      double s12;
+      double s13;
+      double s14;
+      double s15;
+    };
+  };
+
+  explicit inline occaFunction double16(const occaSimdDouble16 &v) : 
+    v_(v) {}
+#else
   union { double s0, x; };
   union { double s1, y; };
   union { double s2, z; };
@@ -11522,6 +14659,7 @@ public:
   double s13;
   double s14;
   double s15;
+#endif
 
   inline occaFunction double16() : 
     x(0),
@@ -11951,6 +15089,9 @@ public:
 };
 
 occaFunction inline double16 operator + (const double16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(+a.v_);
+#else
   return OCCA_DOUBLE16(+a.x,
                        +a.y,
                        +a.z,
@@ -11967,8 +15108,12 @@ occaFunction inline double16 operator + (const double16 &a){
                        +a.s13,
                        +a.s14,
                        +a.s15);
+#endif
 }
 occaFunction inline double16 operator - (const double16 &a){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(-a.v_);
+#else
   return OCCA_DOUBLE16(-a.x,
                        -a.y,
                        -a.z,
@@ -11985,8 +15130,12 @@ occaFunction inline double16 operator - (const double16 &a){
                        -a.s13,
                        -a.s14,
                        -a.s15);
+#endif
 }
 occaFunction inline double16  operator +  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ + b.v_);
+#else
   return OCCA_DOUBLE16(a.x + b.x,
                        a.y + b.y,
                        a.z + b.z,
@@ -12003,9 +15152,13 @@ occaFunction inline double16  operator +  (const double16 &a, const double16 &b)
                        a.s13 + b.s13,
                        a.s14 + b.s14,
                        a.s15 + b.s15);
+#endif
 }
 
 occaFunction inline double16  operator +  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a + b.v_);
+#else
   return OCCA_DOUBLE16(a + b.x,
                        a + b.y,
                        a + b.z,
@@ -12022,9 +15175,13 @@ occaFunction inline double16  operator +  (const double &a, const double16 &b){
                        a + b.s13,
                        a + b.s14,
                        a + b.s15);
+#endif
 }
 
 occaFunction inline double16  operator +  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ + b);
+#else
   return OCCA_DOUBLE16(a.x + b,
                        a.y + b,
                        a.z + b,
@@ -12041,9 +15198,14 @@ occaFunction inline double16  operator +  (const double16 &a, const double &b){
                        a.s13 + b,
                        a.s14 + b,
                        a.s15 + b);
+#endif
 }
 
 occaFunction inline double16& operator += (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b.v_;
+  return a;
+#else
   a.x += b.x;
   a.y += b.y;
   a.z += b.z;
@@ -12061,9 +15223,14 @@ occaFunction inline double16& operator += (      double16 &a, const double16 &b)
   a.s14 += b.s14;
   a.s15 += b.s15;
   return a;
+#endif
 }
 
 occaFunction inline double16& operator += (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ += b;
+  return a;
+#else
   a.x += b;
   a.y += b;
   a.z += b;
@@ -12081,8 +15248,12 @@ occaFunction inline double16& operator += (      double16 &a, const double &b){
   a.s14 += b;
   a.s15 += b;
   return a;
+#endif
 }
 occaFunction inline double16  operator -  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ - b.v_);
+#else
   return OCCA_DOUBLE16(a.x - b.x,
                        a.y - b.y,
                        a.z - b.z,
@@ -12099,9 +15270,13 @@ occaFunction inline double16  operator -  (const double16 &a, const double16 &b)
                        a.s13 - b.s13,
                        a.s14 - b.s14,
                        a.s15 - b.s15);
+#endif
 }
 
 occaFunction inline double16  operator -  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a - b.v_);
+#else
   return OCCA_DOUBLE16(a - b.x,
                        a - b.y,
                        a - b.z,
@@ -12118,9 +15293,13 @@ occaFunction inline double16  operator -  (const double &a, const double16 &b){
                        a - b.s13,
                        a - b.s14,
                        a - b.s15);
+#endif
 }
 
 occaFunction inline double16  operator -  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ - b);
+#else
   return OCCA_DOUBLE16(a.x - b,
                        a.y - b,
                        a.z - b,
@@ -12137,9 +15316,14 @@ occaFunction inline double16  operator -  (const double16 &a, const double &b){
                        a.s13 - b,
                        a.s14 - b,
                        a.s15 - b);
+#endif
 }
 
 occaFunction inline double16& operator -= (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b.v_;
+  return a;
+#else
   a.x -= b.x;
   a.y -= b.y;
   a.z -= b.z;
@@ -12157,9 +15341,14 @@ occaFunction inline double16& operator -= (      double16 &a, const double16 &b)
   a.s14 -= b.s14;
   a.s15 -= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline double16& operator -= (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ -= b;
+  return a;
+#else
   a.x -= b;
   a.y -= b;
   a.z -= b;
@@ -12177,8 +15366,12 @@ occaFunction inline double16& operator -= (      double16 &a, const double &b){
   a.s14 -= b;
   a.s15 -= b;
   return a;
+#endif
 }
 occaFunction inline double16  operator *  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ * b.v_);
+#else
   return OCCA_DOUBLE16(a.x * b.x,
                        a.y * b.y,
                        a.z * b.z,
@@ -12195,9 +15388,13 @@ occaFunction inline double16  operator *  (const double16 &a, const double16 &b)
                        a.s13 * b.s13,
                        a.s14 * b.s14,
                        a.s15 * b.s15);
+#endif
 }
 
 occaFunction inline double16  operator *  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a * b.v_);
+#else
   return OCCA_DOUBLE16(a * b.x,
                        a * b.y,
                        a * b.z,
@@ -12214,9 +15411,13 @@ occaFunction inline double16  operator *  (const double &a, const double16 &b){
                        a * b.s13,
                        a * b.s14,
                        a * b.s15);
+#endif
 }
 
 occaFunction inline double16  operator *  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ * b);
+#else
   return OCCA_DOUBLE16(a.x * b,
                        a.y * b,
                        a.z * b,
@@ -12233,9 +15434,14 @@ occaFunction inline double16  operator *  (const double16 &a, const double &b){
                        a.s13 * b,
                        a.s14 * b,
                        a.s15 * b);
+#endif
 }
 
 occaFunction inline double16& operator *= (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b.v_;
+  return a;
+#else
   a.x *= b.x;
   a.y *= b.y;
   a.z *= b.z;
@@ -12253,9 +15459,14 @@ occaFunction inline double16& operator *= (      double16 &a, const double16 &b)
   a.s14 *= b.s14;
   a.s15 *= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline double16& operator *= (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ *= b;
+  return a;
+#else
   a.x *= b;
   a.y *= b;
   a.z *= b;
@@ -12273,8 +15484,12 @@ occaFunction inline double16& operator *= (      double16 &a, const double &b){
   a.s14 *= b;
   a.s15 *= b;
   return a;
+#endif
 }
 occaFunction inline double16  operator /  (const double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ / b.v_);
+#else
   return OCCA_DOUBLE16(a.x / b.x,
                        a.y / b.y,
                        a.z / b.z,
@@ -12291,9 +15506,13 @@ occaFunction inline double16  operator /  (const double16 &a, const double16 &b)
                        a.s13 / b.s13,
                        a.s14 / b.s14,
                        a.s15 / b.s15);
+#endif
 }
 
 occaFunction inline double16  operator /  (const double &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a / b.v_);
+#else
   return OCCA_DOUBLE16(a / b.x,
                        a / b.y,
                        a / b.z,
@@ -12310,9 +15529,13 @@ occaFunction inline double16  operator /  (const double &a, const double16 &b){
                        a / b.s13,
                        a / b.s14,
                        a / b.s15);
+#endif
 }
 
 occaFunction inline double16  operator /  (const double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  return double16(a.v_ / b);
+#else
   return OCCA_DOUBLE16(a.x / b,
                        a.y / b,
                        a.z / b,
@@ -12329,9 +15552,14 @@ occaFunction inline double16  operator /  (const double16 &a, const double &b){
                        a.s13 / b,
                        a.s14 / b,
                        a.s15 / b);
+#endif
 }
 
 occaFunction inline double16& operator /= (      double16 &a, const double16 &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b.v_;
+  return a;
+#else
   a.x /= b.x;
   a.y /= b.y;
   a.z /= b.z;
@@ -12349,9 +15577,14 @@ occaFunction inline double16& operator /= (      double16 &a, const double16 &b)
   a.s14 /= b.s14;
   a.s15 /= b.s15;
   return a;
+#endif
 }
 
 occaFunction inline double16& operator /= (      double16 &a, const double &b){
+#if OCCA_VECTOR_EXTENSIONS
+  a.v_ /= b;
+  return a;
+#else
   a.x /= b;
   a.y /= b;
   a.z /= b;
@@ -12369,6 +15602,7 @@ occaFunction inline double16& operator /= (      double16 &a, const double &b){
   a.s14 /= b;
   a.s15 /= b;
   return a;
+#endif
 }
 
 #if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_SERIAL || OCCA_USING_OPENMP || OCCA_USING_PTHREADS))
@@ -12398,6 +15632,506 @@ inline std::ostream& operator << (std::ostream &out, const double16& a){
 //======================================
 
 
+//---[ half2 ]--------------------------
+#define OCCA_HALF2 half2
+class half2{
+public:
+  half x;
+  half y;
+
+  inline occaFunction half2() {}
+
+  inline occaFunction half2(const float2 &v) : 
+    x(v.x),
+    y(v.y) {}
+
+  inline occaFunction operator float2 () const {
+    return OCCA_FLOAT2(x,
+                       y);
+  }
+};
+//======================================
+
+
+//---[ half4 ]--------------------------
+#define OCCA_HALF4 half4
+class half4{
+public:
+  half x;
+  half y;
+  half z;
+  half w;
+
+  inline occaFunction half4() {}
+
+#if OCCA_F16C && OCCA_VECTOR_EXTENSIONS
+  inline occaFunction half4(const float4 &v){
+    _mm_storel_epi64((__m128i*) this, _mm_cvtps_ph((__m128) v.v_, 0));
+  }
+
+  inline occaFunction operator float4 () const {
+    return float4((occaSimdFloat4) _mm_cvtph_ps(_mm_loadl_epi64((const __m128i*) this)));
+  }
+#else
+  inline occaFunction half4(const float4 &v) : 
+    x(v.x),
+    y(v.y),
+    z(v.z),
+    w(v.w) {}
+
+  inline occaFunction operator float4 () const {
+    return OCCA_FLOAT4(x,
+                       y,
+                       z,
+                       w);
+  }
+#endif
+};
+//======================================
+
+
+//---[ half3 ]--------------------------
+#define OCCA_HALF3 half3
+typedef half4 half3;
+//======================================
+
+
+//---[ half8 ]--------------------------
+#define OCCA_HALF8 half8
+class half8{
+public:
+  half s0;
+  half s1;
+  half s2;
+  half s3;
+  half s4;
+  half s5;
+  half s6;
+  half s7;
+
+  inline occaFunction half8() {}
+
+#if OCCA_F16C && OCCA_VECTOR_EXTENSIONS
+  inline occaFunction half8(const float8 &v){
+    _mm_storeu_si128((__m128i*) this, _mm256_cvtps_ph((__m256) v.v_, 0));
+  }
+
+  inline occaFunction operator float8 () const {
+    return float8((occaSimdFloat8) _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) this)));
+  }
+#else
+  inline occaFunction half8(const float8 &v) : 
+    s0(v.s0),
+    s1(v.s1),
+    s2(v.s2),
+    s3(v.s3),
+    s4(v.s4),
+    s5(v.s5),
+    s6(v.s6),
+    s7(v.s7) {}
+
+  inline occaFunction operator float8 () const {
+    return OCCA_FLOAT8(s0,
+                       s1,
+                       s2,
+                       s3,
+                       s4,
+                       s5,
+                       s6,
+                       s7);
+  }
+#endif
+};
+//======================================
+
+
+//---[ half16 ]-------------------------
+#define OCCA_HALF16 half16
+class half16{
+public:
+  half s0;
+  half s1;
+  half s2;
+  half s3;
+  half s4;
+  half s5;
+  half s6;
+  half s7;
+  half s8;
+  half s9;
+  half s10;
+  half s11;
+  half s12;
+  half s13;
+  half s14;
+  half s15;
+
+  inline occaFunction half16() {}
+
+#if OCCA_AVX512F && OCCA_VECTOR_EXTENSIONS
+  inline occaFunction half16(const float16 &v){
+    _mm256_storeu_si256((__m256i*) this, _mm512_cvtps_ph((__m512) v.v_, 0));
+  }
+
+  inline occaFunction operator float16 () const {
+    return float16((occaSimdFloat16) _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) this)));
+  }
+#else
+  inline occaFunction half16(const float16 &v) : 
+    s0(v.s0),
+    s1(v.s1),
+    s2(v.s2),
+    s3(v.s3),
+    s4(v.s4),
+    s5(v.s5),
+    s6(v.s6),
+    s7(v.s7),
+    s8(v.s8),
+    s9(v.s9),
+    s10(v.s10),
+    s11(v.s11),
+    s12(v.s12),
+    s13(v.s13),
+    s14(v.s14),
+    s15(v.s15) {}
+
+  inline occaFunction operator float16 () const {
+    return OCCA_FLOAT16(s0,
+                        s1,
+                        s2,
+                        s3,
+                        s4,
+                        s5,
+                        s6,
+                        s7,
+                        s8,
+                        s9,
+                        s10,
+                        s11,
+                        s12,
+                        s13,
+                        s14,
+                        s15);
+  }
+#endif
+};
+//======================================
+
+
+//---[ bfloat16x2 ]---------------------
+#define OCCA_BFLOAT16X2 bfloat16x2
+#if OCCA_VECTOR_EXTENSIONS
+typedef unsigned int occaSimdBits2 __attribute__ ((vector_size(2*sizeof(unsigned int)),
+                                                   aligned(OCCA_SIMD_ALIGN(2*sizeof(unsigned int)))));
+// Loads and stores the entries of bfloat16x2 in place
+typedef unsigned short occaSimdBfloat16x2 __attribute__ ((vector_size(2*sizeof(unsigned short)),
+                                                          aligned(sizeof(unsigned short)), may_alias));
+#endif
+class bfloat16x2{
+public:
+  bfloat16 x;
+  bfloat16 y;
+
+  inline occaFunction bfloat16x2() {}
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction bfloat16x2(const float2 &v){
+    const occaSimdBits2 u   = (occaSimdBits2) v.v_;
+    // All ones in NaN lanes, the subtraction only goes negative for them
+    const occaSimdBits2 nan = (occaSimdBits2) (((occaSimdInt2) (0x7f800000u - (u & 0x7fffffffu))) >> 31);
+    const occaSimdBits2 b   = ((((u + 0x7fffu + ((u >> 16) & 1u)) >> 16) & ~nan) |
+                               (((u >> 16) | 0x40u) & nan));
+
+#  if OCCA_CONVERT_VECTOR
+    *((occaSimdBfloat16x2*) this) = __builtin_convertvector(b, occaSimdBfloat16x2);
+#  else
+    x.bits = (unsigned short) b[0];
+    y.bits = (unsigned short) b[1];
+#  endif
+  }
+
+  inline occaFunction operator float2 () const {
+#  if OCCA_CONVERT_VECTOR
+    const occaSimdBits2 u = __builtin_convertvector(*((const occaSimdBfloat16x2*) this), occaSimdBits2);
+#  else
+    const occaSimdBits2 u = {x.bits, y.bits};
+#  endif
+
+    return float2((occaSimdFloat2) (u << 16));
+  }
+#else
+  inline occaFunction bfloat16x2(const float2 &v) : 
+    x(v.x),
+    y(v.y) {}
+
+  inline occaFunction operator float2 () const {
+    return OCCA_FLOAT2(x,
+                       y);
+  }
+#endif
+};
+//======================================
+
+
+//---[ bfloat16x4 ]---------------------
+#define OCCA_BFLOAT16X4 bfloat16x4
+#if OCCA_VECTOR_EXTENSIONS
+typedef unsigned int occaSimdBits4 __attribute__ ((vector_size(4*sizeof(unsigned int)),
+                                                   aligned(OCCA_SIMD_ALIGN(4*sizeof(unsigned int)))));
+// Loads and stores the entries of bfloat16x4 in place
+typedef unsigned short occaSimdBfloat16x4 __attribute__ ((vector_size(4*sizeof(unsigned short)),
+                                                          aligned(sizeof(unsigned short)), may_alias));
+#endif
+class bfloat16x4{
+public:
+  bfloat16 x;
+  bfloat16 y;
+  bfloat16 z;
+  bfloat16 w;
+
+  inline occaFunction bfloat16x4() {}
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction bfloat16x4(const float4 &v){
+    const occaSimdBits4 u   = (occaSimdBits4) v.v_;
+    // All ones in NaN lanes, the subtraction only goes negative for them
+    const occaSimdBits4 nan = (occaSimdBits4) (((occaSimdInt4) (0x7f800000u - (u & 0x7fffffffu))) >> 31);
+    const occaSimdBits4 b   = ((((u + 0x7fffu + ((u >> 16) & 1u)) >> 16) & ~nan) |
+                               (((u >> 16) | 0x40u) & nan));
+
+#  if OCCA_CONVERT_VECTOR
+    *((occaSimdBfloat16x4*) this) = __builtin_convertvector(b, occaSimdBfloat16x4);
+#  else
+    x.bits = (unsigned short) b[0];
+    y.bits = (unsigned short) b[1];
+    z.bits = (unsigned short) b[2];
+    w.bits = (unsigned short) b[3];
+#  endif
+  }
+
+  inline occaFunction operator float4 () const {
+#  if OCCA_CONVERT_VECTOR
+    const occaSimdBits4 u = __builtin_convertvector(*((const occaSimdBfloat16x4*) this), occaSimdBits4);
+#  else
+    const occaSimdBits4 u = {x.bits, y.bits, z.bits, w.bits};
+#  endif
+
+    return float4((occaSimdFloat4) (u << 16));
+  }
+#else
+  inline occaFunction bfloat16x4(const float4 &v) : 
+    x(v.x),
+    y(v.y),
+    z(v.z),
+    w(v.w) {}
+
+  inline occaFunction operator float4 () const {
+    return OCCA_FLOAT4(x,
+                       y,
+                       z,
+                       w);
+  }
+#endif
+};
+//======================================
+
+
+//---[ bfloat16x3 ]---------------------
+#define OCCA_BFLOAT16X3 bfloat16x3
+typedef bfloat16x4 bfloat16x3;
+//======================================
+
+
+//---[ bfloat16x8 ]---------------------
+#define OCCA_BFLOAT16X8 bfloat16x8
+#if OCCA_VECTOR_EXTENSIONS
+typedef unsigned int occaSimdBits8 __attribute__ ((vector_size(8*sizeof(unsigned int)),
+                                                   aligned(OCCA_SIMD_ALIGN(8*sizeof(unsigned int)))));
+// Loads and stores the entries of bfloat16x8 in place
+typedef unsigned short occaSimdBfloat16x8 __attribute__ ((vector_size(8*sizeof(unsigned short)),
+                                                          aligned(sizeof(unsigned short)), may_alias));
+#endif
+class bfloat16x8{
+public:
+  bfloat16 s0;
+  bfloat16 s1;
+  bfloat16 s2;
+  bfloat16 s3;
+  bfloat16 s4;
+  bfloat16 s5;
+  bfloat16 s6;
+  bfloat16 s7;
+
+  inline occaFunction bfloat16x8() {}
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction bfloat16x8(const float8 &v){
+    const occaSimdBits8 u   = (occaSimdBits8) v.v_;
+    // All ones in NaN lanes, the subtraction only goes negative for them
+    const occaSimdBits8 nan = (occaSimdBits8) (((occaSimdInt8) (0x7f800000u - (u & 0x7fffffffu))) >> 31);
+    const occaSimdBits8 b   = ((((u + 0x7fffu + ((u >> 16) & 1u)) >> 16) & ~nan) |
+                               (((u >> 16) | 0x40u) & nan));
+
+#  if OCCA_CONVERT_VECTOR
+    *((occaSimdBfloat16x8*) this) = __builtin_convertvector(b, occaSimdBfloat16x8);
+#  else
+    s0.bits = (unsigned short) b[0];
+    s1.bits = (unsigned short) b[1];
+    s2.bits = (unsigned short) b[2];
+    s3.bits = (unsigned short) b[3];
+    s4.bits = (unsigned short) b[4];
+    s5.bits = (unsigned short) b[5];
+    s6.bits = (unsigned short) b[6];
+    s7.bits = (unsigned short) b[7];
+#  endif
+  }
+
+  inline occaFunction operator float8 () const {
+#  if OCCA_CONVERT_VECTOR
+    const occaSimdBits8 u = __builtin_convertvector(*((const occaSimdBfloat16x8*) this), occaSimdBits8);
+#  else
+    const occaSimdBits8 u = {s0.bits, s1.bits, s2.bits, s3.bits, s4.bits, s5.bits, s6.bits, s7.bits};
+#  endif
+
+    return float8((occaSimdFloat8) (u << 16));
+  }
+#else
+  inline occaFunction bfloat16x8(const float8 &v) : 
+    s0(v.s0),
+    s1(v.s1),
+    s2(v.s2),
+    s3(v.s3),
+    s4(v.s4),
+    s5(v.s5),
+    s6(v.s6),
+    s7(v.s7) {}
+
+  inline occaFunction operator float8 () const {
+    return OCCA_FLOAT8(s0,
+                       s1,
+                       s2,
+                       s3,
+                       s4,
+                       s5,
+                       s6,
+                       s7);
+  }
+#endif
+};
+//======================================
+
+
+//---[ bfloat16x16 ]--------------------
+#define OCCA_BFLOAT16X16 bfloat16x16
+#if OCCA_VECTOR_EXTENSIONS
+typedef unsigned int occaSimdBits16 __attribute__ ((vector_size(16*sizeof(unsigned int)),
+                                                    aligned(OCCA_SIMD_ALIGN(16*sizeof(unsigned int)))));
+// Loads and stores the entries of bfloat16x16 in place
+typedef unsigned short occaSimdBfloat16x16 __attribute__ ((vector_size(16*sizeof(unsigned short)),
+                                                           aligned(sizeof(unsigned short)), may_alias));
+#endif
+class bfloat16x16{
+public:
+  bfloat16 s0;
+  bfloat16 s1;
+  bfloat16 s2;
+  bfloat16 s3;
+  bfloat16 s4;
+  bfloat16 s5;
+  bfloat16 s6;
+  bfloat16 s7;
+  bfloat16 s8;
+  bfloat16 s9;
+  bfloat16 s10;
+  bfloat16 s11;
+  bfloat16 s12;
+  bfloat16 s13;
+  bfloat16 s14;
+  bfloat16 s15;
+
+  inline occaFunction bfloat16x16() {}
+
+#if OCCA_VECTOR_EXTENSIONS
+  inline occaFunction bfloat16x16(const float16 &v){
+    const occaSimdBits16 u   = (occaSimdBits16) v.v_;
+    // All ones in NaN lanes, the subtraction only goes negative for them
+    const occaSimdBits16 nan = (occaSimdBits16) (((occaSimdInt16) (0x7f800000u - (u & 0x7fffffffu))) >> 31);
+    const occaSimdBits16 b   = ((((u + 0x7fffu + ((u >> 16) & 1u)) >> 16) & ~nan) |
+                                (((u >> 16) | 0x40u) & nan));
+
+#  if OCCA_CONVERT_VECTOR
+    *((occaSimdBfloat16x16*) this) = __builtin_convertvector(b, occaSimdBfloat16x16);
+#  else
+    s0.bits = (unsigned short) b[0];
+    s1.bits = (unsigned short) b[1];
+    s2.bits = (unsigned short) b[2];
+    s3.bits = (unsigned short) b[3];
+    s4.bits = (unsigned short) b[4];
+    s5.bits = (unsigned short) b[5];
+    s6.bits = (unsigned short) b[6];
+    s7.bits = (unsigned short) b[7];
+    s8.bits = (unsigned short) b[8];
+    s9.bits = (unsigned short) b[9];
+    s10.bits = (unsigned short) b[10];
+    s11.bits = (unsigned short) b[11];
+    s12.bits = (unsigned short) b[12];
+    s13.bits = (unsigned short) b[13];
+    s14.bits = (unsigned short) b[14];
+    s15.bits = (unsigned short) b[15];
+#  endif
+  }
+
+  inline occaFunction operator float16 () const {
+#  if OCCA_CONVERT_VECTOR
+    const occaSimdBits16 u = __builtin_convertvector(*((const occaSimdBfloat16x16*) this), occaSimdBits16);
+#  else
+    const occaSimdBits16 u = {s0.bits, s1.bits, s2.bits, s3.bits, s4.bits, s5.bits, s6.bits, s7.bits, s8.bits, s9.bits, s10.bits, s11.bits, s12.bits, s13.bits, s14.bits, s15.bits};
+#  endif
+
+    return float16((occaSimdFloat16) (u << 16));
+  }
+#else
+  inline occaFunction bfloat16x16(const float16 &v) : 
+    s0(v.s0),
+    s1(v.s1),
+    s2(v.s2),
+    s3(v.s3),
+    s4(v.s4),
+    s5(v.s5),
+    s6(v.s6),
+    s7(v.s7),
+    s8(v.s8),
+    s9(v.s9),
+    s10(v.s10),
+    s11(v.s11),
+    s12(v.s12),
+    s13(v.s13),
+    s14(v.s14),
+    s15(v.s15) {}
+
+  inline occaFunction operator float16 () const {
+    return OCCA_FLOAT16(s0,
+                        s1,
+                        s2,
+                        s3,
+                        s4,
+                        s5,
+                        s6,
+                        s7,
+                        s8,
+                        s9,
+                        s10,
+                        s11,
+                        s12,
+                        s13,
+                        s14,
+                        s15);
+  }
+#endif
+};
+//======================================
+
+
 #  ifndef OCCA_IN_KERNEL
 }
 #  endif
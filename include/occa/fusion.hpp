@@ -0,0 +1,70 @@
+#ifndef OCCA_FUSION_HEADER
+#define OCCA_FUSION_HEADER
+
+#include "occa/tools.hpp"
+#include "occa/base.hpp"
+
+namespace occa {
+  //---[ Kernel Fusion ]--------------------------
+  //  [kernelSequence] records kernel launches and runs consecutive
+  //    launches of kernels built from the same OKL/OFL source and
+  //    kernelInfo as one fused kernel:
+  //
+  //      occa::kernelSequence sequence;
+  //
+  //      sequence.add(scale).addArgument(entries).addArgument(o_a) ...
+  //      sequence.add(axpy) .addArgument(entries).addArgument(o_b) ...
+  //
+  //      sequence.run();
+  //
+  //  Memory and values passed to more than one launch become one
+  //    argument of the fused kernel. Launches with the same loop nest
+  //    whose shared arrays are only accessed at the same index share
+  //    one loop nest, the others stay separate inner kernels
+  //
+  //  Fused kernels are kept for each launch pattern until free(),
+  //    clear() only removes the recorded launches
+  class kernelSequence {
+  public:
+    std::vector<kernel> kernels;
+    std::vector<std::vector<kernelArg> > arguments;
+
+    std::map<std::string, kernel> fusedKernels;
+
+    kernelSequence();
+
+    kernelSequence& add(kernel k);
+    kernelSequence& add(kernel k,
+                        const std::vector<kernelArg> &args);
+
+    // Adds an argument to the last kernel added
+    kernelSequence& addArgument(const kernelArg &arg);
+
+    int size() const;
+    void clear();
+
+    void run();
+
+    void free();
+
+    static bool canFuse(kernel &a, kernel &b);
+
+    ///
+    /// Returns the fused kernel for launches [start, end) and
+    /// stores its arguments in [fusedArgs]
+    ///
+    kernel fuse(const int start, const int end,
+                std::vector<kernelArg> &fusedArgs);
+
+    // Arguments with the same key are passed as one fused argument
+    static std::string argumentKey(const kernelArg &arg);
+
+    static occa::device buildDevice(kernel &k);
+
+    static void runWithArguments(kernel &k,
+                                 const std::vector<kernelArg> &args);
+  };
+  //==============================================
+}
+
+#endif
@@ -0,0 +1,205 @@
+#ifndef OCCA_HALF_HEADER
+#define OCCA_HALF_HEADER
+
+#if (!defined(OCCA_IN_KERNEL) || (!OCCA_USING_OPENCL))
+#  include <cstddef>
+#  include <limits>
+
+#  include "occa/defines.hpp"
+
+#  if OCCA_F16C && !defined(__CUDACC__)
+#    include <immintrin.h>
+#  endif
+
+#  ifndef OCCA_IN_KERNEL
+#    ifndef occaFunction
+#      define occaFunction
+#    endif
+namespace occa {
+#  endif
+
+//---[ Half Types ]---------------------
+//  16-bit storage types for bandwidth-bound kernels, math on them
+//    happens in float through their conversions
+//
+//    half     : IEEE binary16, F16C converts them when the compiler
+//               targets it
+//    bfloat16 : The top half of a float, same range and 8 bits
+//               of mantissa
+//
+//  Conversions from float round to nearest even
+union occaFloatBits_t {
+  float f;
+  unsigned int u;
+};
+
+occaFunction inline unsigned short occaFloatToHalfBits(const float f){
+#if OCCA_F16C && !defined(__CUDACC__)
+  return (unsigned short) _cvtss_sh(f, 0);
+#else
+  occaFloatBits_t v;
+  v.f = f;
+
+  const unsigned int sign = (v.u & 0x80000000u);
+  v.u ^= sign;
+
+  unsigned int bits;
+
+  // Inf or NaN, values past 65520 round to Inf below
+  if(v.u >= (143u << 23)){
+    bits = ((v.u > (255u << 23)) ? 0x7e00 : 0x7c00);
+  }
+  // Subnormal or zero, the float add rounds the mantissa
+  else if(v.u < (113u << 23)){
+    occaFloatBits_t magic;
+    magic.u = (126u << 23);
+
+    v.f += magic.f;
+    bits = (v.u - magic.u);
+  }
+  else {
+    const unsigned int mantissaIsOdd = ((v.u >> 13) & 1);
+
+    v.u += ((unsigned int) (15 - 127) << 23) + 0xfff + mantissaIsOdd;
+    bits = (v.u >> 13);
+  }
+
+  return (unsigned short) (bits | (sign >> 16));
+#endif
+}
+
+occaFunction inline float occaHalfBitsToFloat(const unsigned short h){
+#if OCCA_F16C && !defined(__CUDACC__)
+  return _cvtsh_ss(h);
+#else
+  const unsigned int shiftedExp = (0x7c00u << 13);
+
+  occaFloatBits_t v;
+  v.u = ((h & 0x7fffu) << 13);
+
+  const unsigned int exp = (v.u & shiftedExp);
+  v.u += ((unsigned int) (127 - 15) << 23);
+
+  // Inf or NaN
+  if(exp == shiftedExp){
+    v.u += ((unsigned int) (128 - 16) << 23);
+  }
+  // Subnormal or zero
+  else if(exp == 0){
+    occaFloatBits_t magic;
+    magic.u = (113u << 23);
+
+    v.u += (1u << 23);
+    v.f -= magic.f;
+  }
+
+  v.u |= ((h & 0x8000u) << 16);
+
+  return v.f;
+#endif
+}
+
+occaFunction inline unsigned short occaFloatToBfloat16Bits(const float f){
+  occaFloatBits_t v;
+  v.f = f;
+
+  // Keep NaNs quiet instead of rounding them to Inf
+  if((v.u & 0x7fffffffu) > 0x7f800000u)
+    return (unsigned short) ((v.u >> 16) | 0x40);
+
+  return (unsigned short) ((v.u + 0x7fffu + ((v.u >> 16) & 1)) >> 16);
+}
+
+occaFunction inline float occaBfloat16BitsToFloat(const unsigned short b){
+  occaFloatBits_t v;
+  v.u = ((unsigned int) b << 16);
+
+  return v.f;
+}
+
+#define OCCA_DEFINE_HALF_TYPE(TYPE, TO_BITS, TO_FLOAT)                  \
+  class TYPE {                                                          \
+  public:                                                               \
+    unsigned short bits;                                                \
+                                                                        \
+    inline occaFunction TYPE() :                                        \
+      bits(0) {}                                                        \
+                                                                        \
+    inline occaFunction TYPE(const float f) :                           \
+      bits(TO_BITS(f)) {}                                               \
+                                                                        \
+    static inline occaFunction TYPE fromBits(const unsigned short b){   \
+      TYPE ret;                                                         \
+      ret.bits = b;                                                     \
+      return ret;                                                       \
+    }                                                                   \
+                                                                        \
+    inline occaFunction operator float () const {                       \
+      return TO_FLOAT(bits);                                            \
+    }                                                                   \
+                                                                        \
+    inline occaFunction TYPE& operator += (const float f){              \
+      bits = TO_BITS(TO_FLOAT(bits) + f);                               \
+      return *this;                                                     \
+    }                                                                   \
+                                                                        \
+    inline occaFunction TYPE& operator -= (const float f){              \
+      bits = TO_BITS(TO_FLOAT(bits) - f);                               \
+      return *this;                                                     \
+    }                                                                   \
+                                                                        \
+    inline occaFunction TYPE& operator *= (const float f){              \
+      bits = TO_BITS(TO_FLOAT(bits) * f);                               \
+      return *this;                                                     \
+    }                                                                   \
+                                                                        \
+    inline occaFunction TYPE& operator /= (const float f){              \
+      bits = TO_BITS(TO_FLOAT(bits) / f);                               \
+      return *this;                                                     \
+    }                                                                   \
+  }
+
+OCCA_DEFINE_HALF_TYPE(half    , occaFloatToHalfBits    , occaHalfBitsToFloat);
+OCCA_DEFINE_HALF_TYPE(bfloat16, occaFloatToBfloat16Bits, occaBfloat16BitsToFloat);
+
+#undef OCCA_DEFINE_HALF_TYPE
+//======================================
+
+#  ifndef OCCA_IN_KERNEL
+  //---[ Host Conversions ]-------------
+  //  Use F16C when the CPU has it, even if the library wasn't
+  //    built for it
+  void floatToHalf(const float *in, half *out, const size_t entries);
+  void halfToFloat(const half *in, float *out, const size_t entries);
+
+  void floatToBfloat16(const float *in, bfloat16 *out, const size_t entries);
+  void bfloat16ToFloat(const bfloat16 *in, float *out, const size_t entries);
+  //====================================
+}
+
+namespace std {
+#define OCCA_HALF_NUMERIC_LIMITS(TYPE, DIGITS, MIN, MAX, EPSILON)       \
+  template <> class numeric_limits<occa::TYPE> {                        \
+  public:                                                               \
+    static const bool is_specialized = true;                            \
+    static const bool is_signed      = true;                            \
+    static const bool is_integer     = false;                           \
+    static const bool has_infinity   = true;                            \
+    static const int  digits         = DIGITS;                          \
+                                                                        \
+    static occa::TYPE min()      { return occa::TYPE::fromBits(MIN); }  \
+    static occa::TYPE max()      { return occa::TYPE::fromBits(MAX); }  \
+    static occa::TYPE epsilon()  { return occa::TYPE::fromBits(EPSILON); } \
+    static occa::TYPE infinity() { return occa::TYPE::fromBits((MAX) + 1); } \
+  }
+
+  OCCA_HALF_NUMERIC_LIMITS(half    , 11, 0x0400, 0x7bff, 0x1400);
+  OCCA_HALF_NUMERIC_LIMITS(bfloat16,  8, 0x0080, 0x7f7f, 0x3c00);
+
+#undef OCCA_HALF_NUMERIC_LIMITS
+}
+#  endif
+
+#endif
+
+#endif
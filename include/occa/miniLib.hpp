@@ -1,4 +1,8 @@
+#ifndef OCCA_MINILIB_HEADER
+#define OCCA_MINILIB_HEADER
+
 #include "occa/base.hpp"
+#include "occa/reduction.hpp"
 
 namespace occa {
   // [--] Add uintptr_t support to occa::kernels
@@ -6,7 +10,7 @@ namespace occa {
   template <class TM>
   void memset(void *ptr, const TM &value, uintptr_t count){
     OCCA_CHECK(false,
-               "memset is only implemented for POD-type data (bool, char, short, int, long, float, double)");
+               "memset is only implemented for POD-type data (bool, char, short, int, long, float, double, half, bfloat16)");
   }
 
   template <>
@@ -29,4 +33,324 @@ namespace occa {
 
   template <>
   void memset<double>(void *ptr, const double &value, uintptr_t count);
+
+  template <>
+  void memset<half>(void *ptr, const half &value, uintptr_t count);
+
+  template <>
+  void memset<bfloat16>(void *ptr, const bfloat16 &value, uintptr_t count);
+
+  //---[ Primitives ]-----------------------------
+  //  Scans, compaction and radix sort of device memory
+  //
+  //      occa::exclusiveScan<int>(o_counts, o_offsets);
+  //
+  //      const uintptr_t kept = occa::copyIf<float>(o_x, o_y, "0 < x");
+  //
+  //      occa::radixSort<int, float>(o_keys, o_values);
+  //
+  //  Kernels are built once per device and type:
+  //    - Every outer iteration owns one contiguous chunk, CPU modes
+  //      run one chunk per thread like reductions
+  //    - A one-group launch scans the chunk totals and each chunk
+  //      then writes its entries starting at its offset
+  //  Compaction and sorting are stable
+  namespace miniLib {
+    static const int radixBits    = 8;
+    static const int radixBuckets = (1 << radixBits);
+
+    void scan(occa::memory in,
+              occa::memory out,
+              const std::string &type,
+              const size_t typeBytes,
+              const bool inclusive,
+              const uintptr_t entries);
+
+    ///
+    /// Copies the entries [x] (at index [i]) of [in] for which
+    /// [predicate] holds to the front of [out] and returns how many
+    /// were copied, [flag] holds the int flags[i] if [usesFlags]
+    ///
+    uintptr_t copyIf(occa::memory in,
+                     occa::memory flags,
+                     occa::memory out,
+                     const std::string &type,
+                     const size_t typeBytes,
+                     const std::string &predicate,
+                     const bool usesFlags,
+                     const uintptr_t entries);
+
+    ///
+    /// Sorts [keys] in increasing order through their bits, [keyKind]
+    /// is 'u', 'i' or 'f' for unsigned, signed or floating point keys.
+    /// [values] are moved with their keys if [valueBytes] is not 0
+    ///
+    void radixSort(occa::memory keys,
+                   occa::memory values,
+                   const char keyKind,
+                   const size_t keyBytes,
+                   const size_t valueBytes,
+                   const uintptr_t entries);
+
+    //---[ Memory ]-------------------
+    ///
+    /// Sets [entries] entries of [out] to [value], [out] is a
+    /// memory or a pointer argument
+    ///
+    void fill(occa::device device,
+              const kernelArg &out,
+              const std::string &type,
+              const kernelArg &value,
+              const uintptr_t entries);
+
+    // Repeats the first [patternEntries] entries of [pattern]
+    void fill(occa::memory out,
+              occa::memory pattern,
+              const std::string &type,
+              const uintptr_t patternEntries,
+              const uintptr_t entries);
+
+    // out[i] = start + i*step
+    void iota(occa::memory out,
+              const std::string &type,
+              const kernelArg &start,
+              const kernelArg &step,
+              const uintptr_t entries);
+
+    ///
+    /// Copies a [width] x [height] x [depth] block of [typeBytes]
+    /// entries, rows start [pitch] entries apart and slices
+    /// [slicePitch] entries apart
+    ///
+    void copy3D(occa::memory dest,
+                occa::memory src,
+                const size_t typeBytes,
+                const uintptr_t width,
+                const uintptr_t height,
+                const uintptr_t depth,
+                const uintptr_t destOffset,
+                const uintptr_t destPitch,
+                const uintptr_t destSlicePitch,
+                const uintptr_t srcOffset,
+                const uintptr_t srcPitch,
+                const uintptr_t srcSlicePitch);
+
+    // out[i] = in[indices[i]] with int [indices]
+    void gather(occa::memory in,
+                occa::memory indices,
+                occa::memory out,
+                const std::string &type,
+                const uintptr_t entries);
+
+    ///
+    /// out[indices[i]] = in[i], or += atomically if [add]. Indices
+    /// must be unique unless they are added
+    ///
+    void scatter(occa::memory in,
+                 occa::memory indices,
+                 occa::memory out,
+                 const std::string &type,
+                 const bool add,
+                 const uintptr_t entries);
+
+    // Builds [source] once per device and [key], other library
+    //   kernels share the cache with the primitives
+    kernel cachedKernel(occa::device device,
+                        const std::string &key,
+                        const std::string &source,
+                        const std::string &name);
+
+    // Frees the cached kernels and partials, device::free()
+    //   frees the ones of its device
+    void free(occa::device device);
+    void free();
+
+    template <class TM> struct radixKey_t;
+
+#define OCCA_RADIX_KEY(TYPE, KIND)                                    \
+    template <> struct radixKey_t<TYPE> {                             \
+      static const char kind = KIND;                                  \
+    }
+
+    OCCA_RADIX_KEY(int          , 'i');
+    OCCA_RADIX_KEY(unsigned int , 'u');
+    OCCA_RADIX_KEY(long         , 'i');
+    OCCA_RADIX_KEY(unsigned long, 'u');
+    OCCA_RADIX_KEY(float        , 'f');
+    OCCA_RADIX_KEY(double       , 'f');
+
+#undef OCCA_RADIX_KEY
+  }
+
+  // [out] can be [in]
+  template <class TM>
+  void exclusiveScan(occa::memory in,
+                     occa::memory out,
+                     const uintptr_t entries = 0){
+    miniLib::scan(in, out,
+                  reduction::type_t<TM>::name(), sizeof(TM),
+                  false,
+                  reduction::entriesIn<TM>(in, entries));
+  }
+
+  template <class TM>
+  void inclusiveScan(occa::memory in,
+                     occa::memory out,
+                     const uintptr_t entries = 0){
+    miniLib::scan(in, out,
+                  reduction::type_t<TM>::name(), sizeof(TM),
+                  true,
+                  reduction::entriesIn<TM>(in, entries));
+  }
+
+  template <class TM>
+  uintptr_t copyIf(occa::memory in,
+                   occa::memory out,
+                   const std::string &predicate,
+                   const uintptr_t entries = 0){
+    return miniLib::copyIf(in, in, out,
+                           reduction::type_t<TM>::name(), sizeof(TM),
+                           predicate, false,
+                           reduction::entriesIn<TM>(in, entries));
+  }
+
+  // Keeps the entries with non-zero int [flags]
+  template <class TM>
+  uintptr_t compact(occa::memory in,
+                    occa::memory flags,
+                    occa::memory out,
+                    const uintptr_t entries = 0){
+    return miniLib::copyIf(in, flags, out,
+                           reduction::type_t<TM>::name(), sizeof(TM),
+                           "flag != 0", true,
+                           reduction::entriesIn<TM>(in, entries));
+  }
+
+  template <class TM>
+  void radixSort(occa::memory keys,
+                 const uintptr_t entries = 0){
+    miniLib::radixSort(keys, keys,
+                       miniLib::radixKey_t<TM>::kind, sizeof(TM),
+                       0,
+                       reduction::entriesIn<TM>(keys, entries));
+  }
+
+  // [TM2] values are moved as 4 or 8 byte words
+  template <class TM, class TM2>
+  void radixSort(occa::memory keys,
+                 occa::memory values,
+                 const uintptr_t entries = 0){
+    miniLib::radixSort(keys, values,
+                       miniLib::radixKey_t<TM>::kind, sizeof(TM),
+                       sizeof(TM2),
+                       reduction::entriesIn<TM>(keys, entries));
+  }
+  //==============================================
+
+  //---[ Memory Primitives ]----------------------
+  //  Fills, strided copies, gathers and scatters of device memory,
+  //    kernels are generated per type and share the primitives'
+  //    per-device cache
+  //
+  //      // Pack the x = 0 face of an nx x ny x nz block
+  //      occa::copy3D<double>(o_halo, o_u,
+  //                           1, ny, nz,
+  //                           1, ny,
+  //                           nx, nx*ny);
+  template <class TM>
+  void fill(occa::memory out,
+            const TM &value,
+            const uintptr_t entries = 0){
+    miniLib::fill(occa::device(out.getDHandle()), out,
+                  reduction::type_t<TM>::name(), value,
+                  reduction::entriesIn<TM>(out, entries));
+  }
+
+  template <class TM>
+  void fill(occa::memory out,
+            occa::memory pattern,
+            const uintptr_t patternEntries,
+            const uintptr_t entries = 0){
+    miniLib::fill(out, pattern,
+                  reduction::type_t<TM>::name(),
+                  patternEntries,
+                  reduction::entriesIn<TM>(out, entries));
+  }
+
+  template <class TM>
+  void iota(occa::memory out,
+            const TM &start = 0,
+            const TM &step = 1,
+            const uintptr_t entries = 0){
+    miniLib::iota(out,
+                  reduction::type_t<TM>::name(), start, step,
+                  reduction::entriesIn<TM>(out, entries));
+  }
+
+  // Pitches and offsets count entries
+  template <class TM>
+  void copy2D(occa::memory dest,
+              occa::memory src,
+              const uintptr_t width,
+              const uintptr_t height,
+              const uintptr_t destPitch,
+              const uintptr_t srcPitch,
+              const uintptr_t destOffset = 0,
+              const uintptr_t srcOffset = 0){
+    miniLib::copy3D(dest, src, sizeof(TM),
+                    width, height, 1,
+                    destOffset, destPitch, destPitch*height,
+                    srcOffset , srcPitch , srcPitch*height);
+  }
+
+  template <class TM>
+  void copy3D(occa::memory dest,
+              occa::memory src,
+              const uintptr_t width,
+              const uintptr_t height,
+              const uintptr_t depth,
+              const uintptr_t destPitch,
+              const uintptr_t destSlicePitch,
+              const uintptr_t srcPitch,
+              const uintptr_t srcSlicePitch,
+              const uintptr_t destOffset = 0,
+              const uintptr_t srcOffset = 0){
+    miniLib::copy3D(dest, src, sizeof(TM),
+                    width, height, depth,
+                    destOffset, destPitch, destSlicePitch,
+                    srcOffset , srcPitch , srcSlicePitch);
+  }
+
+  template <class TM>
+  void gather(occa::memory in,
+              occa::memory indices,
+              occa::memory out,
+              const uintptr_t entries = 0){
+    miniLib::gather(in, indices, out,
+                    reduction::type_t<TM>::name(),
+                    reduction::entriesIn<int>(indices, entries));
+  }
+
+  template <class TM>
+  void scatter(occa::memory in,
+               occa::memory indices,
+               occa::memory out,
+               const uintptr_t entries = 0){
+    miniLib::scatter(in, indices, out,
+                     reduction::type_t<TM>::name(), false,
+                     reduction::entriesIn<int>(indices, entries));
+  }
+
+  template <class TM>
+  void scatterAdd(occa::memory in,
+                  occa::memory indices,
+                  occa::memory out,
+                  const uintptr_t entries = 0){
+    miniLib::scatter(in, indices, out,
+                     reduction::type_t<TM>::name(), true,
+                     reduction::entriesIn<int>(indices, entries));
+  }
+  //==============================================
 }
+
+#endif
@@ -7,6 +7,7 @@
 #include <vector>
 #include <stack>
 #include <map>
+#include <set>
 
 #include <string.h>
 #include <stdlib.h>
@@ -128,6 +129,10 @@ namespace occa {
   typedef varToVarMap_t::iterator                           varToVarMapIterator;
   typedef varToVarMap_t::const_iterator                     cVarToVarMapIterator;
 
+  typedef std::map<parserNS::varInfo*,std::string>          varToStrMap_t;
+  typedef varToStrMap_t::iterator                           varToStrMapIterator;
+  typedef varToStrMap_t::const_iterator                     cVarToStrMapIterator;
+
   typedef std::map<parserNS::statement*,int>                statementIdMap_t;
   typedef statementIdMap_t::iterator                        statementIdMapIterator;
 
@@ -32,6 +32,7 @@ namespace occa {
       static const int schrodinger = (isExecuted | isIgnored); // hehe
 
       static const int hasLCD       = (1 << 2);
+      static const int isCanonical  = (1 << 3);
 
       // Return Info
       static const int didntChange = 0;
@@ -291,12 +292,32 @@ namespace occa {
       bool statementHasLCD(statement &s);
     };
 
+    //  Array entries read or written in a loop, checked for
+    //    loop-carried dependencies before the loop is labeled
+    class arrayAccess_t {
+    public:
+      varInfo *var;
+      statement *s;
+      expVector_t indices;
+      bool isWrite;
+
+      arrayAccess_t();
+
+      std::string indexStr() const;
+    };
+
+    typedef std::vector<arrayAccess_t> arrayAccessVector_t;
+
     class magician {
     public:
       parserBase &parser;
       statement &globalScope;
 
-      intVector_t testedTileSizes;
+      // Loops without parallel inner loops are tiled
+      std::string tileSize;
+
+      std::string kernelName;
+      std::stringstream report;
 
       infoDB_t db;
 
@@ -331,29 +352,43 @@ namespace occa {
 
       bool statementGuaranteesBreak(statement &s);
 
-      statementNode* generatePossibleKernels(statement &kernel);
-      void storeInnerLoopCandidates(statementVector_t &loopsVec,
-                                    intVector_t &depthVec,
-                                    int outerLoopIdx,
-                                    int innerLoopIdx,
-                                    intVector_t &innerLoopVec);
-      void storeNextDepthLoops(statementVector_t &loopsVec,
-                               intVector_t &depthVec,
-                               int loopIdx,
-                               intVector_t &ndLoopsVec);
-      bool nestedLoopHasSameBounds(statementVector_t &loopsVec,
-                                   intVector_t &depthVec,
-                                   int ndLoopIdx,
-                                   iteratorInfo_t &iteratorInfo,
-                                   intVector_t &innerLoopVec,
-                                   const bool isFirstCall = true);
-      statementNode* generateKernelsAndLabelLoops(statementVector_t &loopsVec,
-                                                  intVector_t &depthVec,
-                                                  intVector_t &outerLoopVec,
-                                                  intVecVector_t &innerLoopVec);
-      void storeLoopsAndDepths(statement &s,
-                               statementVector_t &loopsVec,
-                               intVector_t &depthVec, int depth);
+      //---[ Loop Labeling ]------------
+      void labelLoops(statement &s);
+
+      std::string reasonLoopIsSerial(statement &s);
+      bool loopCarriesDependency(statement &loop, std::string &reason);
+
+      bool storeArrayAccesses(statement &s,
+                              arrayAccessVector_t &accesses,
+                              std::vector<varInfo*> &writtenVars);
+      bool storeArrayAccesses(statement &s,
+                              expNode &e,
+                              const bool isRead,
+                              const bool isWrite,
+                              arrayAccessVector_t &accesses,
+                              std::vector<varInfo*> &writtenVars);
+
+      void storeNestedIterators(statement &s,
+                                std::vector<varInfo*> &iterators);
+
+      bool variableIsDeclaredIn(statement &loop,
+                                statement &s,
+                                varInfo &var);
+
+      bool loopSetsOuterScalar(statement &loop,
+                               statement &s,
+                               std::string &varName);
+      bool loopExitsEarly(statement &s, const bool inNestedLoop = false);
+
+      bool storeInnerLoops(statement &outerLoop,
+                           statementVector_t &innerLoops);
+
+      varInfo* loopIterator(statement &s);
+      bool statementUsesVariable(statement &s, varInfo &var);
+
+      void tagLoop(statement &s, const std::string &tag);
+      void addToReport(statement &s, const std::string &message);
+      //================================
 
       iteratorInfo_t iteratorLoopBounds(statement &s);
       void updateLoopBounds(statement &s);
@@ -374,6 +409,8 @@ namespace occa {
 
       void addExpressionRead(expNode &e);
 
+      viInfo_t& getViInfo(varInfo &var);
+
       //---[ Helper Functions ]---------
       static void placeAddedExps(infoDB_t &db, expNode &e, expVector_t &sumNodes);
       static void placeMultExps(infoDB_t &db, expNode &e, expVector_t &sumNodes);
@@ -17,6 +17,37 @@ namespace occa {
 
     extern intVector_t loadedLanguageVec;
 
+    //  Kernel launched in a sequence fused by [parserBase::fuseKernels]
+    class fusionKernel_t {
+    public:
+      statement *sKernel;
+
+      // Fused argument position of each kernel argument
+      intVector_t argPos;
+      std::map<varInfo*, int> argMap;
+
+      // Outer and inner loops (outermost first) if the kernel
+      //   is one loop nest that can be merged with others
+      statementVector_t loops;
+
+      // Copies of arguments the kernel writes to
+      std::string argCopies;
+
+      fusionKernel_t();
+    };
+
+    //  Accesses to a fused argument from kernels in a merged loop nest
+    class fusionAccess_t {
+    public:
+      std::set<std::string> indices;
+      std::set<int> kernels;
+      bool isWritten;
+
+      fusionAccess_t();
+    };
+
+    typedef std::map<int, fusionAccess_t> fusionAccessMap_t;
+
     int loadedLanguage();
 
     void pushLanguage(const int language);
@@ -45,6 +76,7 @@ namespace occa {
       varOriginMap_t varOriginMap;
 
       kernelInfoMap_t kernelInfoMap;
+      std::map<std::string, kernelCostInfo> kernelCostMap;
 
       statement *globalScope;
 
@@ -217,6 +249,8 @@ namespace occa {
                                             statementVector_t &omLoops,
                                             varOriginMapVector_t &varDeps);
 
+      int perfectlyNestOuterLoops(statement &omLoop);
+
       void addDepStatementsToKernel(statement &sKernel,
                                     varOriginMap_t &deps);
 
@@ -238,6 +272,72 @@ namespace occa {
       void addNestedKernelArgTo(statement &sKernel);
       //   =============================
 
+      //   ---[ Cost Estimation ]-------
+      void estimateKernelCosts();
+
+      void estimateCostsFor(statement &s,
+                            varInfo &kernelVar,
+                            const std::string &iterations,
+                            kernelCostInfo &cost,
+                            int *counts);
+
+      std::string getLoopIterations(statement &s,
+                                    varInfo &kernelVar);
+
+      void estimateExpCosts(expNode &e,
+                            varInfo &kernelVar,
+                            int *counts);
+      //   =============================
+
+      //   ---[ Specialization ]--------
+      void specializeKernelArguments();
+
+      void specializeArgumentsIn(statement &s,
+                                 varToStrMap_t &argValues);
+      //   =============================
+
+      //   ---[ Kernel Fusion ]---------
+      void fuseKernels();
+
+      void loadFusionKernel(fusionKernel_t &fk,
+                            const std::string &fusionInfo);
+
+      bool storeFusionLoopNest(fusionKernel_t &fk);
+
+      bool canMergeLoopNests(std::vector<fusionKernel_t*> &group,
+                             fusionKernel_t &fk,
+                             varToStrMap_t &originalNames);
+
+      static varInfo* fusionLoopIterator(statement &s);
+      static std::string fusionLoopTag(statement &s);
+      void setFusionLoopTags(statement &s,
+                             const bool showTags);
+
+      void storeFusionAccesses(statement &s,
+                               fusionKernel_t &fk,
+                               const int kernelPos,
+                               fusionAccessMap_t &accesses);
+
+      void storeFusionAccesses(expNode &e,
+                               fusionKernel_t &fk,
+                               const int kernelPos,
+                               const bool isWrite,
+                               fusionAccessMap_t &accesses);
+
+      bool fusionIndexIsKnown(expNode &e,
+                              fusionKernel_t &fk);
+
+      bool statementWritesVariable(statement &s,
+                                   varInfo &var);
+
+      bool variableNameIsFree(statement &s,
+                              const std::string &varName,
+                              varInfo *ignoredVar = NULL);
+
+      std::string fusedNestSource(std::vector<fusionKernel_t*> &group);
+      std::string fusedBlockSource(fusionKernel_t &fk);
+      //   =============================
+
       static int getKernelOuterDim(statement &s);
       static int getKernelInnerDim(statement &s);
       static int getKernelDimFor(statement &s, const std::string &tag);
@@ -575,6 +575,7 @@ namespace occa {
     //---[ Kernel Info ]--------------------------
     class argumentInfo {
     public:
+      std::string name;
       int pos;
       bool isConst;
 
@@ -584,6 +585,31 @@ namespace occa {
       argumentInfo& operator = (const argumentInfo &info);
     };
 
+    // Symbolic launch costs in terms of the kernel's integer arguments
+    //   (e.g. "(2L * ((N) - (0)))"), isExact is false when a loop
+    //   bound could not be expressed and was counted as one iteration
+    class kernelCostInfo {
+    public:
+      std::string flops;
+      std::string bytesLoaded, bytesStored;
+      bool isExact;
+
+      kernelCostInfo();
+
+      kernelCostInfo(const kernelCostInfo &cost);
+      kernelCostInfo& operator = (const kernelCostInfo &cost);
+
+      bool isEmpty() const;
+
+      void addTerm(const std::string &iterations,
+                   const int flops_,
+                   const int bytesLoaded_,
+                   const int bytesStored_);
+
+      static double evaluate(const std::string &expr,
+                             const strToStrMap_t &argValues);
+    };
+
     class kernelInfo {
     public:
       std::string name;
@@ -592,6 +618,8 @@ namespace occa {
       std::vector<statement*> nestedKernels;
       std::vector<argumentInfo> argumentInfos;
 
+      kernelCostInfo cost;
+
       kernelInfo();
 
       kernelInfo(const kernelInfo &info);
@@ -603,7 +631,8 @@ namespace occa {
   }
 
   //---[ Parsed Kernel Info ]---------------------
-  typedef parserNS::argumentInfo argumentInfo;
+  typedef parserNS::argumentInfo   argumentInfo;
+  typedef parserNS::kernelCostInfo kernelCostInfo;
 
   class parsedKernelInfo {
   public:
@@ -612,6 +641,8 @@ namespace occa {
 
     std::vector<argumentInfo> argumentInfos;
 
+    kernelCostInfo cost;
+
     parsedKernelInfo();
 
     parsedKernelInfo(const parsedKernelInfo & kInfo);
@@ -0,0 +1,228 @@
+#ifndef OCCA_REDUCTION_HEADER
+#define OCCA_REDUCTION_HEADER
+
+#include <cmath>
+#include <limits>
+
+#include "occa/tools.hpp"
+#include "occa/base.hpp"
+#include "occa/half.hpp"
+
+namespace occa {
+  //---[ Reductions ]-----------------------------
+  //  [reductionOp] describes a reduction through OKL expressions:
+  //
+  //    combine  : Merges [a] and [b], must be associative and commutative
+  //    transform: Applied to every entry [x] (and [y] for two inputs)
+  //    compare  : Only for argmin/argmax-like ops, true if [a] is kept over [b]
+  //
+  //      occa::reductionOp absMax("(a < b) ? b : a", "(x < 0) ? -x : x");
+  //
+  //      float m = occa::reduce<float>(o_x, absMax, 0);
+  //
+  //  Kernels are built once per device, type and op:
+  //    - CPU modes reduce one contiguous chunk per thread with several
+  //      independent accumulators and combine the per-thread partials
+  //    - GPU modes reduce in shared memory trees
+  //  A second one-group launch combines the partials, only the final
+  //    value is copied to the host
+  //
+  //  half and bfloat16 entries are accumulated in float
+  class reductionOp {
+  public:
+    std::string combine, transform, compare;
+    int inputs;
+
+    reductionOp();
+
+    reductionOp(const std::string &combine_,
+                const std::string &transform_ = "x",
+                const int inputs_ = 1);
+
+    // Keeps the entry for which [compare_] holds and its index,
+    //   ties keep the lowest index
+    static reductionOp comparison(const std::string &compare_);
+
+    bool tracksIndex() const;
+
+    std::string key() const;
+  };
+
+  namespace reduction {
+    static const int cpuUnroll    = 8;
+    static const int cpuChunkSize = 4096;
+    static const int gpuInnerSize = 256;
+    static const int maxGroups    = 1024;
+
+    bool usesCPULayout(occa::device device);
+
+    std::string kernelSource(const std::string &type,
+                             const reductionOp &op,
+                             const int stage,
+                             const bool cpuLayout);
+
+    // Cached per device, type and op
+    kernel kernelFor(occa::device device,
+                     const std::string &type,
+                     const reductionOp &op,
+                     const int stage);
+
+    int groupsFor(occa::device device,
+                  const uintptr_t entries);
+
+    ///
+    /// Reduces [entries] entries of [x] (and [y]) and copies the
+    /// result to [result] and its index to [index] if the op
+    /// tracks one, [result] is left untouched if there are no entries
+    ///
+    void run(occa::memory x,
+             occa::memory y,
+             const std::string &type,
+             const size_t typeBytes,
+             const reductionOp &op,
+             const kernelArg &identity,
+             const uintptr_t entries,
+             void *result,
+             uintptr_t *index);
+
+    // Frees the cached kernels and partials, device::free()
+    //   frees the ones of its device
+    void free(occa::device device);
+    void free();
+
+    template <class TM> struct type_t;
+
+#define OCCA_REDUCTION_TYPE(TYPE)                                     \
+    template <> struct type_t<TYPE> {                                 \
+      static const char* name(){ return #TYPE; }                      \
+    }
+
+    OCCA_REDUCTION_TYPE(bool);
+    OCCA_REDUCTION_TYPE(char);
+    OCCA_REDUCTION_TYPE(short);
+    OCCA_REDUCTION_TYPE(int);
+    OCCA_REDUCTION_TYPE(unsigned int);
+    OCCA_REDUCTION_TYPE(long);
+    OCCA_REDUCTION_TYPE(unsigned long);
+    OCCA_REDUCTION_TYPE(float);
+    OCCA_REDUCTION_TYPE(double);
+    OCCA_REDUCTION_TYPE(half);
+    OCCA_REDUCTION_TYPE(bfloat16);
+
+#undef OCCA_REDUCTION_TYPE
+
+    // Largest (smallest) value, infinity if the type has one
+    template <class TM>
+    TM highest(){
+      return (std::numeric_limits<TM>::has_infinity ?
+              std::numeric_limits<TM>::infinity()   :
+              std::numeric_limits<TM>::max());
+    }
+
+    template <class TM>
+    TM lowest(){
+      return (std::numeric_limits<TM>::has_infinity   ?
+              (TM) -std::numeric_limits<TM>::infinity() :
+              std::numeric_limits<TM>::min());
+    }
+
+    template <class TM>
+    uintptr_t entriesIn(occa::memory x, const uintptr_t entries){
+      return (entries ? entries : (x.bytes() / sizeof(TM)));
+    }
+  }
+
+  template <class TM>
+  TM reduce(occa::memory x,
+            const reductionOp &op,
+            const TM &identity,
+            const uintptr_t entries = 0){
+    TM result = identity;
+
+    reduction::run(x, x,
+                   reduction::type_t<TM>::name(), sizeof(TM),
+                   op, identity,
+                   reduction::entriesIn<TM>(x, entries),
+                   &result, NULL);
+
+    return result;
+  }
+
+  template <class TM>
+  TM reduce(occa::memory x,
+            occa::memory y,
+            const reductionOp &op,
+            const TM &identity,
+            const uintptr_t entries = 0){
+    TM result = identity;
+
+    reduction::run(x, y,
+                   reduction::type_t<TM>::name(), sizeof(TM),
+                   op, identity,
+                   reduction::entriesIn<TM>(x, entries),
+                   &result, NULL);
+
+    return result;
+  }
+
+  template <class TM>
+  TM sum(occa::memory x, const uintptr_t entries = 0){
+    return reduce<TM>(x, reductionOp("a + b"), 0, entries);
+  }
+
+  template <class TM>
+  TM min(occa::memory x, const uintptr_t entries = 0){
+    return reduce<TM>(x, reductionOp("(b < a) ? b : a"),
+                      reduction::highest<TM>(), entries);
+  }
+
+  template <class TM>
+  TM max(occa::memory x, const uintptr_t entries = 0){
+    return reduce<TM>(x, reductionOp("(a < b) ? b : a"),
+                      reduction::lowest<TM>(), entries);
+  }
+
+  template <class TM>
+  TM dot(occa::memory x, occa::memory y, const uintptr_t entries = 0){
+    return reduce<TM>(x, y, reductionOp("a + b", "x * y", 2), 0, entries);
+  }
+
+  template <class TM>
+  TM norm2(occa::memory x, const uintptr_t entries = 0){
+    return (TM) std::sqrt((double) reduce<TM>(x, reductionOp("a + b", "x * x"),
+                                              0, entries));
+  }
+
+  template <class TM>
+  uintptr_t argmin(occa::memory x, const uintptr_t entries = 0){
+    const TM identity = reduction::highest<TM>();
+    TM result;
+    uintptr_t index;
+
+    reduction::run(x, x,
+                   reduction::type_t<TM>::name(), sizeof(TM),
+                   reductionOp::comparison("a < b"), identity,
+                   reduction::entriesIn<TM>(x, entries),
+                   &result, &index);
+
+    return index;
+  }
+
+  template <class TM>
+  uintptr_t argmax(occa::memory x, const uintptr_t entries = 0){
+    const TM identity = reduction::lowest<TM>();
+    TM result;
+    uintptr_t index;
+
+    reduction::run(x, x,
+                   reduction::type_t<TM>::name(), sizeof(TM),
+                   reductionOp::comparison("b < a"), identity,
+                   reduction::entriesIn<TM>(x, entries),
+                   &result, &index);
+
+    return index;
+  }
+  //==============================================
+}
+
+#endif
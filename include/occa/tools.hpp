@@ -54,6 +54,7 @@ namespace occa {
 
     extern std::string OCCA_DIR, OCCA_CACHE_DIR;
     extern size_t OCCA_MEM_BYTE_ALIGN;
+    extern uintptr_t OCCA_CACHE_MAX_SIZE;
     extern stringVector_t OCCA_INCLUDE_PATH;
 
     void initialize();
@@ -79,6 +80,7 @@ namespace occa {
     std::string expandEnvVariables(const std::string &str);
 
     void rmdir(const std::string &dir);
+    void rmrf(const std::string &dir);
     int mkdir(const std::string &dir);
     void mkpath(const std::string &dir);
 
@@ -88,6 +90,12 @@ namespace occa {
 
     std::string getFilename(const std::string &filename);
 
+    stringVector_t filesIn(const std::string &dir);
+    stringVector_t directoriesIn(const std::string &dir);
+
+    uintptr_t fileBytes(const std::string &filename);
+    long lastModified(const std::string &filename);
+
     void absolutePathVec(const std::string &path_,
                          stringVector_t &pathVec);
 
@@ -98,6 +106,7 @@ namespace occa {
   namespace kc {
     extern std::string sourceFile;
     extern std::string binaryFile;
+    extern std::string infoFile;
   }
   //==================================
 
@@ -151,6 +160,11 @@ namespace occa {
 
   bool haveHash(const std::string &hash, const int depth = 0);
   void waitForHash(const std::string &hash, const int depth = 0);
+
+  //  Returns true if [binaryFilename] is cached, the hash lock is held
+  //    either way until the caller loads or builds the binary
+  bool haveCachedBinary(const std::string &hash,
+                        const std::string &binaryFilename);
   void releaseHash(const std::string &hash, const int depth = 0);
   void releaseHashLock(const std::string &lockDir);
 
@@ -175,12 +189,63 @@ namespace occa {
                  const std::string &hash,
                  const bool deleteSource = true);
 
+  std::string createSourceFrom(const std::string &filename,
+                               const kernelInfo &info);
+
   void createSourceFileFrom(const std::string &filename,
                             const std::string &hashDir,
                             const kernelInfo &info);
   //==============================================
 
 
+  //---[ Cache Info ]-----------------------------
+  //  Stored as [kc::infoFile] in each hash directory
+  class cacheInfo_t {
+  public:
+    std::string hashDir;
+
+    std::string functionName;
+    std::string command;
+
+    double parseTime, compileTime;
+    uintptr_t binaryBytes;
+
+    long lastUsed; // Seconds since epoch
+    int hits;
+
+    cacheInfo_t();
+    cacheInfo_t(const std::string &hashDir_);
+
+    bool load(const std::string &hashDir_);
+    void write() const;
+
+    uintptr_t bytes() const;
+  };
+
+  void recordParse(const std::string &hashDir,
+                   const std::string &functionName,
+                   const double parseTime);
+
+  void recordCompilation(const std::string &hashDir,
+                         const std::string &functionName,
+                         const std::string &command,
+                         const double compileTime,
+                         const std::string &binaryFilename);
+
+  void recordCacheHit(const std::string &hashDir);
+
+  stringVector_t cachedHashDirs(const std::string &cacheDir = env::OCCA_CACHE_DIR);
+
+  //  Removes the least recently used entries until [cacheDir] fits in
+  //    [maxBytes], skipping entries locked by builders or recently used
+  uintptr_t evictCache(const std::string &cacheDir,
+                       const uintptr_t maxBytes,
+                       int &evictedEntries);
+
+  void evictCacheInBackground();
+  //==============================================
+
+
   //---[ Hash Functions ]-------------------------
   fnvOutput_t fnv(const void *ptr, uintptr_t bytes);
 
@@ -219,6 +284,7 @@ namespace occa {
   double atod(const std::string &str);
 
   std::string stringifyBytes(uintptr_t bytes);
+  uintptr_t bytesFromString(const std::string &str);
   //==============================================
 
 
@@ -1,17 +1,33 @@
+#include <algorithm>
+#include <iomanip>
+#include <ctime>
+
 #include "occa.hpp"
 
 void printHelp();
 
+void runAOT(const int argc, std::string *args);
+
+void runCompileServer(const int argc, std::string *args);
+
+std::string prettyBytes(const uintptr_t bytes);
+
+void runCacheStats();
+void runCacheTop(const int argc, std::string *args);
+
 void runHelp(const std::string &cmd);
 
 void runClearOn(const std::string &path);
 void runClearCache(const int argc, std::string *args);
+void runClearCacheLRU(const int argc, std::string *args);
 void runClearLocks();
 
 void runEnv();
 
 void runInfo();
 
+void runReplay(const int argc, std::string *args);
+
 void runUpdate(const int argc, std::string *args);
 
 int main(int argc, char **argv){
@@ -33,9 +49,28 @@ int main(int argc, char **argv){
     else
       printHelp();
   }
+  else if(args[0] == "aot"){
+    if(argc < 2)
+      runHelp("aot");
+    else
+      runAOT(argc - 1, args + 1);
+  }
+  else if(args[0] == "cache"){
+    if((1 < argc) && (args[1] == "stats"))
+      runCacheStats();
+    else if((1 < argc) && (args[1] == "top"))
+      runCacheTop(argc - 2, args + 2);
+    else
+      runHelp("cache");
+  }
+  else if(args[0] == "compile-server"){
+    runCompileServer(argc - 1, args + 1);
+  }
   else if(args[0] == "clear"){
     if(1 < argc){
-      if(args[1] == "cache")
+      if((args[1] == "cache") && (2 < argc) && (args[2] == "--lru"))
+        runClearCacheLRU(argc - 3, args + 3);
+      else if(args[1] == "cache")
         runClearCache(argc - 2, args + 2);
       else if(args[1] == "locks")
         runClearLocks();
@@ -51,6 +86,12 @@ int main(int argc, char **argv){
   else if(args[0] == "info"){
     runInfo();
   }
+  else if(args[0] == "replay"){
+    if(argc < 2)
+      runHelp("replay");
+    else
+      runReplay(argc - 1, args + 1);
+  }
   else if(args[0] == "update"){
     --argc;
 
@@ -72,9 +113,14 @@ void printHelp(){
             << "  Otherwise run a command with:          [occa <command> <arguments>]\n\n"
 
             << "  Available commands:\n"
+            << "    - aot <manifest> [bundle directory]\n"
+            << "    - cache stats\n"
+            << "    - cache top [count] [compile|parse|size|hits|age]\n"
             << "    - clear\n"
+            << "    - compile-server [cache directory]\n"
             << "    - env\n"
             << "    - info\n"
+            << "    - replay <capture file> [iterations] [device info]\n"
             << "    - update <library or application name> <file>[, file2...]\n\n"
 
             << "  Additional information:\n"
@@ -82,7 +128,29 @@ void printHelp(){
 }
 
 void runHelp(const std::string &cmd){
-  if(cmd == "cache"){
+  if(cmd == "aot"){
+    std::cout << "  Builds every kernel listed in a manifest into one shared object\n"
+              << "    - occa aot <manifest> [bundle directory]\n\n"
+
+              << "  Manifests list kernels as blocks of [key: value] lines:\n\n"
+
+              << "      kernel:\n"
+              << "        file:     addVectors.okl\n"
+              << "        function: addVectors\n"
+              << "        mode:     mode = OpenMP, schedule = compact, chunk = 10\n"
+              << "        define:   TILE_SIZE = 16\n"
+              << "        include:  common.hpp\n"
+              << "        flags:    -O3\n\n"
+
+              << "  [mode] defaults to Serial and [define], [include] and [flags] can be repeated\n"
+              << "  [bundle directory] defaults to:\n\n"
+
+              << "      $OCCA_CACHE_DIR/aot/<manifest name>/\n\n"
+
+              << "  Bundles in $OCCA_CACHE_DIR/aot/ are loaded automatically, building a bundled\n"
+              << "  kernel with the same source, kernelInfo and device skips parsing and compiling\n";
+  }
+  else if(cmd == "cache"){
     std::cout << "- OCCA caches kernels in:\n\n"
 
               << "      $OCCA_CACHE_DIR/\n\n"
@@ -106,18 +174,46 @@ void runHelp(const std::string &cmd){
               << "      $OCCA_CACHE_DIR/kernels/<hash>/binary\n\n"
 
               << "  where the <hash> is printed (by default) when the kernel\n"
-              << "  is built\n";
+              << "  is built\n\n"
+
+              << "- Each <hash> directory keeps an [info] file with the parse and\n"
+              << "  compile times, binary size, compiler command, cache hits and\n"
+              << "  the last time it was used, summarized with:\n\n"
+
+              << "      occa cache stats\n"
+              << "      occa cache top [count] [compile|parse|size|hits|age]\n\n"
+
+              << "  [count] defaults to 10 and entries are sorted by compile time by default\n";
   }
   else if(cmd == "clear"){
     std::cout << "  Clears kernels that were cached and compilation locks\n"
               << "    - occa clear cache <library1, library2, ...>\n"
-              << "    - occa clear locks\n";
+              << "    - occa clear cache --lru [max size]\n"
+              << "    - occa clear locks\n\n"
+
+              << "  [--lru] removes the least recently used kernels until the cache fits in\n"
+              << "    [max size] (for example 500M or 2G), defaulting to OCCA_CACHE_MAX_SIZE\n";
+  }
+  else if(cmd == "compile-server"){
+    std::cout << "  Compiles CPU kernels for every process on the node using the same cache\n"
+              << "    - occa compile-server [cache directory]\n\n"
+
+              << "  Started automatically when OCCA_COMPILE_SERVER=1, it listens on:\n\n"
+
+              << "      $OCCA_CACHE_DIR/compileServer/socket\n\n"
+
+              << "  and logs compilations in $OCCA_CACHE_DIR/compileServer/log\n"
+              << "  Each kernel is compiled once, with up to OCCA_COMPILE_SERVER_JOBS compilations\n"
+              << "  in parallel [Defaults to the core count], and the server exits after a minute idle\n";
   }
   else if(cmd == "env"){
     std::cout << "  The following are optional environment variables and their use\n"
               << "  Basic:\n"
-              << "    - OCCA_CACHE_DIR: Directory where kernels and their compiled binaries are cached\n"
-              << "                        [Defaults to ~/._occa]\n\n"
+              << "    - OCCA_CACHE_DIR     : Directory where kernels and their compiled binaries are cached\n"
+              << "                             [Defaults to ~/._occa]\n"
+              << "    - OCCA_CACHE_MAX_SIZE: Size (for example 500M or 2G) the cache is kept under by\n"
+              << "                             removing the least recently used kernels\n"
+              << "                             [Defaults to unbounded]\n\n"
 
               << "  Makefile:\n"
               << "    - CXX           : C++ compiler\n"
@@ -142,10 +238,17 @@ void runHelp(const std::string &cmd){
               << "    - OCCA_COI_ENABLED   : Set to 0 if you wish to manually disable it\n\n"
 
               << "  Run-Time Options:\n"
+              << "    - OCCA_CAPTURE               : Kernel name whose first launch is captured for [occa replay]\n"
+              << "    - OCCA_COMPILE_SERVER        : Compile CPU kernels through one server per node [occa help compile-server]\n"
+              << "                                      [1 or 0 (default)]\n"
+              << "    - OCCA_COMPILE_SERVER_JOBS   : Parallel compilations in the compile server\n"
+              << "                                      [Defaults to the core count  ]\n"
               << "    - OCCA_CXX                   : C++ compiler used on the kernels\n"
               << "                                      [Defaults to g++             ]\n"
               << "    - OCCA_CXXFLAGS              : C++ compiler used on the kernels\n"
               << "                                      [Defaults to -g              ]\n"
+              << "    - OCCA_IN_MEMORY_COMPILATION : Compile CPU kernels through stdin into memory, skipping the cache\n"
+              << "                                      [1, persist (also cache them) or 0 (default)]\n"
               << "    - OCCA_OPENCL_COMPILER_FLAGS : Compiler flags used when compiling OpenCL kernels\n"
               << "                                      [Defaults to -cl-opt-disable ]\n"
               << "    - OCCA_CUDA_COMPILER         : Compiler used when compiling CUDA kernels\n"
@@ -160,6 +263,18 @@ void runHelp(const std::string &cmd){
               << "    - OpenCL platforms and devices\n"
               << "    - CUDA devices\n";
   }
+  else if(cmd == "replay"){
+    std::cout << "  Rebuilds and times a kernel launch captured with OCCA_CAPTURE=<kernelName>\n"
+              << "    - occa replay <capture file> [iterations] [device info]\n\n"
+
+              << "  Captures are stored in:\n\n"
+
+              << "      $OCCA_CACHE_DIR/captures/<kernelName>.capture\n\n"
+
+              << "  [iterations] defaults to 10 and [device info] defaults to the captured mode\n"
+              << "  For example:\n"
+              << "    - occa replay ~/._occa/captures/addVectors.capture 100 \"mode = OpenMP\"\n";
+  }
   else if(cmd == "update"){
     std::cout << "  Updates the library or application's kernel files in a cache directory\n"
               << "  This is used to find kernels at run-time without specifying an absolute path to the files\n"
@@ -219,6 +334,26 @@ void runClearCache(const int argc, std::string *args){
   }
 }
 
+void runClearCacheLRU(const int argc, std::string *args){
+  const uintptr_t maxBytes = (argc ?
+                              occa::bytesFromString(args[0]) :
+                              occa::env::OCCA_CACHE_MAX_SIZE);
+
+  if((argc == 0) && (maxBytes == 0)){
+    std::cout << "  Set OCCA_CACHE_MAX_SIZE or pass a size, for example:\n"
+              << "    - occa clear cache --lru 500M\n";
+    return;
+  }
+
+  int evictedEntries;
+  const uintptr_t freedBytes = occa::evictCache(occa::env::OCCA_CACHE_DIR,
+                                                maxBytes,
+                                                evictedEntries);
+
+  std::cout << "  Removed " << evictedEntries << " cached kernels ("
+            << prettyBytes(freedBytes) << ")\n";
+}
+
 void runClearLocks(){
   const std::string lockPath = occa::env::OCCA_CACHE_DIR + "locks/";
 
@@ -232,6 +367,7 @@ void runEnv(){
   std::cout << "  The following are optional environment variables and their values\n"
             << "  Basic:\n"
             << "    - OCCA_CACHE_DIR             : " << envEcho("OCCA_CACHE_DIR") << "\n"
+            << "    - OCCA_CACHE_MAX_SIZE        : " << envEcho("OCCA_CACHE_MAX_SIZE") << "\n"
             << "  Makefile:\n"
             << "    - CXX                        : " << envEcho("CXX") << "\n"
             << "    - CXXFLAGS                   : " << envEcho("CXXFLAGS") << "\n"
@@ -246,17 +382,246 @@ void runEnv(){
             << "    - OCCA_COI_ENABLED           : " << envEcho("OCCA_COI_ENABLED") << "\n"
 
             << "  Run-Time Options:\n"
+            << "    - OCCA_CAPTURE               : " << envEcho("OCCA_CAPTURE") << "\n"
             << "    - OCCA_CXX                   : " << envEcho("OCCA_CXX") << "\n"
             << "    - OCCA_CXXFLAGS              : " << envEcho("OCCA_CXXFLAGS") << "\n"
+            << "    - OCCA_IN_MEMORY_COMPILATION : " << envEcho("OCCA_IN_MEMORY_COMPILATION") << "\n"
             << "    - OCCA_OPENCL_COMPILER_FLAGS : " << envEcho("OCCA_OPENCL_COMPILER_FLAGS") << "\n"
             << "    - OCCA_CUDA_COMPILER         : " << envEcho("OCCA_CUDA_COMPILER") << "\n"
             << "    - OCCA_CUDA_COMPILER_FLAGS   : " << envEcho("OCCA_CUDA_COMPILER_FLAGS") << "\n";
 }
 
+bool sortByCompileTime(const occa::cacheInfo_t &a, const occa::cacheInfo_t &b){
+  return (b.compileTime < a.compileTime);
+}
+
+bool sortByParseTime(const occa::cacheInfo_t &a, const occa::cacheInfo_t &b){
+  return (b.parseTime < a.parseTime);
+}
+
+bool sortBySize(const occa::cacheInfo_t &a, const occa::cacheInfo_t &b){
+  return (b.bytes() < a.bytes());
+}
+
+bool sortByHits(const occa::cacheInfo_t &a, const occa::cacheInfo_t &b){
+  return (b.hits < a.hits);
+}
+
+bool sortByAge(const occa::cacheInfo_t &a, const occa::cacheInfo_t &b){
+  return (a.lastUsed < b.lastUsed);
+}
+
+std::string prettyBytes(const uintptr_t bytes){
+  std::stringstream ss;
+
+  if(bytes < (1 << 10))
+    ss << bytes << " B";
+  else if(bytes < (1 << 20))
+    ss << std::setprecision(3) << (bytes / 1024.0) << " KB";
+  else
+    ss << std::setprecision(3) << (bytes / (1024.0 * 1024.0)) << " MB";
+
+  return ss.str();
+}
+
+void loadCacheInfos(std::vector<occa::cacheInfo_t> &infos){
+  const occa::stringVector_t hashDirs = occa::cachedHashDirs();
+
+  infos.resize(hashDirs.size());
+
+  for(size_t i = 0; i < hashDirs.size(); ++i)
+    infos[i].load(hashDirs[i]);
+}
+
+void runCacheStats(){
+  std::vector<occa::cacheInfo_t> infos;
+  loadCacheInfos(infos);
+
+  uintptr_t totalBytes = 0;
+  double parseTime = 0, compileTime = 0;
+  int compiled = 0, hits = 0, neverHit = 0;
+
+  for(size_t i = 0; i < infos.size(); ++i){
+    const occa::cacheInfo_t &info = infos[i];
+
+    totalBytes  += info.bytes();
+    parseTime   += info.parseTime;
+    compileTime += info.compileTime;
+    hits        += info.hits;
+
+    if(info.command.size()){
+      ++compiled;
+
+      if(info.hits == 0)
+        ++neverHit;
+    }
+  }
+
+  std::cout << "  Cache directory     : " << occa::env::OCCA_CACHE_DIR << '\n'
+            << "  Entries             : " << infos.size() << '\n'
+            << "  Compiled binaries   : " << compiled << '\n'
+            << "  Total size          : " << prettyBytes(totalBytes) << '\n'
+            << "  Total parse time    : " << parseTime << " s\n"
+            << "  Total compile time  : " << compileTime << " s\n"
+            << "  Cache hits          : " << hits << '\n'
+            << "  Binaries never hit  : " << neverHit << '\n';
+}
+
+void runCacheTop(const int argc, std::string *args){
+  int count = 10;
+  std::string sortKey = "compile";
+
+  for(int i = 0; i < argc; ++i){
+    if(occa::isANumber(args[i]))
+      count = (int) occa::atoi(args[i]);
+    else
+      sortKey = args[i];
+  }
+
+  std::vector<occa::cacheInfo_t> infos;
+  loadCacheInfos(infos);
+
+  if(sortKey == "compile")
+    std::sort(infos.begin(), infos.end(), sortByCompileTime);
+  else if(sortKey == "parse")
+    std::sort(infos.begin(), infos.end(), sortByParseTime);
+  else if(sortKey == "size")
+    std::sort(infos.begin(), infos.end(), sortBySize);
+  else if(sortKey == "hits")
+    std::sort(infos.begin(), infos.end(), sortByHits);
+  else if(sortKey == "age")
+    std::sort(infos.begin(), infos.end(), sortByAge);
+  else {
+    runHelp("cache");
+    return;
+  }
+
+  const long now = (long) time(NULL);
+  const int entries = std::min(count, (int) infos.size());
+
+  std::cout << std::left
+            << "  " << std::setw(24) << "Function"
+            << std::right
+            << std::setw(10) << "Parse(s)"
+            << std::setw(11) << "Compile(s)"
+            << std::setw(11) << "Size"
+            << std::setw(7)  << "Hits"
+            << std::setw(11) << "Idle(s)"
+            << "  Directory\n";
+
+  for(int i = 0; i < entries; ++i){
+    const occa::cacheInfo_t &info = infos[i];
+
+    std::cout << std::left
+              << "  " << std::setw(24) << (info.functionName.size() ? info.functionName : "?")
+              << std::right << std::setprecision(4)
+              << std::setw(10) << info.parseTime
+              << std::setw(11) << info.compileTime
+              << std::setw(11) << prettyBytes(info.bytes())
+              << std::setw(7)  << info.hits
+              << std::setw(11) << (info.lastUsed ? (now - info.lastUsed) : 0)
+              << "  " << info.hashDir << '\n';
+  }
+}
+
 void runInfo(){
   occa::printAvailableDevices();
 }
 
+void runAOT(const int argc, std::string *args){
+  const std::string manifestFile = occa::sys::getFilename(args[0]);
+  std::string bundleDir;
+
+  if(1 < argc){
+    bundleDir = args[1];
+  }
+  else {
+    std::string name = manifestFile.substr(occa::getFileDirectory(manifestFile).size());
+
+    const size_t dot = name.rfind('.');
+
+    if(dot != std::string::npos)
+      name = name.substr(0, dot);
+
+    bundleDir = occa::env::OCCA_CACHE_DIR + "aot/" + name;
+  }
+
+  occa::aot::build(manifestFile, bundleDir);
+}
+
+void runCompileServer(const int argc, std::string *args){
+  if(0 < argc){
+    occa::env::OCCA_CACHE_DIR = occa::sys::getFilename(args[0]);
+    occa::env::endDirWithSlash(occa::env::OCCA_CACHE_DIR);
+  }
+
+  occa::compileServer::serve();
+}
+
+void runReplay(const int argc, std::string *args){
+  const std::string captureFile = occa::sys::getFilename(args[0]);
+  const int iterations = ((1 < argc) ? (int) occa::atoi(args[1]) : 10);
+
+  occa::kernelCapture cap;
+  cap.read(captureFile);
+
+  occa::device device;
+
+  if(2 < argc)
+    device.setup(args[2]);
+  else
+    device.setup("mode = " + cap.mode);
+
+  occa::kernel kernel = cap.buildKernel(device, captureFile);
+  cap.setArguments(device, kernel);
+
+  // Warm-up launch
+  kernel.runFromArguments();
+  device.finish();
+
+  double minTime = 0, maxTime = 0, totalTime = 0;
+
+  for(int i = 0; i < iterations; ++i){
+    cap.resetMemories();
+    device.finish();
+
+    const double start = occa::currentTime();
+
+    kernel.runFromArguments();
+    device.finish();
+
+    const double elapsed = (occa::currentTime() - start);
+
+    if((i == 0) || (elapsed < minTime))
+      minTime = elapsed;
+    if((i == 0) || (maxTime < elapsed))
+      maxTime = elapsed;
+
+    totalTime += elapsed;
+  }
+
+  const double avgTime = (iterations ? (totalTime / iterations) : 0);
+
+  const double flops = kernel.estimatedFlops();
+  const double bytes = kernel.estimatedBytes();
+
+  std::cout << "  Kernel     : " << cap.functionName << '\n'
+            << "  Device     : " << device.mode() << '\n'
+            << "  Iterations : " << iterations << '\n'
+            << "  Min time   : " << minTime << " s\n"
+            << "  Avg time   : " << avgTime << " s\n"
+            << "  Max time   : " << maxTime << " s\n";
+
+  if((0 < minTime) && (0 < flops))
+    std::cout << "  GFLOP/s    : " << (flops / (1.0e9 * minTime)) << '\n';
+  if((0 < minTime) && (0 < bytes))
+    std::cout << "  GB/s       : " << (bytes / (1.0e9 * minTime)) << '\n';
+
+  cap.freeMemories();
+  kernel.free();
+  device.free();
+}
+
 void runUpdate(const int argc, std::string *args){
   std::string &library = args[0];
   std::string libDir   = occa::sys::getFilename("[" + library + "]") + "/";
@@ -41,6 +41,13 @@ defined_in_cuda = [ 'char2'  ,
 unary_ops  = ['+', '-']
 binary_ops = ['+', '-', '*', '/']
 
+# GCC and Clang don't have bool vectors
+def uses_simd(type_, n):
+    return ((type_ != 'bool') and (n != 3))
+
+def simd_type(type_, n):
+    return 'occaSimd' + type_.capitalize() + str(n)
+
 def varL(n):
     if n < 4:
         return chr(ord('w') + ((n + 1) % 4))
@@ -72,17 +79,47 @@ def define_typeN(type_, n):
 
         return define
 
+    simd = uses_simd(type_, n)
+
+    if simd:
+        define += '#if OCCA_VECTOR_EXTENSIONS\n'
+        define += 'typedef {type_} {simdN} __attribute__ ((vector_size({n}*sizeof({type_})),\n'.format(type_=type_,
+                                                                                                  simdN=simd_type(type_, n),
+                                                                                                  n=n)
+        define += (' ' * (len(type_) + len(simd_type(type_, n)) + 24)) + \
+                  'aligned(OCCA_SIMD_ALIGN({n}*sizeof({type_})))));\n'.format(type_=type_, n=n)
+        define += '#endif\n'
+
     if typeN in defined_in_cuda:
         define += '#if (!defined(OCCA_IN_KERNEL) || (OCCA_USING_CUDA == 0))\n'
 
     define += 'class ' + type_ + str(n) + '{\n' + \
              'public:\n'
 
-    for i in range(n):
-        if(i < 4):
-            define += '  union { ' + type_ + ' ' + varN(i) + ', ' + varL(i) + '; };\n'
-        else:
-            define += '  ' + type_ + ' ' + varN(i) + ';\n'
+    def members(indent):
+        ret = ''
+        for i in range(n):
+            if(i < 4):
+                ret += indent + 'union { ' + type_ + ' ' + varN(i) + ', ' + varL(i) + '; };\n'
+            else:
+                ret += indent + type_ + ' ' + varN(i) + ';\n'
+        return ret
+
+    if simd:
+        define += '#if OCCA_VECTOR_EXTENSIONS\n'
+        define += '  union {\n'
+        define += '    ' + simd_type(type_, n) + ' v_;\n\n'
+        define += '    __extension__ struct {\n'
+        define += members('      ')
+        define += '    };\n'
+        define += '  };\n\n'
+        define += '  explicit inline occaFunction ' + typeN + '(const ' + simd_type(type_, n) + ' &v) : \n'
+        define += '    v_(v) {}\n'
+        define += '#else\n'
+        define += members('  ')
+        define += '#endif\n'
+    else:
+        define += members('  ')
 
     define += '\n'
 
@@ -129,6 +166,19 @@ def define_typeN(type_, n):
 
     return define
 
+# Uses [simd_body] instead of the component-wise body of [function]
+#   when vector extensions are available
+def simd_function(function, simd_body):
+    header, body = function.split('\n', 1)
+
+    return (header + '\n'                   +
+            '#if OCCA_VECTOR_EXTENSIONS\n' +
+            simd_body                       +
+            '#else\n'                       +
+            body[:-2]                       +
+            '#endif\n'                      +
+            '}\n')
+
 def unary_op_def(type_, n, op):
     typeN = type_ + str(n)
     TYPEN = (type_ + str(n)).upper();
@@ -178,16 +228,25 @@ def unary_op_def(type_, n, op):
         else:
             defines[d] += ';\n'
 
-    for d in range(maxDefs):
-        if 0 < d:
-            defines[0] += '\n' + defines[d]
+    functions = []
 
+    for d in range(maxDefs):
         if d == 2:
-            defines[0] += indent[2] + 'return a;\n'
+            defines[d] += indent[2] + 'return a;\n'
 
-        defines[0] += '}\n'
+        functions.append(defines[d] + '}\n')
 
-    return defines[0]
+    if uses_simd(type_, n):
+        simd_bodies = ['  return ' + typeN + '(' + op + 'a.v_);\n',
+                       '  const ' + typeN + ' ret(a.v_);\n' + \
+                       '  a.v_ ' + op + '= 1;\n' + \
+                       '  return ret;\n',
+                       '  a.v_ ' + op + '= 1;\n' + \
+                       '  return a;\n']
+
+        functions = [simd_function(functions[d], simd_bodies[d]) for d in range(maxDefs)]
+
+    return '\n'.join(functions)
 
 def binary_op_def(type_, n, op):
     typeN = type_ + str(n)
@@ -223,18 +282,28 @@ def binary_op_def(type_, n, op):
             else:
                 defines[d] += '  a.' + varL(i) + ' ' + op + '= ' + b[d][i] + ';\n'
 
-    for d in range(5):
-        if 0 < d:
-            defines[0] += '\n' + defines[d]
+    functions = []
 
+    for d in range(5):
         if d < 3:
-            defines[0] += ');\n'
+            defines[d] += ');\n'
         else:
-            defines[0] += '  return a;\n'
+            defines[d] += '  return a;\n'
+
+        functions.append(defines[d] + '}\n')
+
+    if uses_simd(type_, n):
+        av = ['a.v_' if aIsTypeN[d] else 'a' for d in range(5)]
+        bv = ['b.v_' if bIsTypeN[d] else 'b' for d in range(5)]
+
+        simd_bodies = [('  return ' + typeN + '(' + av[d] + ' ' + op + ' ' + bv[d] + ');\n') if (d < 3) else
+                       ('  a.v_ ' + op + '= ' + bv[d] + ';\n' + \
+                        '  return a;\n')
+                       for d in range(5)]
 
-        defines[0] += '}\n'
+        functions = [simd_function(functions[d], simd_bodies[d]) for d in range(5)]
 
-    return defines[0]
+    return '\n'.join(functions)
 
 def define_type(type_):
     define = ''
@@ -251,11 +320,153 @@ def define_type(type_):
 
     return define
 
+# 16-bit storage types only convert to and from the float vectors,
+#   halfN has x, y, z, w up to 4 entries and s0, s1, ... after
+half_types = ['half', 'bfloat16']
+
+def half_vector_name(type_, n):
+    return type_ + ('x' if (type_ == 'bfloat16') else '') + str(n)
+
+# F16C (AVX-512 for 16 entries) converts whole halfN vectors
+half_intrinsics = {
+    4 : ('OCCA_F16C',
+         '_mm_storel_epi64((__m128i*) this, _mm_cvtps_ph((__m128) v.v_, 0));',
+         '_mm_cvtph_ps(_mm_loadl_epi64((const __m128i*) this))'),
+    8 : ('OCCA_F16C',
+         '_mm_storeu_si128((__m128i*) this, _mm256_cvtps_ph((__m256) v.v_, 0));',
+         '_mm256_cvtph_ps(_mm_loadu_si128((const __m128i*) this))'),
+    16: ('OCCA_AVX512F',
+         '_mm256_storeu_si256((__m256i*) this, _mm512_cvtps_ph((__m512) v.v_, 0));',
+         '_mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*) this))')
+}
+
+def define_half_vector(type_, n):
+    typeN  = half_vector_name(type_, n)
+    TYPEN  = typeN.upper()
+    floatN = 'float' + str(n)
+    FLOATN = floatN.upper()
+
+    define = '#define OCCA_' + TYPEN + ' ' + typeN + '\n'
+
+    if n == 3:
+        define += 'typedef {type4} {type3};\n'.format(type3=typeN,
+                                                      type4=half_vector_name(type_, 4))
+        return define
+
+    var  = (varL if (n <= 4) else varN)
+    vars = [var(i) for i in range(n)]
+
+    # bfloat16 conversions are float bit shifts on unsigned vectors
+    if (type_ == 'bfloat16') and uses_simd(type_, n):
+        bits   = 'occaSimdBits' + str(n)
+        shorts = 'occaSimdBfloat16x' + str(n)
+
+        define += '#if OCCA_VECTOR_EXTENSIONS\n'
+        define += 'typedef unsigned int ' + bits + ' __attribute__ ((vector_size(' + str(n) + '*sizeof(unsigned int)),\n'
+        define += (' ' * (len(bits) + 38)) + 'aligned(OCCA_SIMD_ALIGN(' + str(n) + '*sizeof(unsigned int)))));\n'
+        define += '// Loads and stores the entries of ' + typeN + ' in place\n'
+        define += 'typedef unsigned short ' + shorts + ' __attribute__ ((vector_size(' + str(n) + '*sizeof(unsigned short)),\n'
+        define += (' ' * (len(shorts) + 40)) + 'aligned(sizeof(unsigned short)), may_alias));\n'
+        define += '#endif\n'
+
+    define += 'class ' + typeN + '{\n' + \
+              'public:\n'
+
+    for i in range(n):
+        define += '  ' + type_ + ' ' + vars[i] + ';\n'
+
+    define += '\n'
+    define += '  inline occaFunction ' + typeN + '() {}\n\n'
+
+    fromFloat = ('  inline occaFunction ' + typeN + '(const ' + floatN + ' &v) : \n' +
+                 '    ' + ',\n    '.join(vars[i] + '(v.' + vars[i] + ')' for i in range(n)) + ' {}\n')
+
+    ret      = '    return OCCA_' + FLOATN + '('
+    toFloat  = ('  inline occaFunction operator ' + floatN + ' () const {\n' +
+                ret + (',\n' + (' ' * len(ret))).join(vars) + ');\n' +
+                '  }\n')
+
+    if (type_ == 'bfloat16') and uses_simd(type_, n):
+        bits   = 'occaSimdBits' + str(n)
+        shorts = 'occaSimdBfloat16x' + str(n)
+
+        define += '#if OCCA_VECTOR_EXTENSIONS\n'
+        define += '  inline occaFunction ' + typeN + '(const ' + floatN + ' &v){\n'
+        define += '    const ' + bits + ' u   = (' + bits + ') v.v_;\n'
+        define += '    // All ones in NaN lanes, the subtraction only goes negative for them\n'
+        define += '    const ' + bits + ' nan = (' + bits + ') (((' + simd_type('int', n) + ') (0x7f800000u - (u & 0x7fffffffu))) >> 31);\n'
+        define += '    const ' + bits + ' b   = ((((u + 0x7fffu + ((u >> 16) & 1u)) >> 16) & ~nan) |\n'
+        define += (' ' * (len(bits) + 18)) + '(((u >> 16) | 0x40u) & nan));\n\n'
+        define += '#  if OCCA_CONVERT_VECTOR\n'
+        define += '    *((' + shorts + '*) this) = __builtin_convertvector(b, ' + shorts + ');\n'
+        define += '#  else\n'
+        define += ''.join('    ' + vars[i] + '.bits = (unsigned short) b[' + str(i) + '];\n' for i in range(n))
+        define += '#  endif\n'
+        define += '  }\n\n'
+        define += '  inline occaFunction operator ' + floatN + ' () const {\n'
+        define += '#  if OCCA_CONVERT_VECTOR\n'
+        define += '    const ' + bits + ' u = __builtin_convertvector(*((const ' + shorts + '*) this), ' + bits + ');\n'
+        define += '#  else\n'
+        define += '    const ' + bits + ' u = {' + ', '.join(vars[i] + '.bits' for i in range(n)) + '};\n'
+        define += '#  endif\n\n'
+        define += '    return ' + floatN + '((' + simd_type('float', n) + ') (u << 16));\n'
+        define += '  }\n'
+        define += '#else\n'
+        define += fromFloat + '\n' + toFloat
+        define += '#endif\n'
+    elif (type_ == 'half') and (n in half_intrinsics):
+        (guard, store, load) = half_intrinsics[n]
+
+        define += '#if ' + guard + ' && OCCA_VECTOR_EXTENSIONS\n'
+        define += '  inline occaFunction ' + typeN + '(const ' + floatN + ' &v){\n'
+        define += '    ' + store + '\n'
+        define += '  }\n\n'
+        define += '  inline occaFunction operator ' + floatN + ' () const {\n'
+        define += '    return ' + floatN + '((' + simd_type('float', n) + ') ' + load + ');\n'
+        define += '  }\n'
+        define += '#else\n'
+        define += fromFloat + '\n' + toFloat
+        define += '#endif\n'
+    else:
+        define += fromFloat + '\n' + toFloat
+
+    define += '};\n'
+
+    return define
+
+def define_half_type(type_):
+    define = ''
+
+    for n in Ns:
+        typeN = half_vector_name(type_, n)
+
+        comment = '//---[ ' + typeN + ' ]'
+        define += comment + ('-' * (40 - len(comment))) + '\n'
+
+        define += define_half_vector(type_, n)
+
+        define += '//' + ('=' * 38) + '\n\n\n'
+
+    return define
+
 def define_all_types():
     define  = '#if (!defined(OCCA_IN_KERNEL) || (!OCCA_USING_OPENCL))\n'
     define += '#  include <iostream>\n'
     define += '#  include <cmath>\n'
-    define += '#  include "occa/defines.hpp"\n\n'
+    define += '#  include "occa/defines.hpp"\n'
+    define += '#  include "occa/half.hpp"\n\n'
+
+    define += '#  if OCCA_VECTOR_EXTENSIONS\n'
+    define += '// Vector storage is aligned to its size, up to the 16 bytes\n'
+    define += '//   malloc and new guarantee for host allocations\n'
+    define += '#    define OCCA_SIMD_ALIGN(BYTES) (((BYTES) < 16) ? (BYTES) : 16)\n\n'
+    define += '// Widens and narrows bfloat16 vectors in registers\n'
+    define += '#    if (defined(__clang__) || (__GNUC__ >= 9))\n'
+    define += '#      define OCCA_CONVERT_VECTOR 1\n'
+    define += '#    else\n'
+    define += '#      define OCCA_CONVERT_VECTOR 0\n'
+    define += '#    endif\n'
+    define += '#  endif\n\n'
 
     define += '#  ifndef OCCA_IN_KERNEL\n'
     define += '#  define occaFunction\n'
@@ -270,6 +481,9 @@ def define_all_types():
         if type_ == 'bool':
             define += '#pragma GCC diagnostic pop\n'
 
+    for type_ in half_types:
+        define += define_half_type(type_)
+
     define += '#  ifndef OCCA_IN_KERNEL\n'
     define += '}\n'
     define += '#  endif\n\n'
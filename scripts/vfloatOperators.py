@@ -68,7 +68,7 @@ MIN_INSTRUCTION_SET = { 'vfloat2' : 'MMX' ,
 def min_instruction_set_dep(types, set1):
     sets = [MIN_INSTRUCTION_SET[t] for t in types if t in MIN_INSTRUCTION_SET]
 
-    if len(sets) is 0:
+    if len(sets) == 0:
         return set1
 
     indices = [INSTRUCTION_SETS.index(s) for s in sets]
@@ -138,11 +138,11 @@ def setup_function(func,
 def make_function(f):
     import inspect
 
-    argc = len(inspect.getargspec(f).args)
+    argc = len(inspect.getfullargspec(f).args)
 
     source = ''
 
-    if argc is not 0:
+    if argc != 0:
         return source
 
     intrinsic_source = f()
@@ -150,11 +150,11 @@ def make_function(f):
     if not hasattr(f, 'isAnIntrinsicFunction'):
         return source
 
-    if   f.operator_type is 'binary':
+    if   f.operator_type == 'binary':
         args = '{} a, {} b'.format(f.full_left_type, f.full_right_type)
-    elif f.operator_type is 'leftUnary':
+    elif f.operator_type == 'leftUnary':
         args = '{} a'.format(f.full_left_type)
-    elif f.operator_type is 'rightUnary':
+    elif f.operator_type == 'rightUnary':
         args = '{} a, int'.format(f.full_right_type)
 
     source += '#if OCCA_USING_CPU\n'
@@ -312,23 +312,21 @@ namespace occa {
 
     const std::string hashDir = hashDirFor(filename, hash);
     const std::string ptxBinaryFile = hashDir + "ptxBinary.o";
-    bool foundBinary = true;
 
     sourceFilename = hashDir + kc::sourceFile;
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
-
-    if (foundBinary) {
+    if (haveCachedBinary(hash, binaryFilename)) {
       if(verboseCompilation_f)
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
-      return buildFromBinary(binaryFilename, functionName);
+      recordCacheHit(hashDir);
+
+      // Keep the hash lock until the binary is loaded
+      buildFromBinary(binaryFilename, functionName);
+      releaseHash(hash, 0);
+
+      return this;
     }
 
     createSourceFileFrom(filename, hashDir, info);
@@ -386,6 +384,8 @@ namespace occa {
     if(verboseCompilation_f)
       std::cout << sCommand << '\n';
 
+    const double compileStart = currentTime();
+
     const int compileError = system(sCommand.c_str());
 
     if(compileError){
@@ -393,6 +393,9 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    recordCompilation(hashDir, functionName, sCommand,
+                      currentTime() - compileStart, binaryFilename);
+
     const CUresult moduleLoadError = cuModuleLoad(&data_.module,
                                                   binaryFilename.c_str());
 
@@ -599,20 +599,18 @@ namespace occa {
     const std::string hashDir    = hashDirFor(filename, hash);
     sourceFilename = hashDir + kc::sourceFile;
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
-    bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
-
-    if (foundBinary) {
+    if (haveCachedBinary(hash, binaryFilename)) {
       if(verboseCompilation_f)
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
-      return buildFromBinary(binaryFilename, functionName);
+      recordCacheHit(hashDir);
+
+      // Keep the hash lock until the binary is loaded
+      buildFromBinary(binaryFilename, functionName);
+      releaseHash(hash, 0);
+
+      return this;
     }
 
     createSourceFileFrom(filename, hashDir, info);
@@ -621,6 +619,8 @@ namespace occa {
 
     std::string catFlags = info.flags + dHandle->compilerFlags;
 
+    const double compileStart = currentTime();
+
     cl::buildKernelFromSource(data_,
                               cFunction.c_str(), cFunction.size(),
                               functionName,
@@ -629,6 +629,9 @@ namespace occa {
 
     cl::saveProgramBinary(data_, binaryFilename, hash);
 
+    recordCompilation(hashDir, functionName, "clBuildProgram " + catFlags,
+                      currentTime() - compileStart, binaryFilename);
+
     releaseHash(hash, 0);
 
     return this;
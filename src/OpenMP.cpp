@@ -4,6 +4,8 @@
 
 #include "occa/Serial.hpp"
 #include "occa/OpenMP.hpp"
+#include "occa/aot.hpp"
+#include "occa/compileServer.hpp"
 
 #include <omp.h>
 
@@ -183,49 +185,122 @@ namespace occa {
     const std::string hashDir    = hashDirFor(filename, hash);
     sourceFilename = hashDir + kc::sourceFile;
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
-    bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    //---[ Check if compiler flag is added ]------
+    OpenMPDeviceData_t &dData_ = *((OpenMPDeviceData_t*) dHandle->data);
+
+    const std::string ompFlag = dData_.OpenMPFlag;
+
+    if((dHandle->compilerFlags.find(ompFlag) == std::string::npos) &&
+       (            info.flags.find(ompFlag) == std::string::npos)){
+
+      info.flags += ' ';
+      info.flags += ompFlag;
+    }
+    //============================================
+
+    if(aot::recording_f){
+      aot::recordUnit(hash, functionName, createSourceFrom(filename, info),
+                      dHandle->compilerEnvScript, dHandle->compiler,
+                      dHandle->compilerFlags + ' ' + info.flags);
+    }
+
+    if(useCompileServer_f && !sys::fileExists(binaryFilename)){
+      std::string flags = (dHandle->compilerFlags + ' ' + info.flags);
+
+      const std::string pchHeader = cpu::precompiledHeaderFor(dHandle->compilerEnvScript,
+                                                              dHandle->compiler,
+                                                              flags,
+                                                              info);
+      if(pchHeader.size())
+        flags += (" -include " + pchHeader);
 
-    if (foundBinary) {
+      if(verboseCompilation_f)
+        std::cout << "Compiling [" << functionName << "] through the compile server\n";
+
+      // The binary is cached once this returns true
+      compileServer::compile(hash, functionName, createSourceFrom(filename, info),
+                             sourceFilename, binaryFilename,
+                             dHandle->compilerEnvScript, dHandle->compiler, flags);
+    }
+
+    if (haveCachedBinary(hash, binaryFilename)) {
       if(verboseCompilation_f)
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
-      return buildFromBinary(binaryFilename, functionName);
+      recordCacheHit(hashDir);
+
+      // Keep the hash lock until the binary is loaded
+      buildFromBinary(binaryFilename, functionName);
+      releaseHash(hash, 0);
+
+      return this;
     }
 
     data = new OpenMPKernelData_t;
 
-    createSourceFileFrom(filename, hashDir, info);
+    if(inMemoryCompilation_f &&
+       (dHandle->compilerEnvScript.size() == 0)){
 
-    std::stringstream command;
+      OCCA_EXTRACT_DATA(OpenMP, Kernel);
 
-    if(dHandle->compilerEnvScript.size())
-      command << dHandle->compilerEnvScript << " && ";
+      const std::string source    = createSourceFrom(filename, info);
+      const std::string pchHeader = cpu::precompiledHeaderFor("",
+                                                              dHandle->compiler,
+                                                              dHandle->compilerFlags + ' ' + info.flags,
+                                                              info);
 
-    //---[ Check if compiler flag is added ]------
-    OpenMPDeviceData_t &dData_ = *((OpenMPDeviceData_t*) dHandle->data);
+      std::string flags = (dHandle->compilerFlags + ' ' + info.flags);
 
-    const std::string ompFlag = dData_.OpenMPFlag;
+      if(pchHeader.size())
+        flags += (" -include " + pchHeader);
 
-    if((dHandle->compilerFlags.find(ompFlag) == std::string::npos) &&
-       (            info.flags.find(ompFlag) == std::string::npos)){
+      if(verboseCompilation_f)
+        std::cout << "Compiling [" << functionName << "] in memory\n";
 
-      info.flags += ' ';
-      info.flags += ompFlag;
+      const double compileStart = currentTime();
+
+      if(cpu::compileInMemory(dHandle->compiler, flags, source,
+                              (persistInMemoryCompilation_f ? binaryFilename : ""),
+                              hash, data_.dlHandle)){
+
+        if(persistInMemoryCompilation_f){
+          writeToFile(sourceFilename, source);
+
+          recordCompilation(hashDir, functionName,
+                            dHandle->compiler + ' ' + flags + " -x c++ -",
+                            currentTime() - compileStart, binaryFilename);
+        }
+
+        data_.handle = cpu::dlsym(data_.dlHandle, functionName, hash);
+
+        releaseHash(hash, 0);
+
+        return this;
+      }
     }
-    //============================================
+
+    createSourceFileFrom(filename, hashDir, info);
+
+    std::stringstream command;
+
+    if(dHandle->compilerEnvScript.size())
+      command << dHandle->compilerEnvScript << " && ";
 
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
+    const std::string pchHeader = cpu::precompiledHeaderFor(dHandle->compilerEnvScript,
+                                                            dHandle->compiler,
+                                                            dHandle->compilerFlags + ' ' + info.flags,
+                                                            info);
+
     command << dHandle->compiler
             << ' '    << dHandle->compilerFlags
-            << ' '    << info.flags
-            << ' '    << sourceFilename
+            << ' '    << info.flags;
+
+    if(pchHeader.size())
+      command << " -include " << pchHeader;
+
+    command << ' '    << sourceFilename
             << " -o " << binaryFilename
             << " -I"  << env::OCCA_DIR << "/include"
             << " -L"  << env::OCCA_DIR << "/lib -locca"
@@ -254,6 +329,8 @@ namespace occa {
     if(verboseCompilation_f)
       std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
+    const double compileStart = currentTime();
+
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
     const int compileError = system(sCommand.c_str());
 #else
@@ -265,6 +342,9 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    recordCompilation(hashDir, functionName, sCommand,
+                      currentTime() - compileStart, binaryFilename);
+
     OCCA_EXTRACT_DATA(OpenMP, Kernel);
 
     data_.dlHandle = cpu::dlopen(binaryFilename, hash);
@@ -340,11 +420,7 @@ namespace occa {
   void kernel_t<OpenMP>::free(){
     OCCA_EXTRACT_DATA(OpenMP, Kernel);
 
-#if (OCCA_OS & (LINUX_OS | OSX_OS))
-    dlclose(data_.dlHandle);
-#else
-    FreeLibrary((HMODULE) (data_.dlHandle));
-#endif
+    cpu::dlclose(data_.dlHandle);
   }
   //==================================
 
@@ -365,7 +441,9 @@ namespace occa {
 
     textureInfo.arg = NULL;
     textureInfo.dim = 1;
+    textureInfo.bytesInEntry = 0;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
+    textureInfo.layout = textureLayout::rowMajor;
   }
 
   template <>
@@ -387,10 +465,14 @@ namespace occa {
     textureInfo.arg  = m.textureInfo.arg;
     textureInfo.dim  = m.textureInfo.dim;
 
+    textureInfo.bytesInEntry = m.textureInfo.bytesInEntry;
+
     textureInfo.w = m.textureInfo.w;
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
+    textureInfo.layout = m.textureInfo.layout;
+
     if(isATexture())
       handle = &textureInfo;
 
@@ -422,10 +504,12 @@ namespace occa {
                "Memory has size [" << size << "],"
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    void *destPtr      = (isATexture() ? textureInfo.arg : handle);
     const void *srcPtr = src;
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo, offset,
+                       srcPtr , NULL        , 0,
+                       bytes_);
   }
 
   template <>
@@ -445,10 +529,12 @@ namespace occa {
                "Source has size [" << src->size << "],"
                << "trying to access [ " << srcOffset << " , " << (srcOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture()      ? textureInfo.arg      : handle))      + destOffset;
-    const void *srcPtr = ((char*) (src->isATexture() ? src->textureInfo.arg : src->handle)) + srcOffset;
+    void *destPtr      = (isATexture()      ? textureInfo.arg      : handle);
+    const void *srcPtr = (src->isATexture() ? src->textureInfo.arg : src->handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo       , destOffset,
+                       srcPtr , &(src->textureInfo), srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -464,9 +550,11 @@ namespace occa {
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
     void *destPtr      = dest;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    const void *srcPtr = (isATexture() ? textureInfo.arg : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, NULL        , 0,
+                       srcPtr , &textureInfo, offset,
+                       bytes_);
   }
 
   template <>
@@ -486,10 +574,12 @@ namespace occa {
                "Destination has size [" << dest->size << "],"
                << "trying to access [ " << destOffset << " , " << (destOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (dest->isATexture() ? dest->textureInfo.arg : dest->handle)) + destOffset;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle))       + srcOffset;
+    void *destPtr      = (dest->isATexture() ? dest->textureInfo.arg : dest->handle);
+    const void *srcPtr = (isATexture()       ? textureInfo.arg       : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &(dest->textureInfo), destOffset,
+                       srcPtr , &textureInfo        , srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -502,11 +592,12 @@ namespace occa {
                "Memory has size [" << size << "],"
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    void *destPtr      = (isATexture() ? textureInfo.arg : handle);
     const void *srcPtr = src;
 
-
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo, offset,
+                       srcPtr , NULL        , 0,
+                       bytes_);
   }
 
   template <>
@@ -524,10 +615,12 @@ namespace occa {
                "Source has size [" << src->size << "],"
                << "trying to access [ " << srcOffset << " , " << (srcOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture()      ? textureInfo.arg      : handle))      + destOffset;
-    const void *srcPtr = ((char*) (src->isATexture() ? src->textureInfo.arg : src->handle)) + srcOffset;
+    void *destPtr      = (isATexture()      ? textureInfo.arg      : handle);
+    const void *srcPtr = (src->isATexture() ? src->textureInfo.arg : src->handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo       , destOffset,
+                       srcPtr , &(src->textureInfo), srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -541,9 +634,11 @@ namespace occa {
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
     void *destPtr      = dest;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    const void *srcPtr = (isATexture() ? textureInfo.arg : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, NULL        , 0,
+                       srcPtr , &textureInfo, offset,
+                       bytes_);
   }
 
   template <>
@@ -561,10 +656,12 @@ namespace occa {
                "Destination has size [" << dest->size << "],"
                << "trying to access [ " << destOffset << " , " << (destOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (dest->isATexture() ? dest->textureInfo.arg : dest->handle)) + destOffset;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle))       + srcOffset;
+    void *destPtr      = (dest->isATexture() ? dest->textureInfo.arg : dest->handle);
+    const void *srcPtr = (isATexture()       ? textureInfo.arg       : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &(dest->textureInfo), destOffset,
+                       srcPtr , &textureInfo        , srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -661,6 +758,7 @@ namespace occa {
   template <>
   void device_t<OpenMP>::setup(argInfoMap &aim){
     properties = aim;
+    cpu::addTopologyTo(properties);
 
     // Generate an OpenMP library dependency (so it doesn't crash when dlclose())
     omp_get_num_threads();
@@ -674,6 +772,9 @@ namespace occa {
     data_.supportsOpenMP = (data_.OpenMPFlag != omp::notSupported);
 
     cpu::addSharedBinaryFlagsTo(data_.vendor, compilerFlags);
+
+    if(aim.has("isa"))
+      data_.isaLevels = cpu::isaLevelsFrom(aim.get("isa"));
   }
 
   template <>
@@ -690,7 +791,8 @@ namespace occa {
          << parserVersion
          << compilerEnvScript
          << compiler
-         << compilerFlags;
+         << compilerFlags
+         << cpu::targetISA(compilerFlags + ' ' + info_.flags);
 
     return salt.str();
   }
@@ -896,7 +998,14 @@ namespace occa {
 
     k->dHandle = this;
 
-    k->buildFromSource(filename, functionName, info_);
+    kernelInfo info = info_;
+
+    if(data_.isaLevels.size()){
+      cpu::buildISAVariants(this, filename, functionName, info, data_.isaLevels,
+                            (data_.supportsOpenMP ? data_.OpenMPFlag : ""));
+    }
+
+    k->buildFromSource(filename, functionName, info);
 
     return k;
   }
@@ -1007,10 +1116,13 @@ namespace occa {
 
     mem->textureInfo.dim  = dim;
 
+    mem->textureInfo.bytesInEntry = type.bytes();
+
     mem->textureInfo.w = dims.x;
     mem->textureInfo.h = dims.y;
     mem->textureInfo.d = dims.z;
 
+    // Wrapped textures keep their row-major entries
     mem->textureInfo.arg = handle_;
 
     mem->handle = &(mem->textureInfo);
@@ -1047,13 +1159,21 @@ namespace occa {
 
     mem->textureInfo.dim  = dim;
 
+    mem->textureInfo.bytesInEntry = type.bytes();
+
     mem->textureInfo.w = dims.x;
     mem->textureInfo.h = dims.y;
     mem->textureInfo.d = dims.z;
 
-    mem->handle = cpu::malloc(mem->size);
+    mem->textureInfo.layout = ((dim == 2)                         ?
+                               cpu::textureLayoutFrom(properties) :
+                               textureLayout::rowMajor);
+
+    mem->textureInfo.arg = cpu::malloc(cpu::textureBytes(mem->textureInfo));
 
-    ::memcpy(mem->textureInfo.arg, src, mem->size);
+    cpu::textureMemcpy(mem->textureInfo.arg, &(mem->textureInfo), 0,
+                       src                 , NULL                , 0,
+                       mem->size);
 
     mem->handle = &(mem->textureInfo);
 
@@ -1,5 +1,7 @@
 #include "occa/Serial.hpp"
 #include "occa/Pthreads.hpp"
+#include "occa/aot.hpp"
+#include "occa/compileServer.hpp"
 
 namespace occa {
   //---[ Helper Functions ]-------------
@@ -21,24 +23,36 @@ namespace occa {
 
       while(true){
         // Fence local data (incase of out-of-socket updates)
-        if( *(data.pendingJobs) ){
+        const int pendingJobs = *((volatile int*) data.pendingJobs);
+
+        // Device is being freed
+        if(pendingJobs < 0)
+          break;
+
+        if(pendingJobs){
+          PthreadKernelInfo_t *pkInfo = NULL;
+
           data.kernelMutex->lock();
-          PthreadKernelInfo_t &pkInfo = *(data.pKernelInfo->front());
-          data.pKernelInfo->pop();
+          if(data.pKernelInfo->size()){
+            pkInfo = data.pKernelInfo->front();
+            data.pKernelInfo->pop();
+          }
           data.kernelMutex->unlock();
 
-          run(pkInfo);
+          // Jobs are queued per-worker, others are still running theirs
+          if(pkInfo == NULL)
+            continue;
+
+          run(*pkInfo);
 
-          //---[ Barrier ]----------------
           data.pendingJobsMutex->lock();
           --( *(data.pendingJobs) );
           data.pendingJobsMutex->unlock();
-
-          while((*data.pendingJobs) % data.count){}
-          //==============================
         }
       }
 
+      delete &data;
+
       return NULL;
     }
 
@@ -81,6 +95,7 @@ namespace occa {
                        pkInfo.argc, pkInfo.args);
 
       delete [] pkInfo.args;
+      delete [] pkInfo.argValues;
       delete &pkInfo;
     }
   }
@@ -170,24 +185,88 @@ namespace occa {
     const std::string hashDir    = hashDirFor(filename, hash);
     sourceFilename = hashDir + kc::sourceFile;
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
-    bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    if(aot::recording_f){
+      aot::recordUnit(hash, functionName, createSourceFrom(filename, info),
+                      dHandle->compilerEnvScript, dHandle->compiler,
+                      dHandle->compilerFlags + ' ' + info.flags);
+    }
+
+    if(useCompileServer_f && !sys::fileExists(binaryFilename)){
+      std::string flags = (dHandle->compilerFlags + ' ' + info.flags);
+
+      const std::string pchHeader = cpu::precompiledHeaderFor(dHandle->compilerEnvScript,
+                                                              dHandle->compiler,
+                                                              flags,
+                                                              info);
+      if(pchHeader.size())
+        flags += (" -include " + pchHeader);
 
-    if (foundBinary) {
+      if(verboseCompilation_f)
+        std::cout << "Compiling [" << functionName << "] through the compile server\n";
+
+      // The binary is cached once this returns true
+      compileServer::compile(hash, functionName, createSourceFrom(filename, info),
+                             sourceFilename, binaryFilename,
+                             dHandle->compilerEnvScript, dHandle->compiler, flags);
+    }
+
+    if (haveCachedBinary(hash, binaryFilename)) {
       if(verboseCompilation_f)
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
-      return buildFromBinary(binaryFilename, functionName);
+      recordCacheHit(hashDir);
+
+      // Keep the hash lock until the binary is loaded
+      buildFromBinary(binaryFilename, functionName);
+      releaseHash(hash, 0);
+
+      return this;
     }
 
     data = new PthreadsKernelData_t;
 
+    if(inMemoryCompilation_f &&
+       (dHandle->compilerEnvScript.size() == 0)){
+
+      OCCA_EXTRACT_DATA(Pthreads, Kernel);
+
+      const std::string source    = createSourceFrom(filename, info);
+      const std::string pchHeader = cpu::precompiledHeaderFor("",
+                                                              dHandle->compiler,
+                                                              dHandle->compilerFlags + ' ' + info.flags,
+                                                              info);
+
+      std::string flags = (dHandle->compilerFlags + ' ' + info.flags);
+
+      if(pchHeader.size())
+        flags += (" -include " + pchHeader);
+
+      if(verboseCompilation_f)
+        std::cout << "Compiling [" << functionName << "] in memory\n";
+
+      const double compileStart = currentTime();
+
+      if(cpu::compileInMemory(dHandle->compiler, flags, source,
+                              (persistInMemoryCompilation_f ? binaryFilename : ""),
+                              hash, data_.dlHandle)){
+
+        if(persistInMemoryCompilation_f){
+          writeToFile(sourceFilename, source);
+
+          recordCompilation(hashDir, functionName,
+                            dHandle->compiler + ' ' + flags + " -x c++ -",
+                            currentTime() - compileStart, binaryFilename);
+        }
+
+        data_.handle = cpu::dlsym(data_.dlHandle, functionName, hash);
+
+        releaseHash(hash, 0);
+
+        return this;
+      }
+    }
+
     createSourceFileFrom(filename, hashDir, info);
 
     std::stringstream command;
@@ -196,10 +275,19 @@ namespace occa {
       command << dHandle->compilerEnvScript << " && ";
 
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
+    const std::string pchHeader = cpu::precompiledHeaderFor(dHandle->compilerEnvScript,
+                                                            dHandle->compiler,
+                                                            dHandle->compilerFlags + ' ' + info.flags,
+                                                            info);
+
     command << dHandle->compiler
             << ' '    << dHandle->compilerFlags
-            << ' '    << info.flags
-            << ' '    << sourceFilename
+            << ' '    << info.flags;
+
+    if(pchHeader.size())
+      command << " -include " << pchHeader;
+
+    command << ' '    << sourceFilename
             << " -o " << binaryFilename
             << " -I"  << env::OCCA_DIR << "/include"
             << " -L"  << env::OCCA_DIR << "/lib -locca"
@@ -227,6 +315,8 @@ namespace occa {
     if(verboseCompilation_f)
       std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
+    const double compileStart = currentTime();
+
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
     const int compileError = system(sCommand.c_str());
 #else
@@ -238,6 +328,9 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    recordCompilation(hashDir, functionName, sCommand,
+                      currentTime() - compileStart, binaryFilename);
+
     OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
     data_.dlHandle = cpu::dlopen(binaryFilename, hash);
@@ -313,6 +406,11 @@ namespace occa {
 
     const int pThreadCount = data_.pThreadCount;
 
+    // Count jobs before queueing them so finish() can't miss running jobs
+    data_.pendingJobsMutex->lock();
+    *(data_.pendingJobs) += pThreadCount;
+    data_.pendingJobsMutex->unlock();
+
     for(int p = 0; p < pThreadCount; ++p){
       // Allocated individually since each thread frees their
       //   own custom arg
@@ -329,10 +427,22 @@ namespace occa {
 
       int argc = 0;
       pArgs.argc = kernelArg::argumentCount(kArgc, kArgs);
-      pArgs.args = new void*[pArgs.argc];
-      for(int i = 0; i < pArgs.argc; ++i){
+      pArgs.args      = new void*[pArgs.argc];
+      pArgs.argValues = new kernelArgData_t[pArgs.argc];
+
+      for(int i = 0; i < kArgc; ++i){
         for(int j = 0; j < kArgs[i].argc; ++j){
-          pArgs.args[argc++] = kArgs[i].args[j].ptr();
+          const kernelArg_t &arg = kArgs[i].args[j];
+
+          if(arg.info & kArgInfo::usePointer){
+            pArgs.args[argc] = arg.ptr();
+          }
+          else {
+            pArgs.argValues[argc] = arg.data;
+            pArgs.args[argc]      = &(pArgs.argValues[argc]);
+          }
+
+          ++argc;
         }
       }
 
@@ -340,10 +450,6 @@ namespace occa {
       data_.pKernelInfo[p]->push(&pArgs);
       data_.kernelMutex->unlock();
     }
-
-    data_.pendingJobsMutex->lock();
-    *(data_.pendingJobs) += data_.pThreadCount;
-    data_.pendingJobsMutex->unlock();
   }
 
   template <>
@@ -351,11 +457,7 @@ namespace occa {
     // [-] Fix later
     OCCA_EXTRACT_DATA(Pthreads, Kernel);
 
-#if (OCCA_OS & (LINUX_OS | OSX_OS))
-    dlclose(data_.dlHandle);
-#else
-    FreeLibrary((HMODULE) (data_.dlHandle));
-#endif
+    cpu::dlclose(data_.dlHandle);
   }
   //==================================
 
@@ -376,7 +478,9 @@ namespace occa {
 
     textureInfo.arg = NULL;
     textureInfo.dim = 1;
+    textureInfo.bytesInEntry = 0;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
+    textureInfo.layout = textureLayout::rowMajor;
   }
 
   template <>
@@ -398,10 +502,14 @@ namespace occa {
     textureInfo.arg  = m.textureInfo.arg;
     textureInfo.dim  = m.textureInfo.dim;
 
+    textureInfo.bytesInEntry = m.textureInfo.bytesInEntry;
+
     textureInfo.w = m.textureInfo.w;
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
+    textureInfo.layout = m.textureInfo.layout;
+
     if(isATexture())
       handle = &textureInfo;
 
@@ -433,10 +541,12 @@ namespace occa {
                "Memory has size [" << size << "],"
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    void *destPtr      = (isATexture() ? textureInfo.arg : handle);
     const void *srcPtr = src;
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo, offset,
+                       srcPtr , NULL        , 0,
+                       bytes_);
   }
 
   template <>
@@ -456,10 +566,12 @@ namespace occa {
                "Source has size [" << src->size << "],"
                << "trying to access [ " << srcOffset << " , " << (srcOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture()      ? textureInfo.arg      : handle))      + destOffset;
-    const void *srcPtr = ((char*) (src->isATexture() ? src->textureInfo.arg : src->handle)) + srcOffset;
+    void *destPtr      = (isATexture()      ? textureInfo.arg      : handle);
+    const void *srcPtr = (src->isATexture() ? src->textureInfo.arg : src->handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo       , destOffset,
+                       srcPtr , &(src->textureInfo), srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -475,9 +587,11 @@ namespace occa {
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
     void *destPtr      = dest;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    const void *srcPtr = (isATexture() ? textureInfo.arg : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, NULL        , 0,
+                       srcPtr , &textureInfo, offset,
+                       bytes_);
   }
 
   template <>
@@ -497,10 +611,12 @@ namespace occa {
                "Destination has size [" << dest->size << "],"
                << "trying to access [ " << destOffset << " , " << (destOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (dest->isATexture() ? dest->textureInfo.arg : dest->handle)) + destOffset;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle))       + srcOffset;
+    void *destPtr      = (dest->isATexture() ? dest->textureInfo.arg : dest->handle);
+    const void *srcPtr = (isATexture()       ? textureInfo.arg       : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &(dest->textureInfo), destOffset,
+                       srcPtr , &textureInfo        , srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -513,11 +629,12 @@ namespace occa {
                "Memory has size [" << size << "],"
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    void *destPtr      = (isATexture() ? textureInfo.arg : handle);
     const void *srcPtr = src;
 
-
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo, offset,
+                       srcPtr , NULL        , 0,
+                       bytes_);
   }
 
   template <>
@@ -535,10 +652,12 @@ namespace occa {
                "Source has size [" << src->size << "],"
                << "trying to access [ " << srcOffset << " , " << (srcOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture()      ? textureInfo.arg      : handle))      + destOffset;
-    const void *srcPtr = ((char*) (src->isATexture() ? src->textureInfo.arg : src->handle)) + srcOffset;
+    void *destPtr      = (isATexture()      ? textureInfo.arg      : handle);
+    const void *srcPtr = (src->isATexture() ? src->textureInfo.arg : src->handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo       , destOffset,
+                       srcPtr , &(src->textureInfo), srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -552,9 +671,11 @@ namespace occa {
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
     void *destPtr      = dest;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    const void *srcPtr = (isATexture() ? textureInfo.arg : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, NULL        , 0,
+                       srcPtr , &textureInfo, offset,
+                       bytes_);
   }
 
   template <>
@@ -572,10 +693,12 @@ namespace occa {
                "Destination has size [" << dest->size << "],"
                << "trying to access [ " << destOffset << " , " << (destOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (dest->isATexture() ? dest->textureInfo.arg : dest->handle)) + destOffset;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle))       + srcOffset;
+    void *destPtr      = (dest->isATexture() ? dest->textureInfo.arg : dest->handle);
+    const void *srcPtr = (isATexture()       ? textureInfo.arg       : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &(dest->textureInfo), destOffset,
+                       srcPtr , &textureInfo        , srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -671,6 +794,7 @@ namespace occa {
   template <>
   void device_t<Pthreads>::setup(argInfoMap &aim){
     properties = aim;
+    cpu::addTopologyTo(properties);
 
     data = new PthreadsDeviceData_t;
 
@@ -680,6 +804,9 @@ namespace occa {
 
     cpu::addSharedBinaryFlagsTo(data_.vendor, compilerFlags);
 
+    if(aim.has("isa"))
+      data_.isaLevels = cpu::isaLevelsFrom(aim.get("isa"));
+
     data_.pendingJobs = 0;
 
     data_.coreCount = cpu::getCoreCount();
@@ -749,15 +876,19 @@ namespace occa {
       }
     }
 
+    // Scattered threads alternate between sockets
+    const std::vector<int> scatterOrder = cpu::getTopology().scatterOrder();
+
     for(int p = 0; p < data_.pThreadCount; ++p){
       PthreadWorkerData_t *args = new PthreadWorkerData_t;
 
       args->rank  = p;
       args->count = data_.pThreadCount;
 
-      // [-] Need to know number of sockets
       if(data_.schedule & occa::compact)
         args->pinnedCore = (p % data_.coreCount);
+      else if((data_.schedule & occa::scatter) && scatterOrder.size())
+        args->pinnedCore = scatterOrder[p % scatterOrder.size()];
       else if(data_.schedule & occa::scatter)
         args->pinnedCore = (p % data_.coreCount);
       else // Manual
@@ -792,7 +923,8 @@ namespace occa {
          << parserVersion
          << compilerEnvScript
          << compiler
-         << compilerFlags;
+         << compilerFlags
+         << cpu::targetISA(compilerFlags + ' ' + info_.flags);
 
     return salt.str();
   }
@@ -937,7 +1069,7 @@ namespace occa {
     OCCA_EXTRACT_DATA(Pthreads, Device);
 
     // Fence local data (incase of out-of-socket updates)
-    while(data_.pendingJobs){}
+    while(*((volatile int*) &(data_.pendingJobs))){}
   }
 
   template <>
@@ -990,10 +1122,17 @@ namespace occa {
   kernel_v* device_t<Pthreads>::buildKernelFromSource(const std::string &filename,
                                                       const std::string &functionName,
                                                       const kernelInfo &info_){
+    OCCA_EXTRACT_DATA(Pthreads, Device);
+
+    kernelInfo info = info_;
+
+    if(data_.isaLevels.size())
+      cpu::buildISAVariants(this, filename, functionName, info, data_.isaLevels);
+
     kernel_v *k = new kernel_t<Pthreads>;
     k->dHandle  = this;
 
-    k->buildFromSource(filename, functionName, info_);
+    k->buildFromSource(filename, functionName, info);
 
     return k;
   }
@@ -1088,10 +1227,13 @@ namespace occa {
 
     mem->textureInfo.dim  = dim;
 
+    mem->textureInfo.bytesInEntry = type.bytes();
+
     mem->textureInfo.w = dims.x;
     mem->textureInfo.h = dims.y;
     mem->textureInfo.d = dims.z;
 
+    // Wrapped textures keep their row-major entries
     mem->textureInfo.arg = handle_;
 
     mem->handle = &(mem->textureInfo);
@@ -1128,15 +1270,22 @@ namespace occa {
 
     mem->textureInfo.dim  = dim;
 
+    mem->textureInfo.bytesInEntry = type.bytes();
+
     mem->textureInfo.w = dims.x;
     mem->textureInfo.h = dims.y;
     mem->textureInfo.d = dims.z;
 
-    mem->handle = cpu::malloc(mem->size);
+    mem->textureInfo.layout = ((dim == 2)                         ?
+                               cpu::textureLayoutFrom(properties) :
+                               textureLayout::rowMajor);
+
+    mem->textureInfo.arg = cpu::malloc(cpu::textureBytes(mem->textureInfo));
 
-    ::memcpy(mem->handle, src, mem->size);
+    cpu::textureMemcpy(mem->textureInfo.arg, &(mem->textureInfo), 0,
+                       src                 , NULL                , 0,
+                       mem->size);
 
-    mem->textureInfo.arg = mem->handle;
     mem->handle = &(mem->textureInfo);
 
     return mem;
@@ -1163,6 +1312,14 @@ namespace occa {
 
     OCCA_EXTRACT_DATA(Pthreads, Device);
 
+    // Workers exit on negative pending jobs
+    *((volatile int*) &(data_.pendingJobs)) = -1;
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    for(int p = 0; p < data_.pThreadCount; ++p)
+      pthread_join(data_.tid[p], NULL);
+#endif
+
     data_.pendingJobsMutex.free();
     data_.kernelMutex.free();
 
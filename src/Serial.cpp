@@ -1,9 +1,21 @@
 #include "occa/Serial.hpp"
+#include "occa/aot.hpp"
+#include "occa/compileServer.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <set>
 
 #include <strings.h>
 
+#if (OCCA_OS & LINUX_OS)
+#  include <spawn.h>
+#  include <unistd.h>
+#  include <sys/syscall.h>
+
+extern char **environ;
+#endif
+
 namespace occa {
   //---[ Helper Functions ]-----------
   namespace cpu {
@@ -141,16 +153,545 @@ namespace occa {
     std::string getCPUINFOField(const std::string &field,
 				bool ignoreCase){
 #if (OCCA_OS & LINUX_OS)
-      return getField("cat /proc/cpuinfo", field, ignoreCase, ':');
+      std::ifstream fs("/proc/cpuinfo");
+      std::string line;
+
+      const size_t fieldSize = field.size();
+
+      while(std::getline(fs, line)){
+        const size_t colon = line.find(':');
+
+        if(colon == std::string::npos)
+          continue;
+
+        std::string lineField = line.substr(0, colon);
+        strip(lineField);
+
+        if((lineField.size() != fieldSize) ||
+           (ignoreCase ?
+            strncasecmp(lineField.c_str(), field.c_str(), fieldSize) :
+            strncmp(lineField.c_str(), field.c_str(), fieldSize))){
+          continue;
+        }
+
+        std::string value = line.substr(colon + 1);
+        strip(value);
+
+        return value;
+      }
+
+      return "";
 #else
       return "";
 #endif
     }
 
+    //---[ Topology ]-------------------
+    topology_t::topology_t() :
+      processorName(),
+      vendor(),
+      frequency(0),
+      logicalCores(1),
+      physicalCores(1),
+      threadsPerCore(1),
+      sockets(1),
+      numaNodes(1),
+      coreSockets(),
+      cacheLineSize(0),
+      isaFlags() {
+
+      for(int i = 0; i < 4; ++i)
+        cacheSizes[i] = 0;
+    }
+
+    bool topology_t::hasISAFlag(const std::string &flag) const {
+      return (std::find(isaFlags.begin(), isaFlags.end(), flag) != isaFlags.end());
+    }
+
+    std::string topology_t::vectorSet() const {
+      if(hasISAFlag("avx512f"))
+        return "AVX-512";
+      if(hasISAFlag("avx2"))
+        return "AVX2";
+      if(hasISAFlag("avx"))
+        return "AVX";
+      if(hasISAFlag("sse4_2"))
+        return "SSE4.2";
+      if(hasISAFlag("sse2"))
+        return "SSE2";
+      if(hasISAFlag("asimd") || hasISAFlag("neon"))
+        return "NEON";
+
+      return "";
+    }
+
+    std::vector<int> topology_t::scatterOrder() const {
+      std::vector<int> order;
+
+      if(sockets <= 1){
+        for(int i = 0; i < logicalCores; ++i)
+          order.push_back(i);
+
+        return order;
+      }
+
+      // Round-robin over sockets, taking the next core on each
+      std::vector< std::vector<int> > socketCores(sockets);
+
+      for(size_t core = 0; core < coreSockets.size(); ++core){
+        const int socket = coreSockets[core];
+
+        if((0 <= socket) && (socket < sockets))
+          socketCores[socket].push_back((int) core);
+      }
+
+      for(size_t round = 0; (int) order.size() < logicalCores; ++round){
+        bool addedCore = false;
+
+        for(int s = 0; s < sockets; ++s){
+          if(round < socketCores[s].size()){
+            order.push_back(socketCores[s][round]);
+            addedCore = true;
+          }
+        }
+
+        if(!addedCore)
+          break;
+      }
+
+      return order;
+    }
+
+#if (OCCA_OS & LINUX_OS)
+    static std::string readSysFile(const std::string &filename){
+      std::ifstream fs(filename.c_str());
+      std::string line;
+
+      std::getline(fs, line);
+      strip(line);
+
+      return line;
+    }
+
+    // Expands lists like [0-3,8-11]
+    static std::vector<int> readCoreList(const std::string &filename){
+      std::vector<int> cores;
+
+      const std::string list = readSysFile(filename);
+      const char *c = list.c_str();
+
+      while(*c != '\0'){
+        const int first = (int) occa::atoi(c);
+        int last = first;
+
+        while(isADigit(*c))
+          ++c;
+
+        if(*c == '-'){
+          ++c;
+          last = (int) occa::atoi(c);
+
+          while(isADigit(*c))
+            ++c;
+        }
+
+        for(int core = first; core <= last; ++core)
+          cores.push_back(core);
+
+        if(*c == ',')
+          ++c;
+        else if(!isADigit(*c))
+          break;
+      }
+
+      return cores;
+    }
+
+    static void loadTopology(topology_t &topology){
+      const std::string cpuDir = "/sys/devices/system/cpu/";
+
+      //---[ /proc/cpuinfo ]------------
+      // Fields from the first processor are enough
+      std::ifstream fs("/proc/cpuinfo");
+      std::string line;
+      bool foundProcessor = false;
+
+      while(std::getline(fs, line)){
+        const size_t colon = line.find(':');
+
+        if(colon == std::string::npos){
+          if(foundProcessor && (line.find_first_not_of(" \t") == std::string::npos))
+            break;
+
+          continue;
+        }
+
+        std::string field = line.substr(0, colon);
+        std::string value = line.substr(colon + 1);
+
+        strip(field);
+        strip(value);
+
+        foundProcessor = true;
+
+        if(field == "model name")
+          topology.processorName = value;
+        else if(field == "vendor_id")
+          topology.vendor = value;
+        else if(field == "cpu MHz")
+          topology.frequency = (int) occa::atof(value);
+        else if((field == "flags") || (field == "Features")){
+          std::stringstream ss(value);
+          std::string flag;
+
+          while(ss >> flag)
+            topology.isaFlags.push_back(flag);
+        }
+      }
+      //================================
+
+      //---[ Cores and Sockets ]--------
+      std::vector<int> cores = readCoreList(cpuDir + "online");
+
+      if(cores.size() == 0){
+        for(int i = 0; i < getCoreCount(); ++i)
+          cores.push_back(i);
+      }
+
+      topology.logicalCores = (int) cores.size();
+
+      std::set< std::pair<int,int> > physicalCores;
+      std::map<int,int> socketIDs;
+
+      topology.coreSockets.assign(cores.back() + 1, 0);
+
+      for(size_t i = 0; i < cores.size(); ++i){
+        const std::string topologyDir = (cpuDir + "cpu" + toString(cores[i]) + "/topology/");
+
+        const std::string coreID   = readSysFile(topologyDir + "core_id");
+        const std::string socketID = readSysFile(topologyDir + "physical_package_id");
+
+        if((coreID.size() == 0) || (socketID.size() == 0))
+          continue;
+
+        const int socket = (int) occa::atoi(socketID);
+
+        // Sockets are renumbered from 0 in case package ids have gaps
+        if(socketIDs.find(socket) == socketIDs.end()){
+          const int nextID  = (int) socketIDs.size();
+          socketIDs[socket] = nextID;
+        }
+
+        topology.coreSockets[cores[i]] = socketIDs[socket];
+
+        physicalCores.insert(std::make_pair(socket, (int) occa::atoi(coreID)));
+      }
+
+      if(physicalCores.size()){
+        topology.physicalCores  = (int) physicalCores.size();
+        topology.sockets        = (int) socketIDs.size();
+        topology.threadsPerCore = std::max(1, topology.logicalCores / topology.physicalCores);
+      }
+      else
+        topology.physicalCores = topology.logicalCores;
+
+      const stringVector_t nodeDirs = sys::directoriesIn("/sys/devices/system/node/");
+      int numaNodes = 0;
+
+      for(size_t i = 0; i < nodeDirs.size(); ++i){
+        if((nodeDirs[i].find("node") == 0) &&
+           (4 < nodeDirs[i].size()) &&
+           isADigit(nodeDirs[i][4])){
+          ++numaNodes;
+        }
+      }
+
+      topology.numaNodes = std::max(1, numaNodes);
+      //================================
+
+      //---[ Caches ]-------------------
+      const std::string cacheDir = (cpuDir + "cpu" + toString(cores[0]) + "/cache/");
+
+      for(int index = 0; ; ++index){
+        const std::string indexDir = (cacheDir + "index" + toString(index) + "/");
+
+        if(!sys::dirExists(indexDir))
+          break;
+
+        if(readSysFile(indexDir + "type") == "Instruction")
+          continue;
+
+        const int level = (int) occa::atoi(readSysFile(indexDir + "level"));
+
+        if((level < 1) || (3 < level))
+          continue;
+
+        topology.cacheSizes[level] = bytesFromString(readSysFile(indexDir + "size"));
+
+        if(topology.cacheLineSize == 0)
+          topology.cacheLineSize = (int) occa::atoi(readSysFile(indexDir + "coherency_line_size"));
+      }
+      //================================
+
+      // Prefer the nominal max frequency over the current one
+      const std::string maxFrequency = readSysFile(cpuDir + "cpu" + toString(cores[0]) + "/cpufreq/cpuinfo_max_freq");
+
+      if(maxFrequency.size())
+        topology.frequency = (int) (occa::atoi(maxFrequency) / 1000);
+    }
+#else
+    static void loadTopology(topology_t &topology){
+      topology.processorName = getProcessorName();
+      topology.frequency     = getProcessorFrequency();
+      topology.logicalCores  = getCoreCount();
+      topology.physicalCores = topology.logicalCores;
+
+      topology.coreSockets.assign(topology.logicalCores, 0);
+
+      for(int level = 1; level <= 3; ++level)
+        topology.cacheSizes[level] = bytesFromString(getProcessorCacheSize(level));
+    }
+#endif
+
+    static mutex_t topologyMutex;
+    static topology_t *topology = NULL;
+
+    const topology_t& getTopology(){
+      topologyMutex.lock();
+
+      if(topology == NULL){
+        topology = new topology_t;
+        loadTopology(*topology);
+      }
+
+      topologyMutex.unlock();
+
+      return *topology;
+    }
+
+    void addTopologyTo(argInfoMap &properties){
+      const topology_t &t = getTopology();
+
+      std::map<std::string, std::string> topologyProperties;
+
+      topologyProperties["processorName"]  = t.processorName;
+      topologyProperties["frequency"]      = toString(t.frequency);
+      topologyProperties["logicalCores"]   = toString(t.logicalCores);
+      topologyProperties["physicalCores"]  = toString(t.physicalCores);
+      topologyProperties["threadsPerCore"] = toString(t.threadsPerCore);
+      topologyProperties["sockets"]        = toString(t.sockets);
+      topologyProperties["numaNodes"]      = toString(t.numaNodes);
+      topologyProperties["L1CacheSize"]    = toString(t.cacheSizes[1]);
+      topologyProperties["L2CacheSize"]    = toString(t.cacheSizes[2]);
+      topologyProperties["L3CacheSize"]    = toString(t.cacheSizes[3]);
+      topologyProperties["cacheLineSize"]  = toString(t.cacheLineSize);
+      topologyProperties["vectorSet"]      = t.vectorSet();
+
+      std::string isaFlags;
+
+      for(size_t i = 0; i < t.isaFlags.size(); ++i){
+        if(i)
+          isaFlags += ' ';
+
+        isaFlags += t.isaFlags[i];
+      }
+
+      topologyProperties["isaFlags"] = isaFlags;
+
+      std::map<std::string, std::string>::iterator it = topologyProperties.begin();
+
+      while(it != topologyProperties.end()){
+        if(!properties.has(it->first))
+          properties.set(it->first, it->second);
+
+        ++it;
+      }
+    }
+    //==================================
+
+    //---[ ISA Variants ]---------------
+    int isaLevel(const std::string &isa){
+      if(isa == "x86-64-v2")
+        return 2;
+      if(isa == "x86-64-v3")
+        return 3;
+      if(isa == "x86-64-v4")
+        return 4;
+
+      return 0;
+    }
+
+    bool hostSupportsISA(const std::string &isa){
+      // Features each x86-64 psABI level adds, named as in /proc/cpuinfo
+      static const char *v2Flags[] = {"cx16", "lahf_lm", "popcnt", "sse4_1", "sse4_2", "ssse3", NULL};
+      static const char *v3Flags[] = {"avx", "avx2", "bmi1", "bmi2", "f16c", "fma", "abm", "movbe", "xsave", NULL};
+      static const char *v4Flags[] = {"avx512f", "avx512bw", "avx512cd", "avx512dq", "avx512vl", NULL};
+
+      static const char **levelFlags[3] = {v2Flags, v3Flags, v4Flags};
+
+      const int level = isaLevel(isa);
+
+      if(level == 0)
+        return false;
+
+      const topology_t &topology = getTopology();
+
+      for(int l = 2; l <= level; ++l){
+        for(const char **flag = levelFlags[l - 2]; *flag; ++flag){
+          if(!topology.hasISAFlag(*flag))
+            return false;
+        }
+      }
+
+      return true;
+    }
+
+    std::string hostISA(){
+      static const char *levels[3] = {"x86-64-v4", "x86-64-v3", "x86-64-v2"};
+
+      for(int i = 0; i < 3; ++i){
+        if(hostSupportsISA(levels[i]))
+          return levels[i];
+      }
+
+      return "";
+    }
+
+    std::string targetISA(const std::string &flags){
+      std::stringstream ss(flags);
+      std::string flag, isa;
+
+      while(ss >> flag){
+        if((flag == "-march=native") ||
+           (flag == "-mcpu=native")  ||
+           (flag == "-xHost")){
+
+          const std::string host = hostISA();
+
+          // Other CPUs fall back on their vector set
+          isa = ("native:" + (host.size() ? host : getTopology().vectorSet()));
+        }
+        else if(flag.find("-march=") == 0){
+          isa = flag.substr(7);
+        }
+      }
+
+      return isa;
+    }
+
+    stringVector_t isaLevelsFrom(const std::string &isaInfo){
+      stringVector_t levels;
+      std::string level;
+
+      // Device info values come back as [[x86 - 64 - v2, x86 - 64 - v3]]
+      for(size_t i = 0; i <= isaInfo.size(); ++i){
+        const char c = ((i < isaInfo.size()) ? isaInfo[i] : ',');
+
+        if((c == ' ') || (c == '[') || (c == ']'))
+          continue;
+
+        if(c != ','){
+          level += c;
+          continue;
+        }
+
+        if(level.size() == 0)
+          continue;
+
+        if(level == "auto")
+          level = hostISA();
+        else if(level.find("x86-64-") != 0)
+          level = ("x86-64-" + level);
+
+        OCCA_CHECK((level.size() == 0) || isaLevel(level),
+                   "ISA level [" << level << "] is not one of: auto, x86-64-v2, x86-64-v3, x86-64-v4");
+
+        if(level.size() &&
+           (std::find(levels.begin(), levels.end(), level) == levels.end())){
+          levels.push_back(level);
+        }
+
+        level.clear();
+      }
+
+      return levels;
+    }
+
+    void buildISAVariants(device_v *dHandle,
+                          const std::string &filename,
+                          const std::string &functionName,
+                          kernelInfo &info,
+                          const stringVector_t &isaLevels,
+                          const std::string &extraFlags){
+      std::string best;
+
+      for(size_t i = 0; i < isaLevels.size(); ++i){
+        if(hostSupportsISA(isaLevels[i]) &&
+           (isaLevel(best) < isaLevel(isaLevels[i]))){
+
+          best = isaLevels[i];
+        }
+      }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      occa::device device(dHandle);
+
+      for(size_t i = 0; i < isaLevels.size(); ++i){
+        if(isaLevels[i] == best)
+          continue;
+
+        kernelInfo variantInfo = info;
+        variantInfo.addCompilerFlag("-march=" + isaLevels[i]);
+
+        dHandle->addOccaHeadersToInfo(variantInfo);
+
+        const std::string hash = getFileContentHash(filename,
+                                                    dHandle->getInfoSalt(variantInfo));
+
+        const std::string hashDir = hashDirFor(filename, hash);
+
+        compileServer::request_t request;
+
+        request.hash              = hash;
+        request.functionName      = functionName;
+        request.sourceFilename    = (hashDir + kc::sourceFile);
+        request.binaryFilename    = (hashDir + kc::binaryFile);
+        request.compilerEnvScript = device.getCompilerEnvScript();
+        request.compiler          = device.getCompiler();
+        request.flags             = (device.getCompilerFlags() + ' ' + variantInfo.flags);
+
+        if(extraFlags.size() &&
+           (request.flags.find(extraFlags) == std::string::npos)){
+
+          request.flags += (' ' + extraFlags);
+        }
+
+        if(sys::fileExists(request.binaryFilename))
+          continue;
+
+        request.source = createSourceFrom(filename, variantInfo);
+
+        if(verboseCompilation_f)
+          std::cout << "Compiling [" << functionName << "] for [" << isaLevels[i] << "]\n";
+
+        // Variants this CPU can't run are only cached, failures aren't fatal
+        std::string output;
+
+        if(!compileServer::build(request, output)){
+          std::cout << "Could not compile [" << functionName << "] for ["
+                    << isaLevels[i] << "]:\n" << output;
+        }
+      }
+#endif
+
+      if(best.size())
+        info.addCompilerFlag("-march=" + best);
+    }
+    //==================================
+
     std::string getProcessorName(){
 #if   (OCCA_OS & LINUX_OS)
-//    return getFieldFrom("getCPUINFOField", "model name");
-      return getCPUINFOField("model name");
+      return getTopology().processorName;
 #elif (OCCA_OS == OSX_OS)
       size_t bufferSize = 100;
       char buffer[100];
@@ -182,15 +723,7 @@ namespace occa {
 
     int getProcessorFrequency(){
 #if   (OCCA_OS & LINUX_OS)
-      std::stringstream ss;
-      int freq;
-
-//    ss << getFieldFrom("getCPUINFOField", "cpu MHz");
-      ss << getCPUINFOField("cpu MHz");
-
-      ss >> freq;
-
-      return freq;
+      return getTopology().frequency;
 #elif (OCCA_OS == OSX_OS)
       uint64_t frequency = 0;
       size_t size = sizeof(frequency);
@@ -211,17 +744,12 @@ namespace occa {
 
     std::string getProcessorCacheSize(int level){
 #if   (OCCA_OS & LINUX_OS)
-      std::stringstream field;
-
-      field << 'L' << level;
-
-      if(level == 1)
-        field << 'd';
-
-      field << " cache";
+      if((level < 1) || (3 < level) ||
+         (getTopology().cacheSizes[level] == 0)){
+        return "";
+      }
 
-//    return getFieldFrom("getLSCPUField", field.str());
-      return getField("lscpu", field.str(), false, ':');
+      return stringifyBytes(getTopology().cacheSizes[level]);
 #elif (OCCA_OS == OSX_OS)
       std::stringstream ss;
       ss << "hw.l" << level;
@@ -350,7 +878,18 @@ namespace occa {
     std::string getDeviceListInfo(){
       std::stringstream ss, ssFreq;
 
-      ss << getCoreCount();
+      const topology_t &topology = getTopology();
+
+      ss << topology.physicalCores;
+
+      if(topology.physicalCores < topology.logicalCores)
+        ss << " (" << topology.logicalCores << " threads)";
+
+      if(1 < topology.sockets)
+        ss << ", " << topology.sockets << " sockets";
+
+      if(1 < topology.numaNodes)
+        ss << ", " << topology.numaNodes << " NUMA nodes";
 
       uintptr_t ram      = installedRAM();
       std::string ramStr = stringifyBytes(ram);
@@ -397,6 +936,8 @@ namespace occa {
         ss << tab[ps]  << "|  Memory (RAM)         | " << ramStr                          << '\n'; ps = true;
       if(clockFrequency.size())
         ss << tab[ps]  << "|  Clock Frequency      | " << clockFrequency                  << '\n'; ps = true;
+      if(topology.vectorSet().size())
+        ss << tab[ps]  << "|  CPU Vector Set       | " << topology.vectorSet()            << '\n'; ps = true;
       ss   << tab[ps]  << "|  SIMD Instruction Set | " << OCCA_VECTOR_SET                 << '\n'
            << tab[ps]  << "|  SIMD Width           | " << (32*OCCA_SIMD_WIDTH) << " bits" << '\n'; ps = true;
       if(l1.size())
@@ -517,6 +1058,233 @@ namespace occa {
         flags = (sFlags + " " + flags);
     }
 
+    std::string precompiledHeaderFor(const std::string &compilerEnvScript,
+                                     const std::string &compiler,
+                                     const std::string &flags,
+                                     const kernelInfo &info){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      if(!usePrecompiledHeaders_f)
+        return "";
+
+      const int vendor_ = cpu::compilerVendor(compiler);
+
+      std::string pchExtension;
+
+      if(vendor_ & cpu::vendor::GNU)
+        pchExtension = ".gch";
+      else if(vendor_ & cpu::vendor::LLVM)
+        pchExtension = ".pch";
+      else
+        return "";
+
+      setupOccaHeaders(info);
+
+      const std::string modeHeader = info.getModeHeaderFilename();
+      const std::string primitives = sys::getFilename("[occa]/primitives.hpp");
+
+      // Header sizes and times are salted in to rebuild after they change
+      std::stringstream ss;
+
+      ss << compilerEnvScript << '\n'
+         << compiler          << '\n'
+         << flags             << '\n'
+         << modeHeader << ' ' << sys::fileBytes(modeHeader) << ' ' << sys::lastModified(modeHeader) << '\n'
+         << primitives << ' ' << sys::fileBytes(primitives) << ' ' << sys::lastModified(primitives) << '\n';
+
+      const std::string hash = getContentHash(ss.str(), "precompiledHeader");
+
+      const std::string pchDir     = env::OCCA_CACHE_DIR + "pch/" + hash + "/";
+      const std::string header     = pchDir + "occa.hpp";
+      const std::string pchFile    = header + pchExtension;
+      const std::string failedFile = pchDir + "unsupported";
+
+      if(sys::fileExists(pchFile))
+        return header;
+
+      if(sys::fileExists(failedFile))
+        return "";
+
+      if(!haveHash(hash, 0)){
+        waitForHash(hash, 0);
+
+        return (sys::fileExists(pchFile) ? header : "");
+      }
+
+      if(!sys::fileExists(pchFile) && !sys::fileExists(failedFile)){
+        writeToFile(header,
+                    "#include \"" + modeHeader + "\"\n"
+                    "#include \"" + primitives + "\"\n");
+
+        const std::string tmpFile = pchFile + ".tmp";
+
+        ss.str("");
+
+        if(compilerEnvScript.size())
+          ss << compilerEnvScript << " && ";
+
+        ss << compiler
+           << ' '    << flags
+           << " -I"  << env::OCCA_DIR << "/include"
+           << " -c -x c++-header " << header
+           << " -o " << tmpFile;
+
+        const std::string pchCommand = ss.str();
+
+        if(verboseCompilation_f)
+          std::cout << "Precompiling OCCA headers\n" << pchCommand << "\n";
+
+        const int pchError = system((pchCommand + " > /dev/null 2>&1").c_str());
+
+        // Kernels still compile without the precompiled header
+        if(pchError || rename(tmpFile.c_str(), pchFile.c_str())){
+          remove(tmpFile.c_str());
+          writeToFile(failedFile, pchCommand + "\n");
+        }
+      }
+
+      releaseHash(hash, 0);
+
+      return (sys::fileExists(pchFile) ? header : "");
+#else
+      return "";
+#endif
+    }
+
+#if (OCCA_OS & LINUX_OS)
+    static std::map<void*, int> memfdHandles;
+    static mutex_t memfdMutex;
+#endif
+
+    bool compileInMemory(const std::string &compiler,
+                         const std::string &flags,
+                         const std::string &source,
+                         const std::string &binaryFilename,
+                         const std::string &hash,
+                         void *&dlHandle){
+#if (OCCA_OS & LINUX_OS) && defined(SYS_memfd_create)
+      const int memfd = (int) syscall(SYS_memfd_create, "occaKernel", 0);
+
+      if(memfd < 0)
+        return false;
+
+      std::stringstream ss;
+
+      ss << "/dev/fd/" << memfd;
+      const std::string outputFile = ss.str();
+
+      ss.str("");
+      ss << compiler
+         << ' '    << flags
+         << " -x c++ -"
+         << " -o " << outputFile
+         << " -I"  << env::OCCA_DIR << "/include"
+         << " -L"  << env::OCCA_DIR << "/lib -locca";
+
+      const std::string command = ss.str();
+
+      if(verboseCompilation_f)
+        std::cout << command << " < [in-memory source]\n";
+
+      // posix_spawn skips the shell, flags are split on whitespace
+      stringVector_t args;
+      std::string arg;
+
+      while(ss >> arg)
+        args.push_back(arg);
+
+      std::vector<char*> argv(args.size() + 1, (char*) NULL);
+
+      for(size_t i = 0; i < args.size(); ++i)
+        argv[i] = const_cast<char*>(args[i].c_str());
+
+      int sourcePipe[2];
+
+      if(pipe(sourcePipe)){
+        ::close(memfd);
+        return false;
+      }
+
+      posix_spawn_file_actions_t actions;
+      posix_spawn_file_actions_init(&actions);
+      posix_spawn_file_actions_adddup2(&actions, sourcePipe[0], 0);
+      posix_spawn_file_actions_addclose(&actions, sourcePipe[0]);
+      posix_spawn_file_actions_addclose(&actions, sourcePipe[1]);
+
+      pid_t pid;
+      const int spawnError = posix_spawnp(&pid, argv[0], &actions, NULL, &argv[0], environ);
+
+      posix_spawn_file_actions_destroy(&actions);
+      ::close(sourcePipe[0]);
+
+      if(spawnError){
+        ::close(sourcePipe[1]);
+        ::close(memfd);
+        return false;
+      }
+
+      // Don't die from SIGPIPE if the compiler exits before reading everything
+      void (*sigpipeHandler)(int) = ::signal(SIGPIPE, SIG_IGN);
+
+      const char *c    = source.c_str();
+      size_t bytesLeft = source.size();
+
+      while(bytesLeft){
+        const ssize_t bytesWritten = ::write(sourcePipe[1], c, bytesLeft);
+
+        if(bytesWritten <= 0){
+          if((bytesWritten < 0) && (errno == EINTR))
+            continue;
+          break;
+        }
+
+        c         += bytesWritten;
+        bytesLeft -= bytesWritten;
+      }
+
+      ::close(sourcePipe[1]);
+      ::signal(SIGPIPE, sigpipeHandler);
+
+      int status;
+
+      while((waitpid(pid, &status, 0) < 0) && (errno == EINTR))
+        ; // Do Nothing
+
+      if(!WIFEXITED(status) || WEXITSTATUS(status)){
+        ::close(memfd);
+
+        if(0 < hash.size())
+          releaseHash(hash, 0);
+
+        OCCA_CHECK(false, "Compilation error");
+      }
+
+      if(binaryFilename.size()){
+        sys::mkpath(getFileDirectory(binaryFilename));
+
+        std::ofstream fs(binaryFilename.c_str(), std::ios::binary);
+        std::ifstream memfs(outputFile.c_str(), std::ios::binary);
+
+        fs << memfs.rdbuf();
+      }
+
+      ss.str("");
+      ss.clear();
+      ss << "/proc/self/fd/" << memfd;
+
+      dlHandle = cpu::dlopen(ss.str(), hash);
+
+      // dlopen() matches libraries by name, keep the memfd open
+      //   until dlclose() so /proc/self/fd/N stays unique
+      memfdMutex.lock();
+      memfdHandles[dlHandle] = memfd;
+      memfdMutex.unlock();
+
+      return true;
+#else
+      return false;
+#endif
+    }
+
     void* malloc(uintptr_t bytes){
       void* ptr;
 
@@ -533,6 +1301,129 @@ namespace occa {
       ::free(ptr);
     }
 
+    //---[ Texture Layouts ]----------
+    int textureLayoutFrom(argInfoMap &properties){
+      if(!properties.has("textureLayout"))
+        return textureLayout::rowMajor;
+
+      const std::string layout = properties.get("textureLayout");
+
+      if(layout == "tiled")
+        return textureLayout::tiled;
+      if(layout == "morton")
+        return textureLayout::morton;
+
+      OCCA_CHECK(layout == "rowMajor",
+                 "Texture layout [" << layout << "] is not supported,"
+                 << " use [rowMajor], [tiled] or [morton]");
+
+      return textureLayout::rowMajor;
+    }
+
+    uintptr_t textureBytes(const textureInfo_t &info){
+      if(info.dim == 1)
+        return (info.w * info.bytesInEntry);
+
+      return (textureLayout::entries2D(info.layout, info.w, info.h) * info.bytesInEntry);
+    }
+
+    static bool isSwizzled(const textureInfo_t *texture){
+      return ((texture != NULL)   &&
+              (texture->dim == 2) &&
+              (texture->layout != textureLayout::rowMajor));
+    }
+
+    // Walks row-major entries of [texture], or of a buffer if it's NULL
+    class textureWalker_t {
+    public:
+      const textureInfo_t *texture;
+      uintptr_t entry, x, y;
+
+      textureWalker_t(const textureInfo_t *texture_,
+                      const uintptr_t entry_) :
+        texture(isSwizzled(texture_) ? texture_ : NULL),
+        entry(entry_),
+        x(0),
+        y(0) {
+
+        if(texture){
+          x = (entry % texture->w);
+          y = (entry / texture->w);
+        }
+      }
+
+      inline uintptr_t index() const {
+        return (texture                                                   ?
+                textureLayout::index2D(texture->layout, texture->w, x, y) :
+                entry);
+      }
+
+      inline void next(){
+        ++entry;
+
+        if(texture && (++x == texture->w)){
+          x = 0;
+          ++y;
+        }
+      }
+    };
+
+    void textureMemcpy(void *dest, const textureInfo_t *destTexture, const uintptr_t destOffset,
+                       const void *src, const textureInfo_t *srcTexture, const uintptr_t srcOffset,
+                       const uintptr_t bytes){
+
+      const bool destIsSwizzled = isSwizzled(destTexture);
+      const bool srcIsSwizzled  = isSwizzled(srcTexture);
+
+      if(!destIsSwizzled && !srcIsSwizzled){
+        ::memcpy(((char*) dest) + destOffset,
+                 ((const char*) src) + srcOffset,
+                 bytes);
+        return;
+      }
+
+      const uintptr_t bie = (destIsSwizzled            ?
+                             destTexture->bytesInEntry :
+                             srcTexture->bytesInEntry);
+
+      // Whole copies between textures with the same layout keep the tiles
+      if(destIsSwizzled && srcIsSwizzled                         &&
+         (destTexture->layout       == srcTexture->layout)       &&
+         (destTexture->w            == srcTexture->w)            &&
+         (destTexture->bytesInEntry == srcTexture->bytesInEntry) &&
+         (destOffset == 0) && (srcOffset == 0)                   &&
+         (bytes == (destTexture->w * destTexture->h * bie))){
+
+        ::memcpy(dest, src, textureBytes(*destTexture));
+        return;
+      }
+
+      OCCA_CHECK(!destIsSwizzled || !srcIsSwizzled ||
+                 (destTexture->bytesInEntry == srcTexture->bytesInEntry),
+                 "Textures with entries of [" << destTexture->bytesInEntry << "] and ["
+                 << srcTexture->bytesInEntry << "] bytes can't be copied to each other");
+
+      OCCA_CHECK(((destOffset % bie) == 0) &&
+                 ((srcOffset  % bie) == 0) &&
+                 ((bytes      % bie) == 0),
+                 "Copies to or from tiled textures need whole entries of [" << bie << "] bytes");
+
+      textureWalker_t destWalker(destTexture, destOffset / bie);
+      textureWalker_t srcWalker(srcTexture  , srcOffset  / bie);
+
+      const uintptr_t entries = (bytes / bie);
+
+      for(uintptr_t i = 0; i < entries; ++i){
+        ::memcpy(((char*) dest)      + (destWalker.index() * bie),
+                 ((const char*) src) + (srcWalker.index()  * bie),
+                 bie);
+
+        destWalker.next();
+        srcWalker.next();
+      }
+    }
+    //================================
+
     void* dlopen(const std::string &filename,
                  const std::string &hash){
 
@@ -559,6 +1450,27 @@ namespace occa {
       return dlHandle;
     }
 
+    void dlclose(void *dlHandle){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      ::dlclose(dlHandle);
+
+#  if (OCCA_OS & LINUX_OS)
+      memfdMutex.lock();
+
+      std::map<void*, int>::iterator it = memfdHandles.find(dlHandle);
+
+      if(it != memfdHandles.end()){
+        ::close(it->second);
+        memfdHandles.erase(it);
+      }
+
+      memfdMutex.unlock();
+#  endif
+#else
+      FreeLibrary((HMODULE) dlHandle);
+#endif
+    }
+
     handleFunction_t dlsym(void *dlHandle,
                            const std::string &functionName,
                            const std::string &hash){
@@ -686,24 +1598,88 @@ namespace occa {
     const std::string hashDir    = hashDirFor(filename, hash);
     sourceFilename = hashDir + kc::sourceFile;
     binaryFilename = hashDir + fixBinaryName(kc::binaryFile);
-    bool foundBinary = true;
 
-    if (!haveHash(hash, 0))
-      waitForHash(hash, 0);
-    else if (sys::fileExists(binaryFilename))
-      releaseHash(hash, 0);
-    else
-      foundBinary = false;
+    if(aot::recording_f){
+      aot::recordUnit(hash, functionName, createSourceFrom(filename, info),
+                      dHandle->compilerEnvScript, dHandle->compiler,
+                      dHandle->compilerFlags + ' ' + info.flags);
+    }
+
+    if(useCompileServer_f && !sys::fileExists(binaryFilename)){
+      std::string flags = (dHandle->compilerFlags + ' ' + info.flags);
+
+      const std::string pchHeader = cpu::precompiledHeaderFor(dHandle->compilerEnvScript,
+                                                              dHandle->compiler,
+                                                              flags,
+                                                              info);
+      if(pchHeader.size())
+        flags += (" -include " + pchHeader);
+
+      if(verboseCompilation_f)
+        std::cout << "Compiling [" << functionName << "] through the compile server\n";
+
+      // The binary is cached once this returns true
+      compileServer::compile(hash, functionName, createSourceFrom(filename, info),
+                             sourceFilename, binaryFilename,
+                             dHandle->compilerEnvScript, dHandle->compiler, flags);
+    }
 
-    if (foundBinary) {
+    if (haveCachedBinary(hash, binaryFilename)) {
       if(verboseCompilation_f)
         std::cout << "Found cached binary of [" << compressFilename(filename) << "] in [" << compressFilename(binaryFilename) << "]\n";
 
-      return buildFromBinary(binaryFilename, functionName);
+      recordCacheHit(hashDir);
+
+      // Keep the hash lock until the binary is loaded
+      buildFromBinary(binaryFilename, functionName);
+      releaseHash(hash, 0);
+
+      return this;
     }
 
     data = new SerialKernelData_t;
 
+    if(inMemoryCompilation_f &&
+       (dHandle->compilerEnvScript.size() == 0)){
+
+      OCCA_EXTRACT_DATA(Serial, Kernel);
+
+      const std::string source    = createSourceFrom(filename, info);
+      const std::string pchHeader = cpu::precompiledHeaderFor("",
+                                                              dHandle->compiler,
+                                                              dHandle->compilerFlags + ' ' + info.flags,
+                                                              info);
+
+      std::string flags = (dHandle->compilerFlags + ' ' + info.flags);
+
+      if(pchHeader.size())
+        flags += (" -include " + pchHeader);
+
+      if(verboseCompilation_f)
+        std::cout << "Compiling [" << functionName << "] in memory\n";
+
+      const double compileStart = currentTime();
+
+      if(cpu::compileInMemory(dHandle->compiler, flags, source,
+                              (persistInMemoryCompilation_f ? binaryFilename : ""),
+                              hash, data_.dlHandle)){
+
+        if(persistInMemoryCompilation_f){
+          writeToFile(sourceFilename, source);
+
+          recordCompilation(hashDir, functionName,
+                            dHandle->compiler + ' ' + flags + " -x c++ -",
+                            currentTime() - compileStart, binaryFilename);
+        }
+
+        data_.handle = cpu::dlsym(data_.dlHandle, functionName, hash);
+
+        releaseHash(hash, 0);
+
+        return this;
+      }
+    }
+
     createSourceFileFrom(filename, hashDir, info);
 
     std::stringstream command;
@@ -712,10 +1688,19 @@ namespace occa {
       command << dHandle->compilerEnvScript << " && ";
 
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
+    const std::string pchHeader = cpu::precompiledHeaderFor(dHandle->compilerEnvScript,
+                                                            dHandle->compiler,
+                                                            dHandle->compilerFlags + ' ' + info.flags,
+                                                            info);
+
     command << dHandle->compiler
             << ' '    << dHandle->compilerFlags
-            << ' '    << info.flags
-            << ' '    << sourceFilename
+            << ' '    << info.flags;
+
+    if(pchHeader.size())
+      command << " -include " << pchHeader;
+
+    command << ' '    << sourceFilename
             << " -o " << binaryFilename
             << " -I"  << env::OCCA_DIR << "/include"
             << " -L"  << env::OCCA_DIR << "/lib -locca"
@@ -768,6 +1753,8 @@ namespace occa {
     if(verboseCompilation_f)
       std::cout << "Compiling [" << functionName << "]\n" << sCommand << "\n";
 
+    const double compileStart = currentTime();
+
 #if (OCCA_OS & (LINUX_OS | OSX_OS))
     const int compileError = system(sCommand.c_str());
 #else
@@ -779,6 +1766,9 @@ namespace occa {
       OCCA_CHECK(false, "Compilation error");
     }
 
+    recordCompilation(hashDir, functionName, sCommand,
+                      currentTime() - compileStart, binaryFilename);
+
     OCCA_EXTRACT_DATA(Serial, Kernel);
 
     data_.dlHandle = cpu::dlopen(binaryFilename, hash);
@@ -855,11 +1845,7 @@ namespace occa {
   void kernel_t<Serial>::free(){
     OCCA_EXTRACT_DATA(Serial, Kernel);
 
-#if (OCCA_OS & (LINUX_OS | OSX_OS))
-    dlclose(data_.dlHandle);
-#else
-    FreeLibrary((HMODULE) (data_.dlHandle));
-#endif
+    cpu::dlclose(data_.dlHandle);
   }
   //==================================
 
@@ -880,7 +1866,9 @@ namespace occa {
 
     textureInfo.arg = NULL;
     textureInfo.dim = 1;
+    textureInfo.bytesInEntry = 0;
     textureInfo.w = textureInfo.h = textureInfo.d = 0;
+    textureInfo.layout = textureLayout::rowMajor;
   }
 
   template <>
@@ -902,10 +1890,14 @@ namespace occa {
     textureInfo.arg  = m.textureInfo.arg;
     textureInfo.dim  = m.textureInfo.dim;
 
+    textureInfo.bytesInEntry = m.textureInfo.bytesInEntry;
+
     textureInfo.w = m.textureInfo.w;
     textureInfo.h = m.textureInfo.h;
     textureInfo.d = m.textureInfo.d;
 
+    textureInfo.layout = m.textureInfo.layout;
+
     if(isATexture())
       handle = &textureInfo;
 
@@ -937,10 +1929,12 @@ namespace occa {
                "Memory has size [" << size << "],"
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    void *destPtr      = (isATexture() ? textureInfo.arg : handle);
     const void *srcPtr = src;
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo, offset,
+                       srcPtr , NULL        , 0,
+                       bytes_);
   }
 
   template <>
@@ -960,10 +1954,12 @@ namespace occa {
                "Source has size [" << src->size << "],"
                << "trying to access [ " << srcOffset << " , " << (srcOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture()      ? textureInfo.arg      : handle))      + destOffset;
-    const void *srcPtr = ((char*) (src->isATexture() ? src->textureInfo.arg : src->handle)) + srcOffset;
+    void *destPtr      = (isATexture()      ? textureInfo.arg      : handle);
+    const void *srcPtr = (src->isATexture() ? src->textureInfo.arg : src->handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo       , destOffset,
+                       srcPtr , &(src->textureInfo), srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -979,9 +1975,11 @@ namespace occa {
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
     void *destPtr      = dest;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    const void *srcPtr = (isATexture() ? textureInfo.arg : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, NULL        , 0,
+                       srcPtr , &textureInfo, offset,
+                       bytes_);
   }
 
   template <>
@@ -1001,10 +1999,12 @@ namespace occa {
                "Destination has size [" << dest->size << "],"
                << "trying to access [ " << destOffset << " , " << (destOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (dest->isATexture() ? dest->textureInfo.arg : dest->handle)) + destOffset;
-    const void *srcPtr = ((char*) (isATexture()       ? textureInfo.arg       : handle))       + srcOffset;
+    void *destPtr      = (dest->isATexture() ? dest->textureInfo.arg : dest->handle);
+    const void *srcPtr = (isATexture()       ? textureInfo.arg       : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &(dest->textureInfo), destOffset,
+                       srcPtr , &textureInfo        , srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -1017,11 +2017,12 @@ namespace occa {
                "Memory has size [" << size << "],"
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    void *destPtr      = (isATexture() ? textureInfo.arg : handle);
     const void *srcPtr = src;
 
-
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo, offset,
+                       srcPtr , NULL        , 0,
+                       bytes_);
   }
 
   template <>
@@ -1039,10 +2040,12 @@ namespace occa {
                "Source has size [" << src->size << "],"
                << "trying to access [ " << srcOffset << " , " << (srcOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (isATexture()      ? textureInfo.arg      : handle))         + destOffset;
-    const void *srcPtr = ((char*) (src->isATexture() ? src->textureInfo.arg : src->handle)) + srcOffset;;
+    void *destPtr      = (isATexture()      ? textureInfo.arg      : handle);
+    const void *srcPtr = (src->isATexture() ? src->textureInfo.arg : src->handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &textureInfo       , destOffset,
+                       srcPtr , &(src->textureInfo), srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -1056,9 +2059,11 @@ namespace occa {
                << "trying to access [ " << offset << " , " << (offset + bytes_) << " ]");
 
     void *destPtr      = dest;
-    const void *srcPtr = ((char*) (isATexture() ? textureInfo.arg : handle)) + offset;
+    const void *srcPtr = (isATexture() ? textureInfo.arg : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, NULL        , 0,
+                       srcPtr , &textureInfo, offset,
+                       bytes_);
   }
 
   template <>
@@ -1076,10 +2081,12 @@ namespace occa {
                "Destination has size [" << dest->size << "],"
                << "trying to access [ " << destOffset << " , " << (destOffset + bytes_) << " ]");
 
-    void *destPtr      = ((char*) (dest->isATexture() ? dest->textureInfo.arg : dest->handle)) + destOffset;
-    const void *srcPtr = ((char*) (isATexture()       ? textureInfo.arg       : handle))       + srcOffset;
+    void *destPtr      = (dest->isATexture() ? dest->textureInfo.arg : dest->handle);
+    const void *srcPtr = (isATexture()       ? textureInfo.arg       : handle);
 
-    ::memcpy(destPtr, srcPtr, bytes_);
+    cpu::textureMemcpy(destPtr, &(dest->textureInfo), destOffset,
+                       srcPtr , &textureInfo        , srcOffset,
+                       bytes_);
   }
 
   template <>
@@ -1173,6 +2180,7 @@ namespace occa {
   template <>
   void device_t<Serial>::setup(argInfoMap &aim){
     properties = aim;
+    cpu::addTopologyTo(properties);
 
     data = new SerialDeviceData_t;
 
@@ -1181,6 +2189,9 @@ namespace occa {
     data_.vendor = cpu::compilerVendor(compiler);
 
     cpu::addSharedBinaryFlagsTo(data_.vendor, compilerFlags);
+
+    if(aim.has("isa"))
+      data_.isaLevels = cpu::isaLevelsFrom(aim.get("isa"));
   }
 
   template <>
@@ -1197,7 +2208,8 @@ namespace occa {
          << parserVersion
          << compilerEnvScript
          << compiler
-         << compilerFlags;
+         << compilerFlags
+         << cpu::targetISA(compilerFlags + ' ' + info_.flags);
 
     return salt.str();
   }
@@ -1387,10 +2399,17 @@ namespace occa {
   kernel_v* device_t<Serial>::buildKernelFromSource(const std::string &filename,
                                                     const std::string &functionName,
                                                     const kernelInfo &info_){
+    OCCA_EXTRACT_DATA(Serial, Device);
+
+    kernelInfo info = info_;
+
+    if(data_.isaLevels.size())
+      cpu::buildISAVariants(this, filename, functionName, info, data_.isaLevels);
+
     kernel_v *k = new kernel_t<Serial>;
     k->dHandle = this;
 
-    k->buildFromSource(filename, functionName, info_);
+    k->buildFromSource(filename, functionName, info);
 
     return k;
   }
@@ -1488,10 +2507,13 @@ namespace occa {
 
     mem->textureInfo.dim  = dim;
 
+    mem->textureInfo.bytesInEntry = type.bytes();
+
     mem->textureInfo.w = dims.x;
     mem->textureInfo.h = dims.y;
     mem->textureInfo.d = dims.z;
 
+    // Wrapped textures keep their row-major entries
     mem->textureInfo.arg = handle_;
 
     mem->handle = &(mem->textureInfo);
@@ -1528,13 +2550,21 @@ namespace occa {
 
     mem->textureInfo.dim  = dim;
 
+    mem->textureInfo.bytesInEntry = type.bytes();
+
     mem->textureInfo.w = dims.x;
     mem->textureInfo.h = dims.y;
     mem->textureInfo.d = dims.z;
 
-    mem->handle = cpu::malloc(mem->size);
+    mem->textureInfo.layout = ((dim == 2)                         ?
+                               cpu::textureLayoutFrom(properties) :
+                               textureLayout::rowMajor);
+
+    mem->textureInfo.arg = cpu::malloc(cpu::textureBytes(mem->textureInfo));
 
-    ::memcpy(mem->textureInfo.arg, src, mem->size);
+    cpu::textureMemcpy(mem->textureInfo.arg, &(mem->textureInfo), 0,
+                       src                 , NULL                , 0,
+                       mem->size);
 
     mem->handle = &(mem->textureInfo);
 
@@ -0,0 +1,550 @@
+#include <fstream>
+#include <set>
+
+#include "occa/aot.hpp"
+#include "occa/Serial.hpp"
+
+namespace occa {
+  //---[ Ahead-of-Time Bundles ]------------------
+  namespace aot {
+    unit_t::unit_t() :
+      hash(),
+      functionName(),
+      source(),
+      compilerEnvScript(),
+      compiler(),
+      flags() {}
+
+    std::string unit_t::symbol() const {
+      return ("occaAOT_" + hash + "_" + functionName);
+    }
+
+    kernelEntry_t::kernelEntry_t() :
+      hash(),
+      functionName(),
+      bundle(),
+      usesParser(false),
+      metaInfo(),
+      symbols() {}
+
+    manifestEntry_t::manifestEntry_t() :
+      filename(),
+      functionName(),
+      deviceInfo("mode = Serial"),
+      info() {}
+
+    bool recording_f = false;
+
+    std::vector<unit_t> units;
+    std::vector<kernelEntry_t> recordedKernels;
+
+    void recordUnit(const std::string &hash,
+                    const std::string &functionName,
+                    const std::string &source,
+                    const std::string &compilerEnvScript,
+                    const std::string &compiler,
+                    const std::string &flags){
+      unit_t unit;
+
+      unit.hash              = hash;
+      unit.functionName      = functionName;
+      unit.source            = source;
+      unit.compilerEnvScript = compilerEnvScript;
+      unit.compiler          = compiler;
+      unit.flags             = flags;
+
+      units.push_back(unit);
+    }
+
+    void recordKernel(const std::string &hash,
+                      const std::string &functionName,
+                      const bool usesParser,
+                      const parsedKernelInfo &metaInfo,
+                      const size_t firstUnit){
+      kernelEntry_t entry;
+
+      entry.hash         = hash;
+      entry.functionName = functionName;
+      entry.usesParser   = usesParser;
+      entry.metaInfo     = metaInfo;
+
+      for(size_t i = firstUnit; i < units.size(); ++i)
+        entry.symbols.push_back(units[i].symbol());
+
+      OCCA_CHECK(0 < entry.symbols.size(),
+                 "Kernel [" << functionName << "] was not built by a CPU mode");
+
+      recordedKernels.push_back(entry);
+    }
+
+    //---[ Runtime ]----------------------
+    typedef std::map<std::string,kernelEntry_t> kernelEntryMap_t;
+    typedef kernelEntryMap_t::iterator          kernelEntryMapIterator;
+
+    static mutex_t mutex;
+    static kernelEntryMap_t kernelEntries;
+    static bool searchedCacheDir = false;
+
+    static std::string entryKey(const std::string &hash,
+                                const std::string &functionName){
+      return (hash + ':' + functionName);
+    }
+
+    static std::string restOf(std::stringstream &ss){
+      std::string rest;
+
+      std::getline(ss >> std::ws, rest);
+
+      return rest;
+    }
+
+    static void loadIndex(const std::string &bundleDir_){
+      std::string bundleDir = bundleDir_;
+      env::endDirWithSlash(bundleDir);
+
+      const std::string bundle    = bundleDir + "bundle.so";
+      const std::string indexFile = bundleDir + "index";
+
+      if(!sys::fileExists(bundle) ||
+         !sys::fileExists(indexFile)){
+
+        return;
+      }
+
+      std::ifstream fs(indexFile.c_str());
+
+      kernelEntry_t entry;
+      std::string line;
+
+      while(std::getline(fs, line)){
+        std::stringstream ss(line);
+        std::string key;
+
+        ss >> key;
+
+        if(key == "kernel"){
+          entry = kernelEntry_t();
+          entry.bundle = bundle;
+
+          ss >> entry.hash >> entry.functionName;
+        }
+        else if(key == "parser")
+          ss >> entry.usesParser;
+        else if(key == "name")
+          ss >> entry.metaInfo.name;
+        else if(key == "baseName")
+          ss >> entry.metaInfo.baseName;
+        else if(key == "nestedKernels")
+          ss >> entry.metaInfo.nestedKernels;
+        else if(key == "argument"){
+          argumentInfo arg;
+
+          ss >> arg.pos >> arg.isConst >> arg.name;
+
+          entry.metaInfo.argumentInfos.push_back(arg);
+        }
+        else if(key == "flops")
+          entry.metaInfo.cost.flops = restOf(ss);
+        else if(key == "bytesLoaded")
+          entry.metaInfo.cost.bytesLoaded = restOf(ss);
+        else if(key == "bytesStored")
+          entry.metaInfo.cost.bytesStored = restOf(ss);
+        else if(key == "exact")
+          ss >> entry.metaInfo.cost.isExact;
+        else if(key == "symbol"){
+          std::string symbol;
+          ss >> symbol;
+
+          entry.symbols.push_back(symbol);
+        }
+        else if(key == "end"){
+          if(entry.symbols.size())
+            kernelEntries[entryKey(entry.hash, entry.functionName)] = entry;
+        }
+      }
+
+      // Kernels are loaded with their own dlopen() which only bumps
+      //   the reference count of the bundle opened here
+      cpu::dlopen(bundle);
+    }
+
+    static void searchCacheDir(){
+      if(searchedCacheDir)
+        return;
+
+      searchedCacheDir = true;
+
+      const std::string aotDir = env::OCCA_CACHE_DIR + "aot/";
+      const stringVector_t bundleDirs = sys::directoriesIn(aotDir);
+
+      for(size_t i = 0; i < bundleDirs.size(); ++i)
+        loadIndex(aotDir + bundleDirs[i]);
+    }
+
+    bool hasBundles(){
+      mutex.lock();
+
+      searchCacheDir();
+      const bool foundKernels = (0 < kernelEntries.size());
+
+      mutex.unlock();
+
+      return foundKernels;
+    }
+
+    void load(const std::string &bundleDir){
+      mutex.lock();
+
+      searchCacheDir();
+      loadIndex(sys::getFilename(bundleDir));
+
+      mutex.unlock();
+    }
+
+    const kernelEntry_t* find(const std::string &hash,
+                              const std::string &functionName){
+      const kernelEntry_t *entry = NULL;
+
+      mutex.lock();
+
+      searchCacheDir();
+
+      kernelEntryMapIterator it = kernelEntries.find(entryKey(hash, functionName));
+
+      if(it != kernelEntries.end())
+        entry = &(it->second);
+
+      mutex.unlock();
+
+      return entry;
+    }
+    //====================================
+
+    //---[ Bundling ]---------------------
+    static void addManifestValue(manifestEntry_t &entry,
+                                 const std::string &key,
+                                 const std::string &value,
+                                 const std::string &manifestDir){
+      if(key == "file"){
+        entry.filename = ((value[0] == '/') ? value : (manifestDir + value));
+      }
+      else if(key == "function"){
+        entry.functionName = value;
+      }
+      else if(key == "mode"){
+        entry.deviceInfo = value;
+      }
+      else if(key == "define"){
+        size_t split = value.find('=');
+
+        if(split == std::string::npos)
+          split = value.find(' ');
+
+        std::string macro = value.substr(0, split);
+        std::string macroValue;
+
+        if(split != std::string::npos)
+          macroValue = value.substr(split + 1);
+
+        strip(macro);
+        strip(macroValue);
+
+        // Matches addDefine() with numeric and string literal values
+        entry.info.addDefine(macro, macroValue.c_str());
+      }
+      else if(key == "include"){
+        entry.info.addInclude((value[0] == '/') ? value : (manifestDir + value));
+      }
+      else if(key == "flags"){
+        entry.info.addCompilerFlag(value);
+      }
+      else {
+        OCCA_CHECK(false,
+                   "Unknown manifest key [" << key << "]");
+      }
+    }
+
+    std::vector<manifestEntry_t> readManifest(const std::string &manifestFile){
+      std::vector<manifestEntry_t> entries;
+
+      const std::string filename    = sys::getFilename(manifestFile);
+      const std::string manifestDir = getFileDirectory(filename);
+
+      std::ifstream fs(filename.c_str());
+
+      OCCA_CHECK(fs.is_open(),
+                 "Could not read manifest [" << manifestFile << "]");
+
+      std::string line;
+      int lineNumber = 0;
+
+      while(std::getline(fs, line)){
+        ++lineNumber;
+
+        const size_t comment = line.find('#');
+
+        if(comment != std::string::npos)
+          line = line.substr(0, comment);
+
+        strip(line);
+
+        if(line.size() == 0)
+          continue;
+
+        if(line == "kernel:"){
+          entries.push_back(manifestEntry_t());
+          continue;
+        }
+
+        const size_t colon = line.find(':');
+
+        OCCA_CHECK((colon != std::string::npos) && entries.size(),
+                   "Manifest [" << manifestFile << "], line " << lineNumber
+                   << ": Expected [kernel:] or [key: value]");
+
+        std::string key   = line.substr(0, colon);
+        std::string value = line.substr(colon + 1);
+
+        strip(key);
+        strip(value);
+
+        addManifestValue(entries.back(), key, value, manifestDir);
+      }
+
+      for(size_t i = 0; i < entries.size(); ++i){
+        OCCA_CHECK(entries[i].filename.size() && entries[i].functionName.size(),
+                   "Manifest [" << manifestFile << "], kernel " << (i + 1)
+                   << ": Missing [file] or [function]");
+      }
+
+      return entries;
+    }
+
+    // Only the unit's kernel stays global, everything else that could
+    //   be defined in more than one unit is made local
+    static void localizeSymbols(const unit_t &unit,
+                                const std::string &objectFile){
+      std::string output;
+
+      sys::call("nm -g --defined-only " + objectFile, output);
+
+      const std::string localsFile = objectFile + ".locals";
+      const std::string symbol     = unit.symbol();
+
+      std::stringstream ss(output), locals;
+      std::string line;
+      int localCount = 0;
+
+      while(std::getline(ss, line)){
+        std::stringstream lineSS(line);
+        std::string address, type, name;
+
+        lineSS >> address >> type >> name;
+
+        if((type.size() == 1) &&
+           (std::string("TDBRGS").find(type[0]) != std::string::npos) &&
+           (name != symbol)){
+
+          locals << name << '\n';
+          ++localCount;
+        }
+      }
+
+      if(localCount == 0)
+        return;
+
+      writeToFile(localsFile, locals.str());
+
+      const std::string command = ("objcopy --localize-symbols=" + localsFile + ' ' + objectFile);
+
+      OCCA_CHECK(sys::call(command) == 0,
+                 "Could not localize symbols in [" << objectFile << "]");
+    }
+
+    static std::string compileUnit(const unit_t &unit,
+                                   const std::string &unitDir){
+      const std::string symbol     = unit.symbol();
+      const std::string sourceFile = unitDir + symbol + ".cpp";
+      const std::string objectFile = unitDir + symbol + ".o";
+
+      writeToFile(sourceFile, unit.source);
+
+      std::stringstream command;
+
+      if(unit.compilerEnvScript.size())
+        command << unit.compilerEnvScript << " && ";
+
+      command << unit.compiler
+              << ' '    << unit.flags
+              << " -c"
+              << " -D"  << unit.functionName << '=' << symbol
+              << ' '    << sourceFile
+              << " -o " << objectFile
+              << " -I"  << env::OCCA_DIR << "/include";
+
+      if(verboseCompilation_f)
+        std::cout << command.str() << '\n';
+
+      OCCA_CHECK(system(command.str().c_str()) == 0,
+                 "Compiling [" << unit.functionName << "] for the bundle failed");
+
+      localizeSymbols(unit, objectFile);
+
+      return objectFile;
+    }
+
+    void build(const std::string &manifestFile,
+               const std::string &bundleDir_){
+#if (OCCA_OS & LINUX_OS)
+      std::string bundleDir = sys::getFilename(bundleDir_);
+      env::endDirWithSlash(bundleDir);
+
+      const std::vector<manifestEntry_t> entries = readManifest(manifestFile);
+
+      //---[ Record kernel sources ]------
+      std::map<std::string,device> devices;
+
+      units.clear();
+      recordedKernels.clear();
+
+      recording_f = true;
+
+      for(size_t i = 0; i < entries.size(); ++i){
+        const manifestEntry_t &entry = entries[i];
+
+        device &dev = devices[entry.deviceInfo];
+
+        if(!dev.getDHandle())
+          dev.setup(entry.deviceInfo);
+
+        std::cout << "Building [" << entry.functionName << "] from ["
+                  << compressFilename(entry.filename) << "] in ["
+                  << entry.deviceInfo << "]\n";
+
+        kernel k = dev.buildKernel(entry.filename,
+                                   entry.functionName,
+                                   entry.info);
+        k.free();
+      }
+
+      recording_f = false;
+      //================================
+
+      //---[ Compile units ]--------------
+      const std::string unitDir = bundleDir + "units/";
+      sys::rmrf(unitDir);
+      sys::mkpath(unitDir);
+
+      std::set<std::string> compiledSymbols, linkFlags;
+      std::stringstream objects;
+
+      for(size_t i = 0; i < units.size(); ++i){
+        const unit_t &unit = units[i];
+
+        if(compiledSymbols.find(unit.symbol()) != compiledSymbols.end())
+          continue;
+
+        compiledSymbols.insert(unit.symbol());
+        linkFlags.insert(unit.flags);
+
+        objects << ' ' << compileUnit(unit, unitDir);
+      }
+      //================================
+
+      //---[ Link bundle ]----------------
+      const unit_t &firstUnit = units[0];
+
+      const std::string bundle    = bundleDir + "bundle.so";
+      const std::string tmpBundle = bundle + ".tmp";
+
+      std::stringstream command;
+
+      if(firstUnit.compilerEnvScript.size())
+        command << firstUnit.compilerEnvScript << " && ";
+
+      command << firstUnit.compiler;
+
+      for(std::set<std::string>::iterator it = linkFlags.begin(); it != linkFlags.end(); ++it)
+        command << ' ' << *it;
+
+      // Compiler flags can set [-x c++] which would apply to the objects
+      command << " -shared -fPIC -x none"
+              << objects.str()
+              << " -o " << tmpBundle
+              << " -L"  << env::OCCA_DIR << "/lib -locca";
+
+      if(verboseCompilation_f)
+        std::cout << command.str() << '\n';
+
+      OCCA_CHECK(system(command.str().c_str()) == 0,
+                 "Linking bundle [" << bundle << "] failed");
+
+      // Processes with the previous bundle loaded keep their mapping
+      rename(tmpBundle.c_str(), bundle.c_str());
+
+      writeIndex(bundleDir + "index", recordedKernels);
+
+      sys::rmrf(unitDir);
+      //================================
+
+      std::cout << "Bundled " << recordedKernels.size() << " kernels ("
+                << compiledSymbols.size() << " symbols) in [" << bundle << "]\n";
+
+      units.clear();
+      recordedKernels.clear();
+
+      for(std::map<std::string,device>::iterator it = devices.begin(); it != devices.end(); ++it)
+        it->second.free();
+#else
+      OCCA_CHECK(false,
+                 "Ahead-of-time bundles are only supported on Linux");
+#endif
+    }
+
+    void writeIndex(const std::string &indexFile,
+                    const std::vector<kernelEntry_t> &kernels){
+      std::stringstream ss;
+
+      ss << "version 1\n";
+
+      for(size_t i = 0; i < kernels.size(); ++i){
+        const kernelEntry_t &entry = kernels[i];
+        const parsedKernelInfo &metaInfo = entry.metaInfo;
+
+        ss << "kernel " << entry.hash << ' ' << entry.functionName << '\n'
+           << "  parser " << entry.usesParser << '\n';
+
+        if(entry.usesParser){
+          ss << "  name "          << metaInfo.name          << '\n'
+             << "  baseName "      << metaInfo.baseName      << '\n'
+             << "  nestedKernels " << metaInfo.nestedKernels << '\n';
+
+          for(size_t a = 0; a < metaInfo.argumentInfos.size(); ++a){
+            const argumentInfo &arg = metaInfo.argumentInfos[a];
+
+            ss << "  argument " << arg.pos << ' ' << arg.isConst << ' ' << arg.name << '\n';
+          }
+
+          if(!metaInfo.cost.isEmpty()){
+            ss << "  flops "       << metaInfo.cost.flops       << '\n'
+               << "  bytesLoaded " << metaInfo.cost.bytesLoaded << '\n'
+               << "  bytesStored " << metaInfo.cost.bytesStored << '\n'
+               << "  exact "       << metaInfo.cost.isExact     << '\n';
+          }
+        }
+
+        for(size_t s = 0; s < entry.symbols.size(); ++s)
+          ss << "  symbol " << entry.symbols[s] << '\n';
+
+        ss << "end\n";
+      }
+
+      const std::string tmpIndex = indexFile + ".tmp";
+
+      writeToFile(tmpIndex, ss.str());
+      rename(tmpIndex.c_str(), indexFile.c_str());
+    }
+    //====================================
+  }
+  //==============================================
+}
@@ -0,0 +1,145 @@
+#include "occa/array/expression.hpp"
+#include "occa/miniLib.hpp"
+
+namespace occa {
+  //---[ Array Expressions ]----------------------
+  namespace arrayExpression {
+    static std::string arrayEntry(const int arg,
+                                  const uintptr_t offset){
+      std::stringstream ss;
+
+      ss << 'a' << arg;
+
+      if(offset)
+        ss << "[i + o" << arg << ']';
+      else
+        ss << "[i]";
+
+      return ss.str();
+    }
+
+    builder_t::builder_t(occa::device device_,
+                         const uintptr_t entries_) :
+      device(device_),
+      entries(entries_) {}
+
+    void builder_t::addArray(const std::string &type,
+                             occa::memory memory,
+                             const uintptr_t entries_,
+                             const uintptr_t offset){
+
+      OCCA_CHECK(entries_ == entries,
+                 "Array expressions need arrays with the same number of entries, found ["
+                 << entries_ << "] and [" << entries << ']');
+
+      OCCA_CHECK(memory.getDHandle() == device.getDHandle(),
+                 "Array expressions need arrays on the same device");
+
+      OCCA_CHECK((entries + offset) <= (uintptr_t) std::numeric_limits<int>::max(),
+                 "Array expressions are limited to [" << std::numeric_limits<int>::max() << "] entries");
+
+      memory_v *mHandle = memory.getMHandle();
+
+      const int arrayCount = (int) arrays.size();
+
+      for(int i = 0; i < arrayCount; ++i){
+        if((arrays[i].mHandle == mHandle) &&
+           (arrays[i].offset  == offset)){
+
+          expr << arrayEntry(arrays[i].arg, offset);
+          return;
+        }
+      }
+
+      const int arg = (int) args.size();
+
+      arrayArg_t arrayArg;
+      arrayArg.mHandle = mHandle;
+      arrayArg.offset  = offset;
+      arrayArg.arg     = arg;
+
+      arrays.push_back(arrayArg);
+
+      params << ",\n"
+             << "                          const " << type << " *a" << arg;
+
+      args.push_back(memory);
+
+      // Offsets are arguments, views of any offset share a kernel
+      if(offset){
+        params << ",\n"
+               << "                          const int o" << arg;
+
+        args.push_back((int) offset);
+      }
+
+      expr << arrayEntry(arg, offset);
+    }
+
+    void builder_t::addScalar(const std::string &type,
+                              const kernelArg &value){
+
+      const int arg = (int) args.size();
+
+      params << ",\n"
+             << "                          const " << type << " s" << arg;
+
+      expr << 's' << arg;
+
+      args.push_back(value);
+    }
+
+    void builder_t::evaluate(const std::string &type,
+                             occa::memory out,
+                             const uintptr_t outOffset,
+                             const std::string &assignment){
+
+      OCCA_CHECK((entries + outOffset) <= (uintptr_t) std::numeric_limits<int>::max(),
+                 "Array expressions are limited to [" << std::numeric_limits<int>::max() << "] entries");
+
+      if(entries == 0)
+        return;
+
+      if(outOffset){
+        params << ",\n"
+               << "                          const int outOffset";
+
+        args.push_back((int) outOffset);
+      }
+
+      const std::string statement = ((outOffset ? "out[i + outOffset] " : "out[i] ") +
+                                     assignment + " (" + type + ") " +
+                                     expr.str() + ";");
+
+      std::stringstream ss;
+
+      ss << "kernel void occaArrayExpr(const int entries,\n"
+         << "                          " << type << " *out" << params.str() << "){\n"
+         << "  for(int i = 0; i < entries; ++i; tile(1024)){\n"
+         << "    if(i < entries)\n"
+         << "      " << statement << '\n'
+         << "  }\n"
+         << "}\n";
+
+      // Argument names only depend on their position, the
+      //   statement and parameters make up the expression's shape
+      kernel k = miniLib::cachedKernel(device,
+                                       "arrayExpr|" + params.str() + '|' + statement,
+                                       ss.str(),
+                                       "occaArrayExpr");
+
+      k.clearArgumentList();
+
+      k.addArgument(0, (int) entries);
+      k.addArgument(1, out);
+
+      const int argCount = (int) args.size();
+
+      for(int i = 0; i < argCount; ++i)
+        k.addArgument(2 + i, args[i]);
+
+      k.runFromArguments();
+    }
+  }
+  //==============================================
+}
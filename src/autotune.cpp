@@ -0,0 +1,410 @@
+#include <cstdio>
+
+#include "occa/autotune.hpp"
+#include "occa/Serial.hpp"
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+#  include <sys/wait.h>
+#endif
+
+namespace occa {
+  //---[ Auto-Tuning ]----------------------------
+  autotuner::autotuner(occa::device device_,
+                       const std::string &filename_,
+                       const std::string &functionName_,
+                       const kernelInfo &info_) :
+    device(device_),
+    filename(filename_),
+    functionName(functionName_),
+    info(info_),
+    hasWorkingDims(false),
+    dims(1),
+    warmups(2),
+    iterations(10) {}
+
+  autotuner& autotuner::addPowersOfTwo(const std::string &name,
+                                       const int minValue,
+                                       const int maxValue){
+    OCCA_CHECK((0 < minValue) && (minValue <= maxValue),
+               "Powers of two for [" << name << "] need 0 < min <= max");
+
+    std::vector<int> values;
+
+    for(int v = 1; v <= maxValue; v *= 2){
+      if(minValue <= v)
+        values.push_back(v);
+    }
+
+    return addDefine(name, values);
+  }
+
+  autotuner& autotuner::addDefineValues(const std::string &name,
+                                        const stringVector_t &values){
+    OCCA_CHECK(0 < values.size(),
+               "Define [" << name << "] needs at least one value to tune");
+
+    for(size_t i = 0; i < values.size(); ++i){
+      OCCA_CHECK(values[i].find_first_of(" \t\r\n") == std::string::npos,
+                 "Tuned values can't have whitespace: [" << name << "] = [" << values[i] << "]");
+    }
+
+    defineNames.push_back(name);
+    defineValues.push_back(values);
+
+    return *this;
+  }
+
+  autotuner& autotuner::addArgument(const kernelArg &arg){
+    arguments.push_back(arg);
+    return *this;
+  }
+
+  autotuner& autotuner::setWorkingDims(int dims_, dim inner_, dim outer_){
+    hasWorkingDims = true;
+
+    dims  = dims_;
+    inner = inner_;
+    outer = outer_;
+
+    return *this;
+  }
+
+  int autotuner::variantCount() const {
+    int count = 1;
+
+    for(size_t i = 0; i < defineValues.size(); ++i)
+      count *= (int) defineValues[i].size();
+
+    return count;
+  }
+
+  strToStrMap_t autotuner::variantDefines(const int variant) const {
+    strToStrMap_t defines;
+
+    int v = variant;
+
+    for(size_t i = 0; i < defineNames.size(); ++i){
+      const int valueCount = (int) defineValues[i].size();
+
+      defines[defineNames[i]] = defineValues[i][v % valueCount];
+      v /= valueCount;
+    }
+
+    return defines;
+  }
+
+  kernel autotuner::tune(){
+    const int variants = variantCount();
+
+    OCCA_CHECK(0 < defineNames.size(),
+               "Nothing to tune for [" << functionName << "], add defines first");
+
+    std::vector<kernelInfo> infos(variants, info);
+
+    for(int v = 0; v < variants; ++v)
+      tuning::addDefines(infos[v], variantDefines(v));
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    // Host modes can build variants in forked processes, the parent
+    //   then finds them in the cache
+    const std::string &mode_ = device.mode();
+    const bool hostMode = ((mode_ == "Serial") ||
+                           (mode_ == "OpenMP") ||
+                           (mode_ == "Pthreads"));
+
+    const int jobs = std::min(cpu::getCoreCount(), variants);
+
+    if(hostMode && (1 < jobs)){
+      std::cout.flush();
+      std::cerr.flush();
+
+      std::vector<pid_t> pids;
+
+      for(int job = 0; job < jobs; ++job){
+        const pid_t pid = ::fork();
+
+        if(pid == 0){
+          for(int v = job; v < variants; v += jobs){
+            kernel variant = device.buildKernelFromSource(filename, functionName, infos[v]);
+            variant.free();
+          }
+
+          std::cout.flush();
+          ::_exit(0);
+        }
+
+        if(0 < pid)
+          pids.push_back(pid);
+      }
+
+      for(size_t i = 0; i < pids.size(); ++i){
+        int status;
+
+        while((waitpid(pids[i], &status, 0) < 0) && (errno == EINTR))
+          ; // Do Nothing
+      }
+    }
+#endif
+
+    int bestVariant = -1;
+    double bestTime = 0;
+
+    for(int v = 0; v < variants; ++v){
+      kernel variant = device.buildKernelFromSource(filename, functionName, infos[v]);
+
+      const double time = timeVariant(variant);
+
+      variant.free();
+
+      if(verboseCompilation_f){
+        std::cout << "Tuning [" << functionName << "]:";
+
+        const strToStrMap_t defines = variantDefines(v);
+        cStrToStrMapIterator it = defines.begin();
+
+        while(it != defines.end()){
+          std::cout << ' ' << it->first << '=' << it->second;
+          ++it;
+        }
+
+        std::cout << " took " << (1000 * time) << " ms\n";
+      }
+
+      if((bestVariant < 0) || (time < bestTime)){
+        bestVariant = v;
+        bestTime    = time;
+      }
+    }
+
+    tuning::entry_t entry;
+    entry.time    = bestTime;
+    entry.defines = variantDefines(bestVariant);
+
+    tuning::store(device, filename, functionName, info, entry);
+
+    return device.buildKernelFromSource(filename, functionName, infos[bestVariant]);
+  }
+
+  double autotuner::timeVariant(kernel &variant){
+    variant.clearArgumentList();
+
+    for(size_t i = 0; i < arguments.size(); ++i)
+      variant.addArgument((int) i, arguments[i]);
+
+    if(hasWorkingDims)
+      variant.setWorkingDims(dims, inner, outer);
+
+    for(int i = 0; i < warmups; ++i)
+      variant.runFromArguments();
+
+    device.finish();
+
+    const double start = currentTime();
+
+    for(int i = 0; i < iterations; ++i)
+      variant.runFromArguments();
+
+    device.finish();
+
+    return (currentTime() - start) / std::max(iterations, 1);
+  }
+
+  namespace tuning {
+    static mutex_t databaseMutex;
+    static std::map<std::string, database_t> databases;
+
+    entry_t::entry_t() :
+      time(0) {}
+
+    std::string databaseFor(occa::device device){
+      static const char *properties[] = {"deviceID", "platformID",
+                                         "threadCount", "schedule", "chunk", "pinnedCores",
+                                         "processorName", "isa", NULL};
+
+      std::stringstream ss;
+
+      ss << device.mode() << '|'
+         << device.getIdentifier().flattenFlagMap() << '|'
+         << device.getCompilerFlags();
+
+      for(int i = 0; properties[i]; ++i)
+        ss << '|' << properties[i] << '=' << device.getProperty<std::string>(properties[i]);
+
+      return (env::OCCA_CACHE_DIR + "tuning/" + getContentHash(ss.str(), "tuning"));
+    }
+
+    std::string kernelKey(const std::string &filename,
+                          const std::string &functionName,
+                          const kernelInfo &info){
+
+      return getFileContentHash(sys::getFilename(filename),
+                                functionName + info.salt());
+    }
+
+    // Databases are read once per process
+    static const database_t& cachedDatabase(const std::string &databaseFile){
+      std::map<std::string, database_t>::iterator it = databases.find(databaseFile);
+
+      if(it == databases.end())
+        it = databases.insert(std::make_pair(databaseFile,
+                                             readDatabase(databaseFile))).first;
+
+      return it->second;
+    }
+
+    bool find(occa::device device,
+              const std::string &filename,
+              const std::string &functionName,
+              const kernelInfo &info,
+              entry_t &entry){
+
+      const std::string databaseFile = databaseFor(device);
+
+      databaseMutex.lock();
+
+      const database_t &database = cachedDatabase(databaseFile);
+      bool found = false;
+
+      // Skip hashing the source if nothing was tuned on this device
+      if(database.size()){
+        database_t::const_iterator it = database.find(kernelKey(filename, functionName, info));
+
+        if(it != database.end()){
+          entry = it->second;
+          found = true;
+        }
+      }
+
+      databaseMutex.unlock();
+
+      return found;
+    }
+
+    void store(occa::device device,
+               const std::string &filename,
+               const std::string &functionName,
+               const kernelInfo &info,
+               const entry_t &entry){
+
+      const std::string databaseFile = databaseFor(device);
+      const std::string databaseHash = ("tuning_" + getOnlyFilename(databaseFile));
+      const std::string key          = kernelKey(filename, functionName, info);
+
+      while(!haveHash(databaseHash, 0))
+        waitForHash(databaseHash, 0);
+
+      // Keep entries other processes stored since we read the database
+      database_t database = readDatabase(databaseFile);
+      database[key] = entry;
+
+      writeDatabase(databaseFile, database);
+
+      releaseHash(databaseHash, 0);
+
+      databaseMutex.lock();
+      databases[databaseFile] = database;
+      databaseMutex.unlock();
+    }
+
+    void addDefines(kernelInfo &info,
+                    const strToStrMap_t &defines){
+
+      cStrToStrMapIterator it = defines.begin();
+
+      while(it != defines.end()){
+        info.addDefine(it->first, it->second);
+        ++it;
+      }
+    }
+
+    void applyTo(occa::device device,
+                 const std::string &filename,
+                 const std::string &functionName,
+                 kernelInfo &info){
+
+      entry_t entry;
+
+      if(!find(device, filename, functionName, info, entry))
+        return;
+
+      strToStrMap_t defines;
+      cStrToStrMapIterator it = entry.defines.begin();
+
+      // Defines passed by the caller take precedence
+      while(it != entry.defines.end()){
+        if(info.header.find("#define " + it->first + " ") == std::string::npos)
+          defines[it->first] = it->second;
+
+        ++it;
+      }
+
+      addDefines(info, defines);
+    }
+
+    //  Each line holds one tuned kernel:
+    //
+    //    <kernel key> <seconds> <define>=<value> ...
+    database_t readDatabase(const std::string &databaseFile){
+      database_t database;
+
+      if(!sys::fileExists(databaseFile))
+        return database;
+
+      std::stringstream ss(readFile(databaseFile));
+      std::string line;
+
+      while(std::getline(ss, line)){
+        std::stringstream lineSS(line);
+
+        std::string key, define;
+        entry_t entry;
+
+        if(!(lineSS >> key >> entry.time))
+          continue;
+
+        while(lineSS >> define){
+          const size_t equals = define.find('=');
+
+          if(equals != std::string::npos)
+            entry.defines[define.substr(0, equals)] = define.substr(equals + 1);
+        }
+
+        database[key] = entry;
+      }
+
+      return database;
+    }
+
+    void writeDatabase(const std::string &databaseFile,
+                       const database_t &database){
+      std::stringstream ss;
+
+      ss.precision(6);
+
+      database_t::const_iterator it = database.begin();
+
+      while(it != database.end()){
+        const entry_t &entry = it->second;
+
+        ss << it->first << ' ' << std::scientific << entry.time;
+
+        cStrToStrMapIterator dIt = entry.defines.begin();
+
+        while(dIt != entry.defines.end()){
+          ss << ' ' << dIt->first << '=' << dIt->second;
+          ++dIt;
+        }
+
+        ss << '\n';
+        ++it;
+      }
+
+      // Processes reading the database never see a partial file
+      const std::string tmpFile = databaseFile + ".tmp";
+
+      writeToFile(tmpFile, ss.str());
+      std::rename(tmpFile.c_str(), databaseFile.c_str());
+    }
+  }
+  //==============================================
+}
@@ -1,5 +1,10 @@
 #include "occa/base.hpp"
 #include "occa/library.hpp"
+#include "occa/capture.hpp"
+#include "occa/aot.hpp"
+#include "occa/autotune.hpp"
+#include "occa/miniLib.hpp"
+#include "occa/reduction.hpp"
 #include "occa/parser/parser.hpp"
 
 #include "occa/Serial.hpp"
@@ -94,11 +99,31 @@ namespace occa {
 
   bool uvaEnabledByDefault_f = false;
   bool verboseCompilation_f  = true;
+  bool usePrecompiledHeaders_f = true;
+
+  bool inMemoryCompilation_f        = false;
+  bool persistInMemoryCompilation_f = false;
+
+  bool useCompileServer_f = false;
 
   void setVerboseCompilation(const bool value) {
     verboseCompilation_f = value;
   }
 
+  void setUsePrecompiledHeaders(const bool value) {
+    usePrecompiledHeaders_f = value;
+  }
+
+  void setInMemoryCompilation(const bool value,
+                              const bool persist) {
+    inMemoryCompilation_f        = value;
+    persistInMemoryCompilation_f = (value && persist);
+  }
+
+  void setUseCompileServer(const bool value) {
+    useCompileServer_f = value;
+  }
+
   namespace flags {
     const int checkCacheDir = (1 << 0);
   }
@@ -505,7 +530,9 @@ namespace occa {
          (info != "chunk")       &&
          (info != "threadCount") &&
          (info != "schedule")    &&
-         (info != "pinnedCores")) {
+         (info != "pinnedCores") &&
+         (info != "isa")         &&
+         (info != "textureLayout")) {
 
         std::cout << "Flag [" << info << "] is not available, skipping it\n";
         continue;
@@ -551,12 +578,14 @@ namespace occa {
   kernelInfo::kernelInfo(const kernelInfo &p) :
     mode(p.mode),
     header(p.header),
-    flags(p.flags) {}
+    flags(p.flags),
+    parserFlags(p.parserFlags) {}
 
   kernelInfo& kernelInfo::operator = (const kernelInfo &p) {
-    mode   = p.mode;
-    header = p.header;
-    flags  = p.flags;
+    mode        = p.mode;
+    header      = p.header;
+    flags       = p.flags;
+    parserFlags = p.parserFlags;
 
     return *this;
   }
@@ -565,11 +594,28 @@ namespace occa {
     header += p.header;
     flags  += p.flags;
 
+    cStrToStrMapIterator it = p.parserFlags.flags.begin();
+
+    while(it != p.parserFlags.flags.end()) {
+      parserFlags[it->first] = it->second;
+      ++it;
+    }
+
     return *this;
   }
 
   std::string kernelInfo::salt() const {
-    return (header + flags);
+    std::string ret = (header + flags);
+
+    // Parser flags change the parsed source
+    cStrToStrMapIterator it = parserFlags.flags.begin();
+
+    while(it != parserFlags.flags.end()) {
+      ret += '\n' + it->first + '=' + it->second;
+      ++it;
+    }
+
+    return ret;
   }
 
   std::string kernelInfo::getModeHeaderFilename() const {
@@ -593,6 +639,8 @@ namespace occa {
        (name == "OCCA_USING_CUDA")     ||
        (name == "OCCA_USING_PTHREADS") ||
 
+       (name == "OCCA_OPENMP_SCHEDULE") ||
+
        (name == "occaInnerDim0") ||
        (name == "occaInnerDim1") ||
        (name == "occaInnerDim2") ||
@@ -872,6 +920,15 @@ namespace occa {
       kHandle->arguments[i].setupForKernelCall(argIsConst);
     }
 
+    if (capture::isEnabledFor(kHandle->name)) {
+      const std::string captureFilename = capture::filenameFor(kHandle->name);
+
+      kernelCapture(*this).write(captureFilename);
+
+      std::cout << "Captured a launch of [" << kHandle->name << "] in ["
+                << captureFilename << "]\n";
+    }
+
     // Add nestedKernels
     if (kHandle->nestedKernelCount()) {
       kHandle->arguments.insert(kHandle->arguments.begin(),
@@ -886,6 +943,118 @@ namespace occa {
       kHandle->arguments.erase(kHandle->arguments.begin());
   }
 
+  //---[ Cost Estimates ]-------------
+  const kernelCostInfo& kernel::costInfo() {
+    checkIfInitialized();
+    return kHandle->metaInfo.cost;
+  }
+
+  static void getCostArgValues(const parsedKernelInfo &metaInfo,
+                               const std::vector<kernelArg> &arguments,
+                               strToStrMap_t &argValues) {
+
+    const int argCount  = (int) arguments.size();
+    const int infoCount = (int) metaInfo.argumentInfos.size();
+
+    int infoPos = 0;
+
+    for (int i = 0; i < argCount; ++i) {
+      // Skip arguments added by the parser
+      while ((infoPos < infoCount) &&
+             ((metaInfo.argumentInfos[infoPos].name == "occaKernelInfoArg") ||
+              (metaInfo.argumentInfos[infoPos].name == "nestedKernels"))) {
+        ++infoPos;
+      }
+
+      if (infoCount <= infoPos)
+        break;
+
+      const std::string &name = metaInfo.argumentInfos[infoPos++].name;
+      const kernelArg_t &arg  = arguments[i].args[0];
+
+      if ((name.size() == 0)                ||
+         (arg.mHandle != NULL)             ||
+         (arg.info & kArgInfo::usePointer)) {
+
+        continue;
+      }
+
+      std::stringstream ss;
+
+      switch(arg.size) {
+      case 1: ss << (int) arg.data.char_; break;
+      case 2: ss << arg.data.short_;      break;
+      case 4: ss << arg.data.int_;        break;
+      case 8: ss << arg.data.long_;       break;
+      default: continue;
+      }
+
+      argValues[name] = ss.str();
+    }
+  }
+
+  double kernel::estimatedFlops() {
+    checkIfInitialized();
+
+    strToStrMap_t argValues;
+    getCostArgValues(kHandle->metaInfo, kHandle->arguments, argValues);
+
+    const double flops = kernelCostInfo::evaluate(kHandle->metaInfo.cost.flops,
+                                                  argValues);
+
+    return ((0 < flops) ? flops : 0);
+  }
+
+  double kernel::estimatedBytes() {
+    checkIfInitialized();
+
+    const kernelCostInfo &cost = kHandle->metaInfo.cost;
+
+    strToStrMap_t argValues;
+    getCostArgValues(kHandle->metaInfo, kHandle->arguments, argValues);
+
+    const double bytes = (kernelCostInfo::evaluate(cost.bytesLoaded, argValues) +
+                          kernelCostInfo::evaluate(cost.bytesStored, argValues));
+
+    return ((0 < bytes) ? bytes : 0);
+  }
+  //==================================
+
+  //---[ Specialization ]-------------
+  kernel kernel::specialize(const strToStrMap_t &argValues) {
+    checkIfInitialized();
+
+    const parsedKernelInfo &metaInfo = kHandle->metaInfo;
+
+    OCCA_CHECK(kHandle->buildFilename.size() && metaInfo.argumentInfos.size(),
+               "Only kernels built from OKL or OFL sources can be specialized");
+
+    kernelInfo info;
+    info.header      = kHandle->buildHeader;
+    info.flags       = kHandle->buildFlags;
+    info.parserFlags = kHandle->buildParserFlags;
+
+    info.addParserFlag("specialize-kernel", metaInfo.name);
+
+    cStrToStrMapIterator it = argValues.begin();
+
+    while(it != argValues.end()) {
+      info.addParserFlag("specialize:" + it->first, it->second);
+      ++it;
+    }
+
+    // Launchers from the parser run on a host device, use
+    //   the device the nested kernels were built for
+    occa::device device = (kHandle->nestedKernels.size()          ?
+                           kHandle->nestedKernels[0].getDevice() :
+                           getDevice());
+
+    return device.buildKernelFromSource(kHandle->buildFilename,
+                                        metaInfo.name,
+                                        info);
+  }
+  //==================================
+
 #include "operators/definitions.cpp"
 
   void kernel::free() {
@@ -1836,6 +2005,16 @@ namespace occa {
     return dHandle->getIdentifier();
   }
 
+  template <>
+  std::string device::getProperty<std::string>(const std::string &prop) {
+    checkIfInitialized();
+
+    if (dHandle->properties.has(prop))
+      return dHandle->properties.get(prop);
+
+    return "";
+  }
+
   void device::setCompiler(const std::string &compiler_) {
     checkIfInitialized();
     dHandle->setCompiler(compiler_);
@@ -2034,9 +2213,13 @@ namespace occa {
 
   kernel device::buildKernelFromSource(const std::string &filename,
                                        const std::string &functionName,
-                                       const kernelInfo &info_) {
+                                       const kernelInfo &userInfo) {
     checkIfInitialized();
 
+    // Kernels tuned with [autotuner] reuse the fastest defines
+    kernelInfo info_(userInfo);
+    tuning::applyTo(*this, filename, functionName, info_);
+
     const std::string sourceFilename = sys::getFilename(filename);
     const bool usingParser = fileNeedsParser(filename);
 
@@ -2044,7 +2227,65 @@ namespace occa {
 
     kernel_v *&k = ker.kHandle;
 
-    if(usingParser) {
+    // Kernels bundled with [occa aot] skip parsing and compiling
+    const bool usingAOT = (aot::recording_f || aot::hasBundles());
+
+    std::string hash;
+
+    if(usingParser || usingAOT)
+      hash = getFileContentHash(sourceFilename,
+                                dHandle->getInfoSalt(info_));
+
+    const aot::kernelEntry_t *aotEntry = NULL;
+    const size_t firstAOTUnit = aot::units.size();
+
+    if(usingAOT && !aot::recording_f)
+      aotEntry = aot::find(hash, functionName);
+
+    if(aotEntry) {
+      const aot::kernelEntry_t &entry = *aotEntry;
+
+      if(entry.usesParser) {
+#if OCCA_OPENMP_ENABLED
+        if(dHandle->mode() != OpenMP) {
+          k          = new kernel_t<Serial>;
+          k->dHandle = new device_t<Serial>;
+        }
+        else {
+          k          = new kernel_t<OpenMP>;
+          k->dHandle = dHandle;
+        }
+#else
+        k          = new kernel_t<Serial>;
+        k->dHandle = new device_t<Serial>;
+#endif
+
+        k->buildFromBinary(entry.bundle, entry.symbols[0]);
+        k->name     = functionName;
+        k->metaInfo = entry.metaInfo;
+        k->nestedKernels.clear();
+
+        for(int ki = 0; ki < entry.metaInfo.nestedKernels; ++ki) {
+          kernel sKer;
+          sKer.kHandle = dHandle->buildKernelFromBinary(entry.bundle,
+                                                        entry.symbols[ki + 1]);
+
+          sKer.kHandle->name                   = entry.metaInfo.baseName + toString(ki);
+          sKer.kHandle->metaInfo               = entry.metaInfo;
+          sKer.kHandle->metaInfo.name          = sKer.kHandle->name;
+          sKer.kHandle->metaInfo.nestedKernels = 0;
+          sKer.kHandle->metaInfo.removeArg(0); // remove nestedKernels **
+          k->nestedKernels.push_back(sKer);
+        }
+      }
+      else {
+        k = dHandle->buildKernelFromBinary(entry.bundle,
+                                           entry.symbols[0]);
+        k->name    = functionName;
+        k->dHandle = dHandle;
+      }
+    }
+    else if(usingParser) {
 #if OCCA_OPENMP_ENABLED
       if(dHandle->mode() != OpenMP) {
         k          = new kernel_t<Serial>;
@@ -2059,18 +2300,19 @@ namespace occa {
       k->dHandle = new device_t<Serial>;
 #endif
 
-      const std::string hash = getFileContentHash(sourceFilename,
-                                                  dHandle->getInfoSalt(info_));
-
       const std::string hashDir    = hashDirFor(sourceFilename, hash);
       const std::string parsedFile = hashDir + "parsedSource.occa";
 
+      const double parseStart = currentTime();
+
       k->metaInfo = parseFileForFunction(mode(),
                                          sourceFilename,
                                          parsedFile,
                                          functionName,
                                          info_);
 
+      recordParse(hashDir, functionName, currentTime() - parseStart);
+
       kernelInfo info = defaultKernelInfo;
       info.addDefine("OCCA_LAUNCH_KERNEL", 1);
 
@@ -2115,6 +2357,14 @@ namespace occa {
       k->dHandle = dHandle;
     }
 
+    if(aot::recording_f)
+      aot::recordKernel(hash, functionName, usingParser, k->metaInfo, firstAOTUnit);
+
+    k->buildFilename    = sourceFilename;
+    k->buildHeader      = info_.header;
+    k->buildFlags       = info_.flags;
+    k->buildParserFlags = info_.parserFlags;
+
     return ker;
   }
 
@@ -2279,6 +2529,9 @@ namespace occa {
   void device::free() {
     checkIfInitialized();
 
+    miniLib::free(*this);
+    reduction::free(*this);
+
     const int streamCount = dHandle->streams.size();
 
     for(int i = 0; i < streamCount; ++i)
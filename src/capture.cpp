@@ -0,0 +1,330 @@
+#include "occa/capture.hpp"
+
+namespace occa {
+  //---[ Kernel Capture ]-------------------------
+  namespace capture {
+    bool isEnabledFor(const std::string &kernelName){
+      static const std::string captureName = env::var("OCCA_CAPTURE");
+      static strToBoolMap_t captured;
+
+      if((captureName.size() == 0) ||
+         (captureName != kernelName)){
+
+        return false;
+      }
+
+      // Only the first launch is captured
+      bool &wasCaptured = captured[kernelName];
+
+      if(wasCaptured)
+        return false;
+
+      wasCaptured = true;
+
+      return true;
+    }
+
+    std::string filenameFor(const std::string &kernelName){
+      return (env::OCCA_CACHE_DIR + "captures/" + kernelName + ".capture");
+    }
+  }
+
+  capturedArg::capturedArg() :
+    type(capturedArgType::value),
+    bytes() {}
+
+  capturedArg::capturedArg(const capturedArg &arg) :
+    type(arg.type),
+    bytes(arg.bytes) {}
+
+  capturedArg& capturedArg::operator = (const capturedArg &arg){
+    type  = arg.type;
+    bytes = arg.bytes;
+
+    return *this;
+  }
+
+  //  ---[ Binary Format ]--------------
+  static const char captureMagic[]   = "OCCACAP";
+  static const int  captureVersion   = 1;
+
+  static void writeCaptureBytes(std::ofstream &fs,
+                                const void *ptr,
+                                const uint64_t bytes){
+    fs.write((const char*) &bytes, sizeof(uint64_t));
+    fs.write((const char*) ptr, bytes);
+  }
+
+  static void writeCaptureString(std::ofstream &fs,
+                                 const std::string &str){
+    writeCaptureBytes(fs, str.c_str(), str.size());
+  }
+
+  static void writeCaptureInt(std::ofstream &fs,
+                              const uint64_t value){
+    fs.write((const char*) &value, sizeof(uint64_t));
+  }
+
+  static uint64_t readCaptureInt(std::ifstream &fs){
+    uint64_t value = 0;
+    fs.read((char*) &value, sizeof(uint64_t));
+
+    return value;
+  }
+
+  static std::string readCaptureString(std::ifstream &fs){
+    const uint64_t bytes = readCaptureInt(fs);
+
+    OCCA_CHECK(fs.good(),
+               "Capture file is corrupted");
+
+    std::string str(bytes, '\0');
+
+    if(bytes)
+      fs.read(&(str[0]), bytes);
+
+    return str;
+  }
+  //  ==================================
+
+  kernelCapture::kernelCapture() :
+    dims(1),
+    inner(1, 1, 1),
+    outer(1, 1, 1) {}
+
+  kernelCapture::kernelCapture(occa::kernel &k) :
+    dims(1),
+    inner(1, 1, 1),
+    outer(1, 1, 1) {
+
+    load(k);
+  }
+
+  void kernelCapture::load(occa::kernel &k){
+    kernel_v &kHandle = *(k.getKHandle());
+
+    // Launchers from the parser run on a host device, use
+    //   the device the nested kernels were built for
+    if(kHandle.nestedKernels.size())
+      mode = kHandle.nestedKernels[0].getDevice().mode();
+    else
+      mode = k.getDevice().mode();
+
+    functionName = kHandle.name;
+    filename     = kHandle.buildFilename;
+    header       = kHandle.buildHeader;
+    flags        = kHandle.buildFlags;
+
+    if(filename.size() && sys::fileExists(filename))
+      source = readFile(filename);
+
+    dims  = kHandle.dims;
+    inner = kHandle.inner;
+    outer = kHandle.outer;
+
+    arguments.clear();
+
+    for(size_t i = 0; i < kHandle.arguments.size(); ++i){
+      const kernelArg &kArg = kHandle.arguments[i];
+
+      for(int a = 0; a < kArg.argc; ++a){
+        const kernelArg_t &arg = kArg.args[a];
+        capturedArg cArg;
+
+        if(arg.mHandle != NULL){
+          occa::memory mem(arg.mHandle);
+
+          if(mem.isATexture() || (a != 0)){
+            cArg.type = capturedArgType::unknown;
+          }
+          else {
+            cArg.type  = capturedArgType::memory;
+            cArg.bytes = std::string(mem.bytes(), '\0');
+
+            if(mem.bytes())
+              mem.copyTo(&(cArg.bytes[0]));
+          }
+        }
+        else if(arg.info & kArgInfo::usePointer){
+          // Pointers to arguments passed by value
+          if((arg.data.void_ != NULL) &&
+             (arg.size != sizeof(void*))){
+
+            cArg.type  = capturedArgType::pointer;
+            cArg.bytes = std::string((const char*) arg.data.void_, arg.size);
+          }
+          else
+            cArg.type = capturedArgType::unknown;
+        }
+        else {
+          cArg.type  = capturedArgType::value;
+          cArg.bytes = std::string((const char*) &(arg.data), arg.size);
+        }
+
+        arguments.push_back(cArg);
+      }
+    }
+  }
+
+  void kernelCapture::write(const std::string &captureFilename) const {
+    sys::mkpath(getFileDirectory(captureFilename));
+
+    std::ofstream fs(captureFilename.c_str(), std::ios::binary);
+
+    OCCA_CHECK(fs.is_open(),
+               "Could not write capture file [" << captureFilename << "]");
+
+    fs.write(captureMagic, sizeof(captureMagic));
+    writeCaptureInt(fs, captureVersion);
+
+    writeCaptureString(fs, mode);
+    writeCaptureString(fs, filename);
+    writeCaptureString(fs, source);
+    writeCaptureString(fs, functionName);
+    writeCaptureString(fs, header);
+    writeCaptureString(fs, flags);
+
+    writeCaptureInt(fs, dims);
+
+    for(int i = 0; i < 3; ++i){
+      writeCaptureInt(fs, inner[i]);
+      writeCaptureInt(fs, outer[i]);
+    }
+
+    writeCaptureInt(fs, arguments.size());
+
+    for(size_t i = 0; i < arguments.size(); ++i){
+      writeCaptureInt(fs, arguments[i].type);
+      writeCaptureString(fs, arguments[i].bytes);
+    }
+
+    fs.close();
+  }
+
+  void kernelCapture::read(const std::string &captureFilename){
+    std::ifstream fs(captureFilename.c_str(), std::ios::binary);
+
+    OCCA_CHECK(fs.is_open(),
+               "Could not open capture file [" << captureFilename << "]");
+
+    char magic[sizeof(captureMagic)];
+    fs.read(magic, sizeof(captureMagic));
+
+    OCCA_CHECK(fs.good() && (strcmp(magic, captureMagic) == 0),
+               "File [" << captureFilename << "] is not an OCCA capture");
+
+    const int version = (int) readCaptureInt(fs);
+
+    OCCA_CHECK(version == captureVersion,
+               "Capture file [" << captureFilename << "] has version ["
+               << version << "], expected [" << captureVersion << "]");
+
+    mode         = readCaptureString(fs);
+    filename     = readCaptureString(fs);
+    source       = readCaptureString(fs);
+    functionName = readCaptureString(fs);
+    header       = readCaptureString(fs);
+    flags        = readCaptureString(fs);
+
+    dims = (int) readCaptureInt(fs);
+
+    for(int i = 0; i < 3; ++i){
+      inner[i] = readCaptureInt(fs);
+      outer[i] = readCaptureInt(fs);
+    }
+
+    const uint64_t argCount = readCaptureInt(fs);
+
+    arguments.resize(argCount);
+
+    for(uint64_t i = 0; i < argCount; ++i){
+      arguments[i].type  = (char) readCaptureInt(fs);
+      arguments[i].bytes = readCaptureString(fs);
+    }
+
+    fs.close();
+  }
+
+  occa::kernel kernelCapture::buildKernel(occa::device &device,
+                                          const std::string &captureFilename){
+
+    OCCA_CHECK(0 < source.size(),
+               "Capture of [" << functionName << "] has no kernel source"
+               << " (kernel was not built from a source file)");
+
+    // Keep the extension to use the same parser/compiler path
+    const std::string sourceFilename = (captureFilename + "." +
+                                        getFileExtension(filename));
+
+    writeToFile(sourceFilename, source);
+
+    kernelInfo info;
+    info.header = header;
+    info.flags  = flags;
+
+    return device.buildKernelFromSource(sourceFilename,
+                                        functionName,
+                                        info);
+  }
+
+  void kernelCapture::setArguments(occa::device &device,
+                                   occa::kernel &k){
+    freeMemories();
+
+    memories.resize(arguments.size());
+
+    k.clearArgumentList();
+    k.setWorkingDims(dims, inner, outer);
+
+    for(size_t i = 0; i < arguments.size(); ++i){
+      capturedArg &cArg = arguments[i];
+
+      if(cArg.type == capturedArgType::memory){
+        memories[i] = device.malloc(cArg.bytes.size(),
+                                    cArg.bytes.size() ? &(cArg.bytes[0]) : NULL);
+
+        k.addArgument(i, memories[i]);
+        continue;
+      }
+
+      kernelArg_t arg;
+
+      if(cArg.type == capturedArgType::value){
+        ::memcpy(&(arg.data), cArg.bytes.c_str(), cArg.bytes.size());
+        arg.size = cArg.bytes.size();
+      }
+      else {
+        if(cArg.type == capturedArgType::unknown){
+          std::cout << "Argument [" << i << "] of [" << functionName
+                    << "] was not captured, passing NULL\n";
+        }
+
+        arg.data.void_ = (cArg.bytes.size() ? &(cArg.bytes[0]) : NULL);
+        arg.size       = (cArg.bytes.size() ? cArg.bytes.size() : sizeof(void*));
+        arg.info       = kArgInfo::usePointer;
+      }
+
+      k.addArgument(i, kernelArg(arg));
+    }
+  }
+
+  void kernelCapture::resetMemories(){
+    for(size_t i = 0; i < memories.size(); ++i){
+      if((arguments[i].type == capturedArgType::memory) &&
+         memories[i].bytes()){
+
+        memories[i].copyFrom(arguments[i].bytes.c_str());
+      }
+    }
+  }
+
+  void kernelCapture::freeMemories(){
+    for(size_t i = 0; i < memories.size(); ++i){
+      if(arguments[i].type == capturedArgType::memory)
+        memories[i].free();
+    }
+
+    memories.clear();
+  }
+  //==============================================
+}
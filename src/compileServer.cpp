@@ -0,0 +1,570 @@
+#include <algorithm>
+
+#include "occa/compileServer.hpp"
+#include "occa/Serial.hpp"
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+#  include <spawn.h>
+#  include <poll.h>
+#  include <pthread.h>
+#  include <sys/file.h>
+#  include <sys/socket.h>
+#  include <sys/un.h>
+
+extern char **environ;
+#endif
+
+namespace occa {
+  //---[ Compile Server ]-------------------------
+  namespace compileServer {
+    std::string serverDir(){
+      return (env::OCCA_CACHE_DIR + "compileServer/");
+    }
+
+    std::string socketPath(){
+      const std::string path = (serverDir() + "socket");
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      // Socket paths are limited to [sizeof(sun_path)] characters
+      if(path.size() < sizeof(((sockaddr_un*) NULL)->sun_path))
+        return path;
+
+      return ("/tmp/occaCompileServer_" + getContentHash(env::OCCA_CACHE_DIR, ""));
+#else
+      return path;
+#endif
+    }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    static bool writeAll(const int fd, const std::string &str){
+      const char *c    = str.c_str();
+      size_t bytesLeft = str.size();
+
+      while(bytesLeft){
+        const ssize_t bytesWritten = ::write(fd, c, bytesLeft);
+
+        if(bytesWritten <= 0){
+          if((bytesWritten < 0) && (errno == EINTR))
+            continue;
+
+          return false;
+        }
+
+        c         += bytesWritten;
+        bytesLeft -= bytesWritten;
+      }
+
+      return true;
+    }
+
+    static std::string readAll(const int fd){
+      std::string str;
+      char buffer[4096];
+
+      while(true){
+        const ssize_t bytesRead = ::read(fd, buffer, sizeof(buffer));
+
+        if(bytesRead < 0){
+          if(errno == EINTR)
+            continue;
+          break;
+        }
+
+        if(bytesRead == 0)
+          break;
+
+        str.append(buffer, bytesRead);
+      }
+
+      return str;
+    }
+
+    static int connectToServer(){
+      const std::string path = socketPath();
+
+      const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+      if(fd < 0)
+        return -1;
+
+      sockaddr_un address;
+      ::memset(&address, 0, sizeof(address));
+
+      address.sun_family = AF_UNIX;
+      ::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+      if(::connect(fd, (sockaddr*) &address, sizeof(address))){
+        ::close(fd);
+        return -1;
+      }
+
+      return fd;
+    }
+#endif
+
+    bool compile(const std::string &hash,
+                 const std::string &functionName,
+                 const std::string &source,
+                 const std::string &sourceFilename,
+                 const std::string &binaryFilename,
+                 const std::string &compilerEnvScript,
+                 const std::string &compiler,
+                 const std::string &flags){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      // Don't wait on a server that failed to start for every kernel
+      static bool serverFailed = false;
+
+      if(serverFailed)
+        return false;
+
+      int fd = connectToServer();
+
+      if(fd < 0){
+        if(start()){
+          // Give the server 5 seconds to start listening
+          for(int i = 0; (i < 500) && (fd < 0); ++i){
+            ::usleep(10000);
+            fd = connectToServer();
+          }
+        }
+
+        if(fd < 0){
+          serverFailed = true;
+
+          if(verboseCompilation_f)
+            std::cout << "Compile server could not be started, compiling locally\n";
+
+          return false;
+        }
+      }
+
+      request_t request;
+
+      request.hash              = hash;
+      request.functionName      = functionName;
+      request.sourceFilename    = sourceFilename;
+      request.binaryFilename    = binaryFilename;
+      request.compilerEnvScript = compilerEnvScript;
+      request.compiler          = compiler;
+      request.flags             = flags;
+      request.source            = source;
+
+      // Don't die from SIGPIPE if the server goes away
+      void (*sigpipeHandler)(int) = ::signal(SIGPIPE, SIG_IGN);
+
+      const bool sent = writeAll(fd, request.toString());
+      ::shutdown(fd, SHUT_WR);
+
+      const std::string reply = (sent ? readAll(fd) : "");
+
+      ::close(fd);
+      ::signal(SIGPIPE, sigpipeHandler);
+
+      // An empty reply means the server went away mid-request
+      if(reply.size() == 0)
+        return false;
+
+      if(reply.compare(0, 3, "ok\n") == 0)
+        return true;
+
+      const size_t outputStart = reply.find('\n');
+
+      if(outputStart != std::string::npos)
+        std::cerr << reply.substr(outputStart + 1);
+
+      OCCA_CHECK(false, "Compilation error");
+      return false;
+#else
+      return false;
+#endif
+    }
+
+    //---[ Server ]-----------------------
+    request_t::request_t() :
+      hash(),
+      functionName(),
+      sourceFilename(),
+      binaryFilename(),
+      compilerEnvScript(),
+      compiler(),
+      flags(),
+      source() {}
+
+    // One field per line followed by the source
+    std::string request_t::toString() const {
+      std::string str;
+
+      const std::string *fields[7] = {
+        &hash, &functionName,
+        &sourceFilename, &binaryFilename,
+        &compilerEnvScript, &compiler, &flags
+      };
+
+      for(int i = 0; i < 7; ++i){
+        std::string field = *(fields[i]);
+
+        std::replace(field.begin(), field.end(), '\n', ' ');
+
+        str += field;
+        str += '\n';
+      }
+
+      return (str + source);
+    }
+
+    bool request_t::fromString(const std::string &str){
+      std::string *fields[7] = {
+        &hash, &functionName,
+        &sourceFilename, &binaryFilename,
+        &compilerEnvScript, &compiler, &flags
+      };
+
+      size_t start = 0;
+
+      for(int i = 0; i < 7; ++i){
+        const size_t end = str.find('\n', start);
+
+        if(end == std::string::npos)
+          return false;
+
+        *(fields[i]) = str.substr(start, end - start);
+        start = (end + 1);
+      }
+
+      source = str.substr(start);
+
+      return ((hash.size() != 0) &&
+              (binaryFilename.size() != 0));
+    }
+
+    std::string request_t::command() const {
+      std::stringstream command;
+
+      if(compilerEnvScript.size())
+        command << compilerEnvScript << " && ";
+
+      command << compiler
+              << ' '    << flags
+              << ' '    << sourceFilename
+              << " -o " << binaryFilename
+              << " -I"  << env::OCCA_DIR << "/include"
+              << " -L"  << env::OCCA_DIR << "/lib -locca";
+
+      return command.str();
+    }
+
+    bool start(){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      const std::string occaBinary = (env::OCCA_DIR + "bin/occa");
+
+      if(!sys::fileExists(occaBinary))
+        return false;
+
+      const std::string dir = serverDir();
+      sys::mkpath(dir);
+
+      // Several processes can get here at once, extra servers
+      //   exit when they can't lock [serverDir()/lock]
+      std::string args[3] = {occaBinary, "compile-server", env::OCCA_CACHE_DIR};
+      char *argv[4] = {
+        const_cast<char*>(args[0].c_str()),
+        const_cast<char*>(args[1].c_str()),
+        const_cast<char*>(args[2].c_str()),
+        NULL
+      };
+
+      const std::string logFile = (dir + "log");
+
+      posix_spawn_file_actions_t actions;
+      posix_spawn_file_actions_init(&actions);
+      posix_spawn_file_actions_addopen(&actions, 0, "/dev/null", O_RDONLY, 0);
+      posix_spawn_file_actions_addopen(&actions, 1, logFile.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+      posix_spawn_file_actions_adddup2(&actions, 1, 2);
+
+      pid_t pid;
+      const int spawnError = posix_spawn(&pid, argv[0], &actions, NULL, argv, environ);
+
+      posix_spawn_file_actions_destroy(&actions);
+
+      if(spawnError)
+        return false;
+
+      // The server forks into the background, reap the launcher
+      int status;
+
+      while((waitpid(pid, &status, 0) < 0) && (errno == EINTR))
+        ; // Do Nothing
+
+      return (WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+#else
+      return false;
+#endif
+    }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    // Builds of the same hash share one job
+    class job_t {
+    public:
+      bool done, success;
+      std::string output;
+      int users;
+
+      job_t() :
+        done(false),
+        success(false),
+        output(),
+        users(0) {}
+    };
+
+    static pthread_mutex_t jobMutex = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_cond_t jobCondition = PTHREAD_COND_INITIALIZER;
+
+    static std::map<std::string, job_t*> jobs;
+    static int runningJobs = 0, maxJobs = 1;
+    static int activeConnections = 0;
+
+    // haveHash() and releaseHash() update the global [fileLocks]
+    static mutex_t hashMutex;
+
+    static void* serveConnection(void *args){
+      const int fd = (int) (intptr_t) args;
+
+      request_t request;
+      std::string reply;
+
+      if(request.fromString(readAll(fd))){
+        pthread_mutex_lock(&jobMutex);
+
+        std::map<std::string, job_t*>::iterator it = jobs.find(request.hash);
+
+        const bool ownsJob = (it == jobs.end());
+        job_t *job = (ownsJob ? new job_t : it->second);
+
+        ++(job->users);
+
+        if(ownsJob){
+          jobs[request.hash] = job;
+
+          while(maxJobs <= runningJobs)
+            pthread_cond_wait(&jobCondition, &jobMutex);
+
+          ++runningJobs;
+          pthread_mutex_unlock(&jobMutex);
+
+          job->success = build(request, job->output);
+
+          pthread_mutex_lock(&jobMutex);
+          --runningJobs;
+
+          job->done = true;
+          jobs.erase(request.hash);
+
+          pthread_cond_broadcast(&jobCondition);
+        }
+        else {
+          while(!job->done)
+            pthread_cond_wait(&jobCondition, &jobMutex);
+        }
+
+        reply = ((job->success ? "ok\n" : "error\n") + job->output);
+
+        if(--(job->users) == 0)
+          delete job;
+
+        pthread_mutex_unlock(&jobMutex);
+      }
+      else {
+        reply = "error\nMalformed compile server request\n";
+      }
+
+      writeAll(fd, reply);
+      ::close(fd);
+
+      pthread_mutex_lock(&jobMutex);
+      --activeConnections;
+      pthread_mutex_unlock(&jobMutex);
+
+      return NULL;
+    }
+#endif
+
+    void serve(const int idleSeconds){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      const std::string dir = serverDir();
+      sys::mkpath(dir);
+
+      // Leave the launcher's session so job launchers don't take us down
+      const pid_t pid = ::fork();
+
+      if(pid < 0)
+        ::exit(1);
+      if(0 < pid)
+        ::exit(0);
+
+      ::setsid();
+
+      // Only one server per cache directory, the lock is dropped
+      //   if the server dies
+      const std::string lockFile = (dir + "lock");
+      const int lockFD = ::open(lockFile.c_str(), O_RDWR | O_CREAT, 0644);
+
+      if((lockFD < 0) || ::flock(lockFD, LOCK_EX | LOCK_NB))
+        return;
+
+      const std::string path = socketPath();
+      ::unlink(path.c_str());
+
+      const int serverFD = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+      sockaddr_un address;
+      ::memset(&address, 0, sizeof(address));
+
+      address.sun_family = AF_UNIX;
+      ::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+      if((serverFD < 0) ||
+         ::bind(serverFD, (sockaddr*) &address, sizeof(address)) ||
+         ::listen(serverFD, SOMAXCONN)){
+
+        std::cerr << "Compile server could not listen on [" << path << "]\n";
+        return;
+      }
+
+      ::signal(SIGPIPE, SIG_IGN);
+
+      maxJobs = cpu::getCoreCount();
+
+      const std::string jobsVar = env::var("OCCA_COMPILE_SERVER_JOBS");
+
+      if(jobsVar.size())
+        maxJobs = std::max(1, ::atoi(jobsVar.c_str()));
+
+      std::cout << "Compile server [" << ::getpid() << "] listening on ["
+                << path << "] with " << maxJobs << " jobs\n" << std::flush;
+
+      pthread_attr_t attr;
+      pthread_attr_init(&attr);
+      pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+      double lastActive = currentTime();
+
+      while(true){
+        pollfd pfd;
+        pfd.fd      = serverFD;
+        pfd.events  = POLLIN;
+        pfd.revents = 0;
+
+        const int ready = ::poll(&pfd, 1, 1000);
+
+        if(ready <= 0){
+          pthread_mutex_lock(&jobMutex);
+          const bool idle = (activeConnections == 0);
+          pthread_mutex_unlock(&jobMutex);
+
+          if(!idle)
+            lastActive = currentTime();
+          else if(idleSeconds < (currentTime() - lastActive))
+            break;
+
+          continue;
+        }
+
+        const int fd = ::accept(serverFD, NULL, NULL);
+
+        if(fd < 0)
+          continue;
+
+        lastActive = currentTime();
+
+        pthread_mutex_lock(&jobMutex);
+        ++activeConnections;
+        pthread_mutex_unlock(&jobMutex);
+
+        pthread_t thread;
+
+        if(pthread_create(&thread, &attr, serveConnection, (void*) (intptr_t) fd)){
+          pthread_mutex_lock(&jobMutex);
+          --activeConnections;
+          pthread_mutex_unlock(&jobMutex);
+
+          ::close(fd);
+        }
+      }
+
+      pthread_attr_destroy(&attr);
+
+      ::unlink(path.c_str());
+      ::close(serverFD);
+      ::close(lockFD);
+
+      std::cout << "Compile server [" << ::getpid() << "] exiting after "
+                << idleSeconds << " idle seconds\n";
+#endif
+    }
+
+    bool build(const request_t &request,
+               std::string &output){
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      // Take the same lock as processes compiling without the server
+      while(true){
+        hashMutex.lock();
+        const bool haveLock = haveHash(request.hash, 0);
+        hashMutex.unlock();
+
+        if(haveLock)
+          break;
+
+        waitForHash(request.hash, 0);
+      }
+
+      bool success = true;
+
+      if(!sys::fileExists(request.binaryFilename)){
+        writeToFile(request.sourceFilename, request.source);
+
+        const std::string command = request.command();
+        const double compileStart = currentTime();
+
+        FILE *pipe = ::popen((command + " 2>&1").c_str(), "r");
+
+        if(pipe){
+          char buffer[4096];
+          size_t bytesRead;
+
+          while((bytesRead = ::fread(buffer, 1, sizeof(buffer), pipe)))
+            output.append(buffer, bytesRead);
+
+          success = (::pclose(pipe) == 0);
+        }
+        else {
+          output  = "Compile server could not run [" + command + "]\n";
+          success = false;
+        }
+
+        if(success){
+          recordCompilation(getFileDirectory(request.binaryFilename),
+                            request.functionName, command,
+                            currentTime() - compileStart,
+                            request.binaryFilename);
+        }
+
+        if(verboseCompilation_f){
+          std::cout << (success ? "Compiled [" : "Failed to compile [")
+                    << request.functionName << "] in ["
+                    << compressFilename(request.binaryFilename) << "]\n" << std::flush;
+        }
+      }
+
+      hashMutex.lock();
+      releaseHash(request.hash, 0);
+      hashMutex.unlock();
+
+      return success;
+#else
+      return false;
+#endif
+    }
+    //====================================
+  }
+  //==============================================
+}
@@ -0,0 +1,201 @@
+#include "occa/fusion.hpp"
+
+namespace occa {
+  //---[ Kernel Fusion ]--------------------------
+  kernelSequence::kernelSequence() {}
+
+  kernelSequence& kernelSequence::add(kernel k){
+    kernels.push_back(k);
+    arguments.push_back(std::vector<kernelArg>());
+
+    return *this;
+  }
+
+  kernelSequence& kernelSequence::add(kernel k,
+                                      const std::vector<kernelArg> &args){
+    kernels.push_back(k);
+    arguments.push_back(args);
+
+    return *this;
+  }
+
+  kernelSequence& kernelSequence::addArgument(const kernelArg &arg){
+    OCCA_CHECK(0 < kernels.size(),
+               "Add a kernel to the sequence before its arguments");
+
+    arguments.back().push_back(arg);
+
+    return *this;
+  }
+
+  int kernelSequence::size() const {
+    return (int) kernels.size();
+  }
+
+  void kernelSequence::clear(){
+    kernels.clear();
+    arguments.clear();
+  }
+
+  void kernelSequence::run(){
+    const int launches = size();
+    int start = 0;
+
+    while(start < launches){
+      int end = start + 1;
+
+      while((end < launches) && canFuse(kernels[start], kernels[end]))
+        ++end;
+
+      if((end - start) == 1){
+        runWithArguments(kernels[start], arguments[start]);
+      }
+      else {
+        std::vector<kernelArg> fusedArgs;
+        kernel fusedKernel = fuse(start, end, fusedArgs);
+
+        runWithArguments(fusedKernel, fusedArgs);
+      }
+
+      start = end;
+    }
+  }
+
+  void kernelSequence::free(){
+    std::map<std::string, kernel>::iterator it = fusedKernels.begin();
+
+    while(it != fusedKernels.end()){
+      it->second.free();
+      ++it;
+    }
+
+    fusedKernels.clear();
+  }
+
+  bool kernelSequence::canFuse(kernel &a, kernel &b){
+    kernel_v &aHandle = *(a.getKHandle());
+    kernel_v &bHandle = *(b.getKHandle());
+
+    // Only kernels the parser built can be fused, fused kernels
+    //   are not fused again
+    if((aHandle.buildFilename.size() == 0)            ||
+       (aHandle.metaInfo.argumentInfos.size() == 0)   ||
+       (bHandle.metaInfo.argumentInfos.size() == 0)   ||
+       aHandle.buildParserFlags.has("fuse-kernel")    ||
+       bHandle.buildParserFlags.has("fuse-kernel")){
+
+      return false;
+    }
+
+    return ((aHandle.buildFilename          == bHandle.buildFilename) &&
+            (aHandle.buildHeader            == bHandle.buildHeader)   &&
+            (aHandle.buildFlags             == bHandle.buildFlags)    &&
+            (aHandle.buildParserFlags.flags == bHandle.buildParserFlags.flags) &&
+            (buildDevice(a).getDHandle()    == buildDevice(b).getDHandle()));
+  }
+
+  kernel kernelSequence::fuse(const int start, const int end,
+                              std::vector<kernelArg> &fusedArgs){
+    kernel_v &kHandle = *(kernels[start].getKHandle());
+
+    occa::device device = buildDevice(kernels[start]);
+
+    kernelInfo info;
+    info.header      = kHandle.buildHeader;
+    info.flags       = kHandle.buildFlags;
+    info.parserFlags = kHandle.buildParserFlags;
+
+    std::map<std::string, int> argPositions;
+    std::stringstream launchInfo;
+
+    fusedArgs.clear();
+
+    for(int k = start; k < end; ++k){
+      const parsedKernelInfo &metaInfo = kernels[k].getKHandle()->metaInfo;
+      const std::vector<kernelArg> &args = arguments[k];
+
+      std::stringstream ss;
+      ss << metaInfo.name;
+
+      for(size_t a = 0; a < args.size(); ++a){
+        const std::string argKey = argumentKey(args[a]);
+        std::map<std::string, int>::iterator it = argPositions.find(argKey);
+
+        if(it == argPositions.end()){
+          it = argPositions.insert(std::make_pair(argKey, (int) fusedArgs.size())).first;
+          fusedArgs.push_back(args[a]);
+        }
+
+        ss << ' ' << it->second;
+      }
+
+      info.addParserFlag("fuse:" + toString(k - start), ss.str());
+      launchInfo << ss.str() << '\n';
+    }
+
+    // Values only change the fused kernel when launches share them
+    const std::string fusedName = ("occaFused_" +
+                                   getContentHash(launchInfo.str(), "fusion").substr(0, 16));
+
+    info.addParserFlag("fuse-kernel", fusedName);
+    info.addParserFlag("fuse-count" , toString(end - start));
+
+    std::stringstream cacheKey;
+    cacheKey << device.getDHandle() << '|'
+             << kHandle.buildFilename << '|'
+             << info.salt() << '|'
+             << launchInfo.str();
+
+    std::map<std::string, kernel>::iterator it = fusedKernels.find(cacheKey.str());
+
+    if(it != fusedKernels.end())
+      return it->second;
+
+    kernel fusedKernel = device.buildKernelFromSource(kHandle.buildFilename,
+                                                      fusedName,
+                                                      info);
+
+    fusedKernels[cacheKey.str()] = fusedKernel;
+
+    return fusedKernel;
+  }
+
+  std::string kernelSequence::argumentKey(const kernelArg &arg){
+    const kernelArg_t &arg_ = arg.args[0];
+    std::stringstream ss;
+
+    if(arg_.mHandle){
+      ss << 'm' << arg_.mHandle;
+    }
+    else {
+      const char *bytes = ((arg_.info & kArgInfo::usePointer) ?
+                           (const char*) arg_.data.void_     :
+                           (const char*) &(arg_.data));
+
+      ss << 'v' << arg_.size << ':' << std::string(bytes, arg_.size);
+    }
+
+    return ss.str();
+  }
+
+  // Launchers from the parser run on a host device, use
+  //   the device the nested kernels were built for
+  occa::device kernelSequence::buildDevice(kernel &k){
+    kernel_v &kHandle = *(k.getKHandle());
+
+    return (kHandle.nestedKernels.size()          ?
+            kHandle.nestedKernels[0].getDevice() :
+            k.getDevice());
+  }
+
+  void kernelSequence::runWithArguments(kernel &k,
+                                        const std::vector<kernelArg> &args){
+    k.clearArgumentList();
+
+    for(size_t i = 0; i < args.size(); ++i)
+      k.addArgument((int) i, args[i]);
+
+    k.runFromArguments();
+  }
+  //==============================================
+}
@@ -0,0 +1,81 @@
+#include "occa/half.hpp"
+
+// x86 builds without -mf16c still convert through F16C if the CPU has it
+#if ((OCCA_COMPILED_WITH & (OCCA_GNU_COMPILER | OCCA_LLVM_COMPILER)) && \
+     (defined(__x86_64__) || defined(__i386__)))
+#  include <immintrin.h>
+#  define OCCA_F16C_DISPATCH 1
+#else
+#  define OCCA_F16C_DISPATCH 0
+#endif
+
+namespace occa {
+#if OCCA_F16C_DISPATCH
+  static bool cpuHasF16C(){
+    static const bool hasF16C = __builtin_cpu_supports("f16c");
+
+    return hasF16C;
+  }
+
+  __attribute__ ((target("avx,f16c")))
+  static void floatToHalfF16C(const float *in, half *out, const size_t entries){
+    size_t i = 0;
+
+    for(; (i + 8) <= entries; i += 8){
+      const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), 0);
+      _mm_storeu_si128((__m128i*) (out + i), h);
+    }
+
+    for(; i < entries; ++i)
+      out[i].bits = (unsigned short) _cvtss_sh(in[i], 0);
+  }
+
+  __attribute__ ((target("avx,f16c")))
+  static void halfToFloatF16C(const half *in, float *out, const size_t entries){
+    size_t i = 0;
+
+    for(; (i + 8) <= entries; i += 8){
+      const __m128i h = _mm_loadu_si128((const __m128i*) (in + i));
+      _mm256_storeu_ps(out + i, _mm256_cvtph_ps(h));
+    }
+
+    for(; i < entries; ++i)
+      out[i] = _cvtsh_ss(in[i].bits);
+  }
+#endif
+
+  void floatToHalf(const float *in, half *out, const size_t entries){
+#if OCCA_F16C_DISPATCH
+    if(cpuHasF16C()){
+      floatToHalfF16C(in, out, entries);
+      return;
+    }
+#endif
+
+    for(size_t i = 0; i < entries; ++i)
+      out[i].bits = occaFloatToHalfBits(in[i]);
+  }
+
+  void halfToFloat(const half *in, float *out, const size_t entries){
+#if OCCA_F16C_DISPATCH
+    if(cpuHasF16C()){
+      halfToFloatF16C(in, out, entries);
+      return;
+    }
+#endif
+
+    for(size_t i = 0; i < entries; ++i)
+      out[i] = occaHalfBitsToFloat(in[i].bits);
+  }
+
+  // Only shifts and adds, the compiler vectorizes them
+  void floatToBfloat16(const float *in, bfloat16 *out, const size_t entries){
+    for(size_t i = 0; i < entries; ++i)
+      out[i].bits = occaFloatToBfloat16Bits(in[i]);
+  }
+
+  void bfloat16ToFloat(const bfloat16 *in, float *out, const size_t entries){
+    for(size_t i = 0; i < entries; ++i)
+      out[i] = occaBfloat16BitsToFloat(in[i].bits);
+  }
+}
@@ -1,176 +1,945 @@
-#include "occa/miniLib.hpp"
+#include <algorithm>
 
-#define OCCA_MEMSET_KERNEL_SOURCE(TYPE, CAP_TYPE)       \
-  "kernel void memset" #CAP_TYPE "K(" #TYPE " *ptr,\n"  \
-  "                        const " #TYPE " value,\n"    \
-  "                        const int count){\n"         \
-  "  for(int b = 0; b < count; b += 128; outer){\n"     \
-  "    for(int i = b; i < (b + 128); ++i; inner){\n"    \
-  "      if(i < count)\n"                               \
-  "        ptr[i] = value;\n"                           \
-  "    }\n"                                             \
-  "  }\n"                                               \
-  "}"
+#include "occa/miniLib.hpp"
 
 namespace occa {
-  template <>
-  void memset<bool>(void *ptr, const bool &value, uintptr_t count){
-    static occa::kernel *memsetBoolK = NULL;
+  // memset() fills through the primitives' kernel cache
+#define OCCA_MEMSET(TYPE)                                             \
+  template <>                                                         \
+  void memset<TYPE>(void *ptr, const TYPE &value, uintptr_t count){   \
+    miniLib::fill(occa::getCurrentDevice(), (TYPE*) ptr,              \
+                  reduction::type_t<TYPE>::name(), value, count);     \
+  }
+
+  OCCA_MEMSET(bool)
+  OCCA_MEMSET(char)
+  OCCA_MEMSET(short)
+  OCCA_MEMSET(int)
+  OCCA_MEMSET(long)
+  OCCA_MEMSET(float)
+  OCCA_MEMSET(double)
+  OCCA_MEMSET(half)
+  OCCA_MEMSET(bfloat16)
+
+#undef OCCA_MEMSET
+
+  //---[ Primitives ]-----------------------------
+  namespace miniLib {
+    class deviceCache_t {
+    public:
+      std::map<std::string, kernel> kernels;
+      occa::memory partials;
+    };
+
+    static mutex_t cacheMutex;
+    static std::map<device_v*, deviceCache_t> caches;
 
-    if(memsetBoolK != NULL){
-      (*memsetBoolK)(ptr, value, (int) count);
+    // Partials fit [reduction::maxGroups] values of any supported
+    //   type and their total after them
+    static deviceCache_t& cacheFor(occa::device device){
+      std::map<device_v*, deviceCache_t>::iterator it = caches.find(device.getDHandle());
+
+      if(it != caches.end())
+        return it->second;
+
+      deviceCache_t &cache = caches[device.getDHandle()];
+
+      cache.partials = device.malloc((reduction::maxGroups + 1) * sizeof(double));
+
+      return cache;
     }
-    else {
+
+    static kernel kernelFor(occa::device device,
+                            const std::string &key,
+                            const std::string &source,
+                            const std::string &name){
+
+      deviceCache_t &cache = cacheFor(device);
+
+      std::map<std::string, kernel>::iterator it = cache.kernels.find(key);
+
+      if(it != cache.kernels.end())
+        return it->second;
+
       const bool vc = verboseCompilation_f;
 
       if(vc)
         verboseCompilation_f = false;
 
-      memsetBoolK  = new occa::kernel;
-      *memsetBoolK = occa::buildKernel(OCCA_MEMSET_KERNEL_SOURCE(bool, Bool),
-                                       "memsetBoolK");
-
-      (*memsetBoolK)(ptr, value, (int) count);
+      kernel k = device.buildKernelFromString(source, name, usingOKL);
 
       verboseCompilation_f = vc;
+
+      cache.kernels[key] = k;
+
+      return k;
     }
-  }
 
-  template <>
-  void memset<char>(void *ptr, const char &value, uintptr_t count){
-    static occa::kernel *memsetCharK = NULL;
+    kernel cachedKernel(occa::device device,
+                        const std::string &key,
+                        const std::string &source,
+                        const std::string &name){
+      cacheMutex.lock();
+
+      kernel k = kernelFor(device, key, source, name);
 
-    if(memsetCharK != NULL){
-      (*memsetCharK)(ptr, value, (int) count);
+      cacheMutex.unlock();
+
+      return k;
     }
-    else {
-      const bool vc = verboseCompilation_f;
 
-      if(vc)
-        verboseCompilation_f = false;
+    // Pthreads threads run their queued launches independently,
+    //   dependent launches have to wait for the previous ones
+    static void waitForLaunches(occa::device device){
+      if(device.mode() == "Pthreads")
+        device.finish();
+    }
 
-      memsetCharK  = new occa::kernel;
-      *memsetCharK = occa::buildKernel(OCCA_MEMSET_KERNEL_SOURCE(char, Char),
-                                       "memsetCharK");
+    // Chunks start on cache lines
+    static int chunkFor(const uintptr_t entries, const int groups){
+      const int chunk = (int) ((entries + groups - 1) / groups);
 
-      (*memsetCharK)(ptr, value, (int) count);
+      return (((chunk + 63) / 64) * 64);
+    }
 
-      verboseCompilation_f = vc;
+    static void checkEntries(const uintptr_t entries){
+      OCCA_CHECK(entries <= (uintptr_t) std::numeric_limits<int>::max(),
+                 "Primitives are limited to [" << std::numeric_limits<int>::max() << "] entries");
     }
-  }
 
-  template <>
-  void memset<short>(void *ptr, const short &value, uintptr_t count){
-    static occa::kernel *memsetShortK = NULL;
+    //---[ Kernel Sources ]-------------
+    // One inner iteration per group, it owns [start, end)
+    static void openChunk(std::stringstream &ss){
+      ss << "  for(int g = 0; g < groups; ++g; outer0){\n"
+         << "    for(int t = 0; t < 1; ++t; inner0){\n"
+         << "      const int start = (((g * chunk) < entries) ? (g * chunk) : entries);\n"
+         << "      const int end   = (((start + chunk) < entries) ? (start + chunk) : entries);\n\n";
+    }
 
-    if(memsetShortK != NULL){
-      (*memsetShortK)(ptr, value, (int) count);
+    static void closeChunk(std::stringstream &ss){
+      ss << "    }\n"
+         << "  }\n"
+         << "}\n";
     }
-    else {
-      const bool vc = verboseCompilation_f;
 
-      if(vc)
-        verboseCompilation_f = false;
+    // Independent sums keep floating point adds pipelined
+    static std::string chunkSumsSource(const std::string &type){
+      std::stringstream ss;
+
+      ss << "kernel void occaChunkSums(const int entries,\n"
+         << "                          const int groups,\n"
+         << "                          const int chunk,\n"
+         << "                          const " << type << " *in,\n"
+         << "                          " << type << " *partials){\n";
+
+      openChunk(ss);
+
+      ss << "      const int end4 = start + (((end - start) / 4) * 4);\n\n"
+         << "      " << type << " sum0 = 0;\n"
+         << "      " << type << " sum1 = 0;\n"
+         << "      " << type << " sum2 = 0;\n"
+         << "      " << type << " sum3 = 0;\n\n"
+         << "      for(int i = start; i < end4; i += 4){\n"
+         << "        sum0 += in[i + 0];\n"
+         << "        sum1 += in[i + 1];\n"
+         << "        sum2 += in[i + 2];\n"
+         << "        sum3 += in[i + 3];\n"
+         << "      }\n\n"
+         << "      for(int i = end4; i < end; ++i){\n"
+         << "        sum0 += in[i];\n"
+         << "      }\n\n"
+         << "      partials[g] = ((sum0 + sum1) + (sum2 + sum3));\n";
+
+      closeChunk(ss);
+
+      return ss.str();
+    }
 
-      memsetShortK  = new occa::kernel;
-      *memsetShortK = occa::buildKernel(OCCA_MEMSET_KERNEL_SOURCE(short, Short),
-                                        "memsetShortK");
+    // Exclusive scan of the [groups] partials, their total is stored after them
+    static std::string scanPartialsSource(const std::string &type){
+      std::stringstream ss;
+
+      ss << "kernel void occaScanPartials(const int groups,\n"
+         << "                             " << type << " *partials){\n"
+         << "  for(int g = 0; g < 1; ++g; outer0){\n"
+         << "    for(int t = 0; t < 1; ++t; inner0){\n"
+         << "      " << type << " total = 0;\n\n"
+         << "      for(int i = 0; i < groups; ++i){\n"
+         << "        const " << type << " value = partials[i];\n"
+         << "        partials[i] = total;\n"
+         << "        total += value;\n"
+         << "      }\n\n"
+         << "      partials[groups] = total;\n";
+
+      closeChunk(ss);
+
+      return ss.str();
+    }
 
-      (*memsetShortK)(ptr, value, (int) count);
+    static std::string chunkScanSource(const std::string &type,
+                                       const bool inclusive){
+      std::stringstream ss;
 
-      verboseCompilation_f = vc;
+      ss << "kernel void occaChunkScan(const int entries,\n"
+         << "                          const int groups,\n"
+         << "                          const int chunk,\n"
+         << "                          const " << type << " *in,\n"
+         << "                          const " << type << " *partials,\n"
+         << "                          " << type << " *out){\n";
+
+      openChunk(ss);
+
+      ss << "      " << type << " total = partials[g];\n\n"
+         << "      for(int i = start; i < end; ++i){\n"
+         << "        const " << type << " value = in[i];\n";
+
+      if(inclusive)
+        ss << "        total += value;\n"
+           << "        out[i] = total;\n";
+      else
+        ss << "        out[i] = total;\n"
+           << "        total += value;\n";
+
+      ss << "      }\n";
+
+      closeChunk(ss);
+
+      return ss.str();
     }
-  }
 
-  template <>
-  void memset<int>(void *ptr, const int &value, uintptr_t count){
-    static occa::kernel *memsetIntK = NULL;
+    static void loadSelected(std::stringstream &ss,
+                             const std::string &type,
+                             const bool usesFlags){
+      ss << "        const " << type << " x = in[i];\n";
 
-    if(memsetIntK != NULL){
-      (*memsetIntK)(ptr, value, (int) count);
+      if(usesFlags)
+        ss << "        const int flag = flags[i];\n";
     }
-    else {
-      const bool vc = verboseCompilation_f;
 
-      if(vc)
-        verboseCompilation_f = false;
+    static std::string countIfSource(const std::string &type,
+                                     const std::string &predicate,
+                                     const bool usesFlags){
+      std::stringstream ss;
 
-      memsetIntK  = new occa::kernel;
-      *memsetIntK = occa::buildKernel(OCCA_MEMSET_KERNEL_SOURCE(int, Int),
-                                      "memsetIntK");
+      ss << "kernel void occaCountIf(const int entries,\n"
+         << "                        const int groups,\n"
+         << "                        const int chunk,\n"
+         << "                        const " << type << " *in,\n"
+         << "                        const int *flags,\n"
+         << "                        int *partials){\n";
 
-      (*memsetIntK)(ptr, value, (int) count);
+      openChunk(ss);
 
-      verboseCompilation_f = vc;
+      ss << "      int count = 0;\n\n"
+         << "      for(int i = start; i < end; ++i){\n";
+
+      loadSelected(ss, type, usesFlags);
+
+      ss << "        count += ((" << predicate << ") ? 1 : 0);\n"
+         << "      }\n\n"
+         << "      partials[g] = count;\n";
+
+      closeChunk(ss);
+
+      return ss.str();
     }
-  }
 
-  template <>
-  void memset<long>(void *ptr, const long &value, uintptr_t count){
-    static occa::kernel *memsetLongK = NULL;
+    static std::string scatterIfSource(const std::string &type,
+                                       const std::string &predicate,
+                                       const bool usesFlags){
+      std::stringstream ss;
+
+      ss << "kernel void occaScatterIf(const int entries,\n"
+         << "                          const int groups,\n"
+         << "                          const int chunk,\n"
+         << "                          const " << type << " *in,\n"
+         << "                          const int *flags,\n"
+         << "                          const int *partials,\n"
+         << "                          " << type << " *out){\n";
 
-    if(memsetLongK != NULL){
-      (*memsetLongK)(ptr, value, (int) count);
+      openChunk(ss);
+
+      ss << "      int pos = partials[g];\n\n"
+         << "      for(int i = start; i < end; ++i){\n";
+
+      loadSelected(ss, type, usesFlags);
+
+      ss << "        if(" << predicate << "){\n"
+         << "          out[pos] = x;\n"
+         << "          ++pos;\n"
+         << "        }\n"
+         << "      }\n";
+
+      closeChunk(ss);
+
+      return ss.str();
     }
-    else {
-      const bool vc = verboseCompilation_f;
 
-      if(vc)
-        verboseCompilation_f = false;
+    static std::string wordType(const size_t bytes){
+      return ((bytes == 4) ? "unsigned int" : "unsigned long");
+    }
 
-      memsetLongK  = new occa::kernel;
-      *memsetLongK = occa::buildKernel(OCCA_MEMSET_KERNEL_SOURCE(long, Long),
-                                       "memsetLongK");
+    // Declares the sign bit if [keyKind] needs it and returns the
+    //   digit of [k] after mapping its bits to unsigned bits with
+    //   the same order
+    static std::string radixDigit(std::stringstream &ss,
+                                  const char keyKind,
+                                  const size_t keyBytes){
+      const std::string uType = wordType(keyBytes);
 
-      (*memsetLongK)(ptr, value, (int) count);
+      std::string ordered = "k";
 
-      verboseCompilation_f = vc;
+      if(keyKind != 'u'){
+        ss << "      const " << uType << " signBit = (((" << uType << ") 1) << "
+           << (8*keyBytes - 1) << ");\n\n";
+
+        if(keyKind == 'i')
+          ordered = "(k ^ signBit)";
+        else
+          ordered = "((k & signBit) ? ~k : (k | signBit))";
+      }
+
+      return ("((int) ((" + ordered + " >> shift) & " + toString(radixBuckets - 1) + "))");
     }
-  }
 
-  template <>
-  void memset<float>(void *ptr, const float &value, uintptr_t count){
-    static occa::kernel *memsetFloatK = NULL;
+    // Bucket counts are stored bucket-major, [counts] then scans
+    //   into each group's first position in every bucket
+    static std::string radixHistogramSource(const char keyKind,
+                                            const size_t keyBytes){
+      const std::string uType = wordType(keyBytes);
+
+      std::stringstream ss;
+
+      ss << "kernel void occaRadixHistogram(const int entries,\n"
+         << "                               const int groups,\n"
+         << "                               const int chunk,\n"
+         << "                               const int shift,\n"
+         << "                               const " << uType << " *keys,\n"
+         << "                               int *counts){\n";
+
+      openChunk(ss);
+
+      const std::string digit = radixDigit(ss, keyKind, keyBytes);
+
+      ss << "      int hist[" << radixBuckets << "];\n\n"
+         << "      for(int d = 0; d < " << radixBuckets << "; ++d){\n"
+         << "        hist[d] = 0;\n"
+         << "      }\n\n"
+         << "      for(int i = start; i < end; ++i){\n"
+         << "        const " << uType << " k = keys[i];\n"
+         << "        const int d = " << digit << ";\n"
+         << "        hist[d] += 1;\n"
+         << "      }\n\n"
+         << "      for(int d = 0; d < " << radixBuckets << "; ++d){\n"
+         << "        counts[d*groups + g] = hist[d];\n"
+         << "      }\n";
+
+      closeChunk(ss);
+
+      return ss.str();
+    }
+
+    static std::string radixScatterSource(const char keyKind,
+                                          const size_t keyBytes,
+                                          const size_t valueBytes){
+      const std::string uType = wordType(keyBytes);
+      const std::string vType = wordType(valueBytes ? valueBytes : keyBytes);
+
+      std::stringstream ss;
+
+      ss << "kernel void occaRadixScatter(const int entries,\n"
+         << "                             const int groups,\n"
+         << "                             const int chunk,\n"
+         << "                             const int shift,\n"
+         << "                             const " << uType << " *keysIn,\n"
+         << "                             const " << vType << " *valuesIn,\n"
+         << "                             const int *offsets,\n"
+         << "                             " << uType << " *keysOut,\n"
+         << "                             " << vType << " *valuesOut){\n";
+
+      openChunk(ss);
+
+      const std::string digit = radixDigit(ss, keyKind, keyBytes);
+
+      ss << "      int offset[" << radixBuckets << "];\n\n"
+         << "      for(int d = 0; d < " << radixBuckets << "; ++d){\n"
+         << "        offset[d] = offsets[d*groups + g];\n"
+         << "      }\n\n"
+         << "      for(int i = start; i < end; ++i){\n"
+         << "        const " << uType << " k = keysIn[i];\n"
+         << "        const int d   = " << digit << ";\n"
+         << "        const int pos = offset[d];\n\n"
+         << "        offset[d] = pos + 1;\n\n"
+         << "        keysOut[pos] = k;\n";
 
-    if(memsetFloatK != NULL){
-      (*memsetFloatK)(ptr, value, (int) count);
+      if(valueBytes)
+        ss << "        valuesOut[pos] = valuesIn[i];\n";
+
+      ss << "      }\n";
+
+      closeChunk(ss);
+
+      return ss.str();
     }
-    else {
-      const bool vc = verboseCompilation_f;
+    //==================================
 
-      if(vc)
-        verboseCompilation_f = false;
+    static void launchChunks(kernel k,
+                             const int entries,
+                             const int groups,
+                             const int chunk,
+                             const int argCount,
+                             const kernelArg *args){
+      k.clearArgumentList();
 
-      memsetFloatK  = new occa::kernel;
-      *memsetFloatK = occa::buildKernel(OCCA_MEMSET_KERNEL_SOURCE(float, Float),
-                                        "memsetFloatK");
+      k.addArgument(0, entries);
+      k.addArgument(1, groups);
+      k.addArgument(2, chunk);
 
-      (*memsetFloatK)(ptr, value, (int) count);
+      for(int i = 0; i < argCount; ++i)
+        k.addArgument(3 + i, args[i]);
 
-      verboseCompilation_f = vc;
+      k.runFromArguments();
     }
-  }
 
-  template <>
-  void memset<double>(void *ptr, const double &value, uintptr_t count){
-    static occa::kernel *memsetDoubleK = NULL;
+    static void scanPartials(occa::device device,
+                             const std::string &type,
+                             occa::memory partials,
+                             const int groups){
+      kernel k = kernelFor(device,
+                           "scanPartials|" + type,
+                           scanPartialsSource(type),
+                           "occaScanPartials");
+
+      waitForLaunches(device);
+
+      k.clearArgumentList();
 
-    if(memsetDoubleK != NULL){
-      (*memsetDoubleK)(ptr, value, (int) count);
+      k.addArgument(0, groups);
+      k.addArgument(1, partials);
+
+      k.runFromArguments();
+
+      waitForLaunches(device);
     }
-    else {
-      const bool vc = verboseCompilation_f;
 
-      if(vc)
-        verboseCompilation_f = false;
+    // Expects [cacheMutex] to be locked
+    static void scanLocked(occa::memory in,
+                           occa::memory out,
+                           const std::string &type,
+                           const bool inclusive,
+                           const uintptr_t entries){
+      occa::device device(in.getDHandle());
 
-      memsetDoubleK  = new occa::kernel;
-      *memsetDoubleK = occa::buildKernel(OCCA_MEMSET_KERNEL_SOURCE(double, Double),
-                                         "memsetDoubleK");
+      deviceCache_t &cache = cacheFor(device);
 
-      (*memsetDoubleK)(ptr, value, (int) count);
+      const int groups = reduction::groupsFor(device, entries);
+      const int chunk  = chunkFor(entries, groups);
 
-      verboseCompilation_f = vc;
+      kernel sumsK = kernelFor(device,
+                               "chunkSums|" + type,
+                               chunkSumsSource(type),
+                               "occaChunkSums");
+
+      kernel scanK = kernelFor(device,
+                               "chunkScan|" + type + (inclusive ? "|inclusive" : "|exclusive"),
+                               chunkScanSource(type, inclusive),
+                               "occaChunkScan");
+
+      const kernelArg sumsArgs[2] = {in, cache.partials};
+      launchChunks(sumsK, (int) entries, groups, chunk, 2, sumsArgs);
+
+      scanPartials(device, type, cache.partials, groups);
+
+      const kernelArg scanArgs[3] = {in, cache.partials, out};
+      launchChunks(scanK, (int) entries, groups, chunk, 3, scanArgs);
+    }
+
+    void scan(occa::memory in,
+              occa::memory out,
+              const std::string &type,
+              const size_t typeBytes,
+              const bool inclusive,
+              const uintptr_t entries){
+
+      checkEntries(entries);
+
+      OCCA_CHECK(typeBytes <= sizeof(double),
+                 "Scans only support types up to [" << sizeof(double) << "] bytes");
+
+      if(entries == 0)
+        return;
+
+      cacheMutex.lock();
+
+      scanLocked(in, out, type, inclusive, entries);
+
+      cacheMutex.unlock();
+    }
+
+    uintptr_t copyIf(occa::memory in,
+                     occa::memory flags,
+                     occa::memory out,
+                     const std::string &type,
+                     const size_t typeBytes,
+                     const std::string &predicate,
+                     const bool usesFlags,
+                     const uintptr_t entries){
+
+      checkEntries(entries);
+
+      if(entries == 0)
+        return 0;
+
+      occa::device device(in.getDHandle());
+
+      cacheMutex.lock();
+
+      deviceCache_t &cache = cacheFor(device);
+
+      const int groups = reduction::groupsFor(device, entries);
+      const int chunk  = chunkFor(entries, groups);
+
+      const std::string key = (type + (usesFlags ? "|flags|" : "|") + predicate);
+
+      kernel countK = kernelFor(device,
+                                "countIf|" + key,
+                                countIfSource(type, predicate, usesFlags),
+                                "occaCountIf");
+
+      kernel scatterK = kernelFor(device,
+                                  "scatterIf|" + key,
+                                  scatterIfSource(type, predicate, usesFlags),
+                                  "occaScatterIf");
+
+      const kernelArg countArgs[3] = {in, flags, cache.partials};
+      launchChunks(countK, (int) entries, groups, chunk, 3, countArgs);
+
+      scanPartials(device, "int", cache.partials, groups);
+
+      const kernelArg scatterArgs[4] = {in, flags, cache.partials, out};
+      launchChunks(scatterK, (int) entries, groups, chunk, 4, scatterArgs);
+
+      int count;
+      cache.partials.copyTo(&count, sizeof(int), groups * sizeof(int));
+
+      cacheMutex.unlock();
+
+      return (uintptr_t) count;
+    }
+
+    void radixSort(occa::memory keys,
+                   occa::memory values,
+                   const char keyKind,
+                   const size_t keyBytes,
+                   const size_t valueBytes,
+                   const uintptr_t entries){
+
+      checkEntries(entries);
+
+      OCCA_CHECK((keyBytes == 4) || (keyBytes == 8),
+                 "Radix sort only supports 4 or 8 byte keys");
+
+      OCCA_CHECK((valueBytes == 0) || (valueBytes == 4) || (valueBytes == 8),
+                 "Radix sort only supports 4 or 8 byte values");
+
+      if(entries <= 1)
+        return;
+
+      occa::device device(keys.getDHandle());
+
+      cacheMutex.lock();
+
+      const int groups = reduction::groupsFor(device, entries);
+      const int chunk  = chunkFor(entries, groups);
+
+      const std::string key = (std::string(1, keyKind) + '|' +
+                               toString(keyBytes) + '|' + toString(valueBytes));
+
+      kernel histogramK = kernelFor(device,
+                                    "radixHistogram|" + key,
+                                    radixHistogramSource(keyKind, keyBytes),
+                                    "occaRadixHistogram");
+
+      kernel scatterK = kernelFor(device,
+                                  "radixScatter|" + key,
+                                  radixScatterSource(keyKind, keyBytes, valueBytes),
+                                  "occaRadixScatter");
+
+      occa::memory counts = device.malloc(radixBuckets * groups * sizeof(int));
+
+      occa::memory keys2   = device.malloc(entries * keyBytes);
+      occa::memory values2 = (valueBytes ? device.malloc(entries * valueBytes) : keys2);
+
+      occa::memory keysIn  = keys, valuesIn  = (valueBytes ? values : keys);
+      occa::memory keysOut = keys2, valuesOut = values2;
+
+      // An even number of passes leaves the sorted entries in [keys]
+      const int passes = (int) ((8 * keyBytes) / radixBits);
+
+      for(int pass = 0; pass < passes; ++pass){
+        const int shift = (pass * radixBits);
+
+        const kernelArg histogramArgs[3] = {shift, keysIn, counts};
+        launchChunks(histogramK, (int) entries, groups, chunk, 3, histogramArgs);
+
+        waitForLaunches(device);
+
+        scanLocked(counts, counts, "int", false, radixBuckets * groups);
+
+        waitForLaunches(device);
+
+        const kernelArg scatterArgs[6] = {shift,
+                                          keysIn, valuesIn,
+                                          counts,
+                                          keysOut, valuesOut};
+        launchChunks(scatterK, (int) entries, groups, chunk, 6, scatterArgs);
+
+        waitForLaunches(device);
+
+        keysIn.swap(keysOut);
+        valuesIn.swap(valuesOut);
+      }
+
+      cacheMutex.unlock();
+
+      counts.free();
+      keys2.free();
+
+      if(valueBytes)
+        values2.free();
+    }
+
+    //---[ Memory ]---------------------
+    // [params] are separated by ';', CPU modes loop over one chunk
+    //   per thread and GPU modes use one iteration per entry.
+    //   Chunks declare [start] and [end]
+    static std::string mapSource(const std::string &name,
+                                 const std::string &params,
+                                 const std::string &statement,
+                                 const bool cpuLayout){
+      const std::string indent(13 + name.size(), ' ');
+
+      std::stringstream ss;
+
+      ss << "kernel void " << name << "(const int entries";
+
+      if(cpuLayout){
+        ss << ",\n" << indent << "const int groups"
+           << ",\n" << indent << "const int chunk";
+      }
+
+      std::stringstream paramStream(params);
+      std::string param;
+
+      while(std::getline(paramStream, param, ';'))
+        ss << ",\n" << indent << param;
+
+      ss << "){\n";
+
+      if(cpuLayout){
+        openChunk(ss);
+
+        ss << "      for(int i = start; i < end; ++i){\n"
+           << "        " << statement << '\n'
+           << "      }\n";
+
+        closeChunk(ss);
+      }
+      else {
+        ss << "  for(int i = 0; i < entries; ++i; tile(" << reduction::gpuInnerSize << ")){\n"
+           << "    if(i < entries)\n"
+           << "      " << statement << '\n'
+           << "  }\n"
+           << "}\n";
+      }
+
+      return ss.str();
+    }
+
+    static void runMap(occa::device device,
+                       const std::string &name,
+                       const std::string &params,
+                       const std::string &statement,
+                       const uintptr_t entries,
+                       const int argCount,
+                       const kernelArg *args){
+      checkEntries(entries);
+
+      if(entries == 0)
+        return;
+
+      const bool cpuLayout = reduction::usesCPULayout(device);
+
+      kernel k = cachedKernel(device,
+                              (name + '|' + params + '|' + statement +
+                               (cpuLayout ? "|cpu" : "|gpu")),
+                              mapSource(name, params, statement, cpuLayout),
+                              name);
+
+      if(cpuLayout){
+        const int groups = reduction::groupsFor(device, entries);
+
+        launchChunks(k, (int) entries, groups, chunkFor(entries, groups),
+                     argCount, args);
+        return;
+      }
+
+      k.clearArgumentList();
+
+      k.addArgument(0, (int) entries);
+
+      for(int i = 0; i < argCount; ++i)
+        k.addArgument(1 + i, args[i]);
+
+      k.runFromArguments();
+    }
+
+    void fill(occa::device device,
+              const kernelArg &out,
+              const std::string &type,
+              const kernelArg &value,
+              const uintptr_t entries){
+
+      const kernelArg args[2] = {out, value};
+
+      runMap(device, "occaFill",
+             type + " *out;const " + type + " value",
+             "out[i] = value;",
+             entries, 2, args);
+    }
+
+    void fill(occa::memory out,
+              occa::memory pattern,
+              const std::string &type,
+              const uintptr_t patternEntries,
+              const uintptr_t entries){
+
+      OCCA_CHECK(0 < patternEntries,
+                 "Fill patterns need at least one entry");
+
+      const kernelArg args[3] = {out, pattern, (int) patternEntries};
+
+      runMap(occa::device(out.getDHandle()), "occaFillPattern",
+             type + " *out;const " + type + " *pattern;const int patternEntries",
+             "out[i] = pattern[i % patternEntries];",
+             entries, 3, args);
+    }
+
+    void iota(occa::memory out,
+              const std::string &type,
+              const kernelArg &start,
+              const kernelArg &step,
+              const uintptr_t entries){
+
+      const kernelArg args[3] = {out, start, step};
+
+      runMap(occa::device(out.getDHandle()), "occaIota",
+             type + " *out;const " + type + " first;const " + type + " step",
+             "out[i] = first + (i * step);",
+             entries, 3, args);
+    }
+
+    void gather(occa::memory in,
+                occa::memory indices,
+                occa::memory out,
+                const std::string &type,
+                const uintptr_t entries){
+
+      const kernelArg args[3] = {in, indices, out};
+
+      runMap(occa::device(out.getDHandle()), "occaGather",
+             "const " + type + " *in;const int *indices;" + type + " *out",
+             "out[i] = in[indices[i]];",
+             entries, 3, args);
+    }
+
+    void scatter(occa::memory in,
+                 occa::memory indices,
+                 occa::memory out,
+                 const std::string &type,
+                 const bool add,
+                 const uintptr_t entries){
+
+      const kernelArg args[3] = {in, indices, out};
+
+      runMap(occa::device(out.getDHandle()), (add ? "occaScatterAdd" : "occaScatter"),
+             "const " + type + " *in;const int *indices;" + type + " *out",
+             (add                                            ?
+              "occaAtomicAdd(&(out[indices[i]]), in[i]);"    :
+              "out[indices[i]] = in[i];"),
+             entries, 3, args);
+    }
+
+    // Rows are copied by CPU threads in one loop or by GPU
+    //   inner iterations
+    static std::string copy3DSource(const std::string &type,
+                                    const bool cpuLayout){
+      std::stringstream ss;
+
+      ss << "kernel void occaCopy3D(const int width,\n"
+         << "                       const int height,\n"
+         << "                       const int rows,\n"
+         << "                       " << type << " *dest,\n"
+         << "                       const int destOffset,\n"
+         << "                       const int destPitch,\n"
+         << "                       const int destSlicePitch,\n"
+         << "                       const " << type << " *src,\n"
+         << "                       const int srcOffset,\n"
+         << "                       const int srcPitch,\n"
+         << "                       const int srcSlicePitch){\n";
+
+      if(cpuLayout){
+        ss << "  for(int r = 0; r < rows; ++r; outer0){\n"
+           << "    for(int t = 0; t < 1; ++t; inner0){\n"
+           << "      const int y = (r % height);\n"
+           << "      const int z = (r / height);\n\n"
+           << "      " << type << " *destRow = dest + (destOffset + (z * destSlicePitch) + (y * destPitch));\n"
+           << "      const " << type << " *srcRow = src + (srcOffset + (z * srcSlicePitch) + (y * srcPitch));\n\n"
+           << "      for(int x = 0; x < width; ++x){\n"
+           << "        destRow[x] = srcRow[x];\n"
+           << "      }\n"
+           << "    }\n"
+           << "  }\n"
+           << "}\n";
+      }
+      else {
+        ss << "  for(int r = 0; r < rows; ++r; outer1){\n"
+           << "    for(int b = 0; b < width; b += " << reduction::gpuInnerSize << "; outer0){\n"
+           << "      for(int x = b; x < (b + " << reduction::gpuInnerSize << "); ++x; inner0){\n"
+           << "        if(x < width){\n"
+           << "          const int y = (r % height);\n"
+           << "          const int z = (r / height);\n\n"
+           << "          dest[destOffset + (z * destSlicePitch) + (y * destPitch) + x] =\n"
+           << "            src[srcOffset + (z * srcSlicePitch) + (y * srcPitch) + x];\n"
+           << "        }\n"
+           << "      }\n"
+           << "    }\n"
+           << "  }\n"
+           << "}\n";
+      }
+
+      return ss.str();
+    }
+
+    // Last entry used by a block plus one
+    static uintptr_t blockEnd(const uintptr_t width,
+                              const uintptr_t height,
+                              const uintptr_t depth,
+                              const uintptr_t offset,
+                              const uintptr_t pitch,
+                              const uintptr_t slicePitch){
+
+      return (offset + ((depth - 1) * slicePitch) + ((height - 1) * pitch) + width);
+    }
+
+    void copy3D(occa::memory dest,
+                occa::memory src,
+                const size_t typeBytes,
+                const uintptr_t width,
+                const uintptr_t height,
+                const uintptr_t depth,
+                const uintptr_t destOffset,
+                const uintptr_t destPitch,
+                const uintptr_t destSlicePitch,
+                const uintptr_t srcOffset,
+                const uintptr_t srcPitch,
+                const uintptr_t srcSlicePitch){
+
+      if((width == 0) || (height == 0) || (depth == 0))
+        return;
+
+      OCCA_CHECK((height == 1) || ((width <= destPitch) && (width <= srcPitch)),
+                 "copy2D/3D rows can't be wider than their pitch");
+
+      const uintptr_t destEnd = blockEnd(width, height, depth,
+                                         destOffset, destPitch, destSlicePitch);
+      const uintptr_t srcEnd  = blockEnd(width, height, depth,
+                                         srcOffset, srcPitch, srcSlicePitch);
+
+      OCCA_CHECK((destEnd * typeBytes) <= dest.bytes(),
+                 "copy2D/3D writes past the end of [dest]");
+
+      OCCA_CHECK((srcEnd * typeBytes) <= src.bytes(),
+                 "copy2D/3D reads past the end of [src]");
+
+      // Entries are copied as the largest words dividing them
+      const size_t wordBytes = (((typeBytes % 8) == 0) ? 8 :
+                                ((typeBytes % 4) == 0) ? 4 :
+                                ((typeBytes % 2) == 0) ? 2 : 1);
+      const uintptr_t words  = (typeBytes / wordBytes);
+
+      const std::string type = ((wordBytes == 8) ? "long"  :
+                                (wordBytes == 4) ? "int"   :
+                                (wordBytes == 2) ? "short" : "char");
+
+      checkEntries(std::max(destEnd, srcEnd) * words);
+      checkEntries(height * depth);
+
+      occa::device device(dest.getDHandle());
+
+      const bool cpuLayout = reduction::usesCPULayout(device);
+
+      kernel k = cachedKernel(device,
+                              "copy3D|" + type + (cpuLayout ? "|cpu" : "|gpu"),
+                              copy3DSource(type, cpuLayout),
+                              "occaCopy3D");
+
+      k.clearArgumentList();
+
+      k.addArgument(0 , (int) (width * words));
+      k.addArgument(1 , (int) height);
+      k.addArgument(2 , (int) (height * depth));
+      k.addArgument(3 , dest);
+      k.addArgument(4 , (int) (destOffset * words));
+      k.addArgument(5 , (int) (destPitch * words));
+      k.addArgument(6 , (int) (destSlicePitch * words));
+      k.addArgument(7 , src);
+      k.addArgument(8 , (int) (srcOffset * words));
+      k.addArgument(9 , (int) (srcPitch * words));
+      k.addArgument(10, (int) (srcSlicePitch * words));
+
+      k.runFromArguments();
+    }
+    //==================================
+
+    static void freeCache(deviceCache_t &cache){
+      std::map<std::string, kernel>::iterator it = cache.kernels.begin();
+
+      while(it != cache.kernels.end()){
+        it->second.free();
+        ++it;
+      }
+
+      cache.partials.free();
+    }
+
+    void free(occa::device device){
+      cacheMutex.lock();
+
+      std::map<device_v*, deviceCache_t>::iterator it = caches.find(device.getDHandle());
+
+      if(it != caches.end()){
+        freeCache(it->second);
+        caches.erase(it);
+      }
+
+      cacheMutex.unlock();
+    }
+
+    void free(){
+      cacheMutex.lock();
+
+      std::map<device_v*, deviceCache_t>::iterator it = caches.begin();
+
+      while(it != caches.end()){
+        freeCache(it->second);
+        ++it;
+      }
+
+      caches.clear();
+
+      cacheMutex.unlock();
     }
   }
+  //==============================================
 }
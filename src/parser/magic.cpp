@@ -1,15 +1,209 @@
 #include "occa/parser/magic.hpp"
+#include "occa/base.hpp"
 
-#define DBP0 1 // Read/Write/Expand
+#define DBP0 0 // Read/Write/Expand
 #define DBP1 0 // Index Sorting/Updating
 #define DBP2 0 // Expression Simplification
 #define DBP3 0 // Has Stride
-#define DBP4 1 // Check Complex Inputs, Access Stride Conflicts, Access Conflicts
+#define DBP4 0 // Check Complex Inputs, Access Stride Conflicts, Access Conflicts
 #define DBP5 0 // LCD-labeled Statements and GCS Prints, For-loops with LCD
-#define DBP6 1 // Outer-Loop/Inner-Loop Posibilities
+#define DBP6 0 // Outer-Loop/Inner-Loop Posibilities
 
 namespace occa {
   namespace parserNS {
+    //  Array accesses are [[] nodes with the array and index as leaves,
+    //    [a[i][j]] is stored as [[]([[](a, i), j)
+    static bool isAnArrayAccess(expNode &e){
+      return ((e.info & expType::LR) &&
+              (e.value == "[")       &&
+              (e.leafCount == 2));
+    }
+
+    static expNode& arrayAccessVariable(expNode &e){
+      expNode *n = &e;
+
+      while(isAnArrayAccess(*n))
+        n = n->leaves[0];
+
+      return *n;
+    }
+
+    // Returns 0 if [e] doesn't index a variable
+    static int arrayAccessDims(expNode &e){
+      int dims = 0;
+      expNode *n = &e;
+
+      while(isAnArrayAccess(*n)){
+        n = n->leaves[0];
+        ++dims;
+      }
+
+      return ((n->info & expType::varInfo) ? dims : 0);
+    }
+
+    static expNode& arrayAccessIndex(expNode &e, const int dims, const int dim){
+      expNode *n = &e;
+
+      for(int d = (dims - 1); dim < d; --d)
+        n = n->leaves[0];
+
+      return (*n)[1];
+    }
+
+    static bool expHasArrayAccess(expNode &e){
+      if(isAnArrayAccess(e))
+        return true;
+
+      for(int i = 0; i < e.leafCount; ++i){
+        if(expHasArrayAccess(e[i]))
+          return true;
+      }
+
+      return false;
+    }
+
+    static bool expUsesVariable(expNode &e, varInfo &var){
+      if(e.info & expType::varInfo)
+        return (&(e.getVarInfo()) == &var);
+
+      for(int i = 0; i < e.leafCount; ++i){
+        if(expUsesVariable(e[i], var))
+          return true;
+      }
+
+      return false;
+    }
+
+    //  Stores the coefficient of [var] in [e] as a string, or an empty
+    //    string if [e] doesn't use [var]
+    //
+    //  Returns false if [e] is not linear in [var]
+    static bool linearCoefficient(expNode &e, varInfo &var, std::string &coeff){
+      coeff = "";
+
+      if(!expUsesVariable(e, var))
+        return true;
+
+      if(e.info & expType::varInfo){
+        coeff = "1";
+        return true;
+      }
+
+      if((e.value == "(") && (e.leafCount == 1))
+        return linearCoefficient(e[0], var, coeff);
+
+      if((e.info & expType::L_R) && (e.leafCount == 1)){
+        if(e.value == "+")
+          return linearCoefficient(e[0], var, coeff);
+
+        if(e.value == "-"){
+          if(!linearCoefficient(e[0], var, coeff))
+            return false;
+
+          coeff = "-(" + coeff + ")";
+          return true;
+        }
+
+        return false;
+      }
+
+      if(!(e.info & expType::LR) || (e.leafCount != 2))
+        return false;
+
+      std::string coeff0, coeff1;
+
+      if(!linearCoefficient(e[0], var, coeff0) ||
+         !linearCoefficient(e[1], var, coeff1)){
+
+        return false;
+      }
+
+      if(e.value == "+" || e.value == "-"){
+        if(coeff0.size() && coeff1.size())
+          return false;
+
+        if(coeff0.size())
+          coeff = coeff0;
+        else
+          coeff = ((e.value == "+") ? coeff1 : ("-(" + coeff1 + ")"));
+
+        return true;
+      }
+
+      if(e.value == "*"){
+        if(coeff0.size() && coeff1.size())
+          return false;
+
+        const std::string &varCoeff = (coeff0.size() ? coeff0 : coeff1);
+        std::string factor = (coeff0.size() ? e[1] : e[0]).toString();
+
+        factor.erase(std::remove_if(factor.begin(), factor.end(), ::isspace),
+                     factor.end());
+
+        coeff = ((varCoeff == "1") ? factor : ("(" + varCoeff + ")*(" + factor + ")"));
+        return true;
+      }
+
+      return false;
+    }
+
+    //  Indices only use constants, arithmetic, the loop iterators and
+    //    variables that are not written in the loop
+    static bool indexIsAffine(expNode &e,
+                              varInfo &iter,
+                              std::vector<varInfo*> &iterators,
+                              std::vector<varInfo*> &writtenVars){
+
+      if(e.info & expType::varInfo){
+        varInfo *var = &(e.getVarInfo());
+
+        if((var == &iter) ||
+           (std::find(iterators.begin(), iterators.end(), var) != iterators.end())){
+
+          return true;
+        }
+
+        return (std::find(writtenVars.begin(), writtenVars.end(), var) == writtenVars.end());
+      }
+
+      if(e.info & expType::presetValue)
+        return true;
+
+      if((e.value != "(") &&
+         (e.value != "+") && (e.value != "-") &&
+         (e.value != "*") && (e.value != "/") && (e.value != "%")){
+
+        return false;
+      }
+
+      for(int i = 0; i < e.leafCount; ++i){
+        if(!indexIsAffine(e[i], iter, iterators, writtenVars))
+          return false;
+      }
+
+      return true;
+    }
+
+    arrayAccess_t::arrayAccess_t() :
+      var(NULL),
+      s(NULL),
+      isWrite(false) {}
+
+    std::string arrayAccess_t::indexStr() const {
+      std::string str;
+
+      for(size_t i = 0; i < indices.size(); ++i){
+        std::string index = indices[i]->toString();
+
+        index.erase(std::remove_if(index.begin(), index.end(), ::isspace),
+                    index.end());
+
+        str += "[" + index + "]";
+      }
+
+      return str;
+    }
+
     namespace viType {
       std::string infoToStr(const int info){
         std::string tag;
@@ -1279,7 +1473,8 @@ namespace occa {
     }
 
     void viInfo_t::updateValue(expNode &opNode, expNode &setNode){
-      if(opNode.value == "="){
+      if((opNode.value == "=") &&
+         !expHasArrayAccess(setNode)){
         // Fixes recursive issue
         valueInfo_t vi;
         vi.setDB(db);
@@ -1295,13 +1490,10 @@ namespace occa {
         valueInfo = vi;
       }
       else {
-#if DBP0
-        std::cout << "Y1. valueInfo = " << valueInfo << '\n';
-#endif
-        valueInfo.update(opNode, setNode);
-#if DBP0
-        std::cout << "Y2. valueInfo = " << valueInfo << '\n';
-#endif
+        // Values updated in place ([+=], [*=], ...) or loaded from
+        //   arrays are not followed
+        info |= viType::isComplex;
+        return;
       }
 
       checkComplexity();
@@ -1579,14 +1771,11 @@ namespace occa {
 
     magician::magician(parserBase &parser_) :
       parser(parser_),
-      globalScope( *(parser_.globalScope) ) {
+      globalScope( *(parser_.globalScope) ),
+      tileSize("16") {
 
-      testedTileSizes.push_back(8);
-      testedTileSizes.push_back(16);
-      testedTileSizes.push_back(32);
-      testedTileSizes.push_back(64);
-      testedTileSizes.push_back(128);
-      testedTileSizes.push_back(256);
+      if(parser.parsingFlags.has("magic-tile-size"))
+        tileSize = parser.parsingFlags["magic-tile-size"];
     }
 
     void magician::castMagicOn(parserBase &parser_){
@@ -1605,6 +1794,12 @@ namespace occa {
         else
           sn = sn->right;
       }
+
+      if(verboseCompilation_f ||
+         parser.parsingFlags.hasEnabled("magic-report")){
+
+        std::cout << report.str();
+      }
     }
 
     statementNode* magician::analyzeFunction(statement &fs){
@@ -1633,10 +1828,12 @@ namespace occa {
 
       db.lock();
       updateLoopBounds(fs);
-      statementNode *ret = generatePossibleKernels(fs);
+
+      kernelName = fs.getFunctionName();
+      labelLoops(fs);
       db.unlock();
 
-      return ret;
+      return fs.getStatementNode()->right;
     }
 
     void magician::analyzeStatement(statement &s){
@@ -1740,8 +1937,10 @@ namespace occa {
         addVariableWrite(varNode, opNode, initNode);
         addExpressionRead(initNode);
 
-        viInfo_t &viInfo = db[ varNode.getVarInfo() ];
-        viInfo.valueInfo.load(initNode);
+        if(!expHasArrayAccess(initNode)){
+          viInfo_t &viInfo = db[ varNode.getVarInfo() ];
+          viInfo.valueInfo.load(initNode);
+        }
       }
     }
 
@@ -1937,6 +2136,8 @@ namespace occa {
 #endif
 
       expNode::freeFlatHandle(flatRoot);
+
+      db.smntInfoMap[&s] |= analyzeInfo::isCanonical;
     }
 
     void magician::analyzeWhileStatement(statement &s){
@@ -2069,348 +2270,492 @@ namespace occa {
       return false;
     }
 
-    statementNode* magician::generatePossibleKernels(statement &kernel){
-#if DBP5
-      printIfLoopsHaveLCD(kernel);
-#endif
-
-      statementVector_t loopsVec;
-      intVector_t depthVec;
-      intVector_t outerLoopVec;
-      intVecVector_t innerLoopVec;
-      int depth = 0;
-
-      // Initial vector
-      innerLoopVec.push_back(intVector_t());
+    //  Parallel loops become [outer] loops, with their nested loops as
+    //    [inner] loops if they are parallel and have the same bounds.
+    //    Otherwise they are tiled
+    //
+    //  Loops with loop-carried dependencies stay serial, loops inside
+    //    them are labeled instead
+    void magician::labelLoops(statement &s){
+      statementNode *sn = s.statementStart;
 
-      storeLoopsAndDepths(kernel, loopsVec, depthVec, depth);
+      while(sn){
+        statement &s2 = *(sn->value);
 
-      const int loopCount = (int) loopsVec.size();
+        if(s2.info != smntType::forStatement){
+          labelLoops(s2);
+          sn = sn->right;
+          continue;
+        }
 
-      for(int o = 0; o < loopCount; ++o){
-        const int oDepth = depthVec[o];
+        const std::string reason = reasonLoopIsSerial(s2);
 
-        // The deepest for-loop branch has all of
-        //   the possible bounds
-        int innerMostLoop  = 0;
-        int innerMostDepth = 0;
+        if(reason.size()){
+          addToReport(s2, "serial, " + reason);
+          labelLoops(s2);
+          sn = sn->right;
+          continue;
+        }
 
-        for(int i = (o + 1); i < loopCount; ++i){
-          int iDepth = depthVec[i];
+        statementVector_t innerLoops;
 
-          if(iDepth <= oDepth)
-            break;
+        if(storeInnerLoops(s2, innerLoops)){
+          tagLoop(s2, "outer");
+          addToReport(s2, "outer");
 
-          if(innerMostDepth < iDepth){
-            innerMostDepth = iDepth;
-            innerMostLoop  = i;
+          for(size_t i = 0; i < innerLoops.size(); ++i){
+            tagLoop(*(innerLoops[i]), "inner");
+            addToReport(*(innerLoops[i]), "inner");
           }
         }
+        else {
+          tagLoop(s2, "tile(" + tileSize + ")");
+          addToReport(s2, "tile(" + tileSize + ")");
+        }
 
-        // Always setup tiled kernels
-        const int tileKernels = (int) testedTileSizes.size();
+        sn = sn->right;
+      }
+    }
 
-        for(int tk = 0; tk < tileKernels; ++tk){
-          outerLoopVec.push_back(o);
-          innerLoopVec.push_back(intVector_t());
-        }
+    std::string magician::reasonLoopIsSerial(statement &s){
+      if(!(db.smntInfoMap[&s] & analyzeInfo::isCanonical))
+        return "iterator, bounds or stride are not in canonical form";
 
-        if(innerMostLoop == 0)
-          continue;
+      std::string varName;
 
-        intVector_t orderVec;
+      if(loopCarriesDependency(s, varName))
+        return varName;
 
-        // Get the correct order
-        for(int i = innerMostLoop; o < i; --i){
-          int iDepth = depthVec[i];
+      if(loopSetsOuterScalar(s, s, varName))
+        return "[" + varName + "] is declared outside the loop and set inside it";
 
-          // Going down the loop path
-          if(innerMostDepth < iDepth)
-            continue;
-          else
-            innerMostDepth = (iDepth - 1);
+      if(loopExitsEarly(s))
+        return "loop can exit early";
 
-          orderVec.push_back(i);
-        }
+      return "";
+    }
 
-        const int innerLoopCount = orderVec.size();
+    //  Scalars declared outside [loop] would be shared by its iterations,
+    //    such as reduction variables
+    bool magician::loopSetsOuterScalar(statement &loop,
+                                       statement &s,
+                                       std::string &varName){
+      statementNode *sn = s.statementStart;
 
-        if(innerLoopCount == 0)
-          continue;
+      while(sn){
+        statement &s2 = *(sn->value);
+        sn = sn->right;
+
+        expNode &flatRoot = *(s2.expRoot.makeFlatHandle());
+
+        for(int i = 0; i < flatRoot.leafCount; ++i){
+          expNode &leaf = flatRoot[i];
+
+          const bool setsValue = (((leaf.info & expType::LR) &&
+                                   isAnAssOperator(leaf.value)) ||
+                                  ((leaf.info & expType::L_R) &&
+                                   ((leaf.value == "++") ||
+                                    (leaf.value == "--"))));
+
+          if(!setsValue         ||
+             (leaf.leafCount == 0) ||
+             !(leaf[0].info & expType::varInfo)){
 
-        for(int i_ = (innerLoopCount - 1); 0 <= i_; --i_){
-          int i = orderVec[i_];
+            continue;
+          }
 
-          storeInnerLoopCandidates(loopsVec,
-                                   depthVec,
-                                   o, i,
-                                   innerLoopVec.back());
+          varInfo &var = leaf[0].getVarInfo();
 
-          if(innerLoopVec.back().size()){
-            outerLoopVec.push_back(o);
-            innerLoopVec.push_back(intVector_t());
+          if(!variableIsDeclaredIn(loop, s2, var)){
+            varName = var.name;
+            expNode::freeFlatHandle(flatRoot);
+            return true;
           }
         }
+
+        expNode::freeFlatHandle(flatRoot);
+
+        if(loopSetsOuterScalar(loop, s2, varName))
+          return true;
       }
 
-      return generateKernelsAndLabelLoops(loopsVec,
-                                          depthVec,
-                                          outerLoopVec,
-                                          innerLoopVec);
+      return false;
     }
 
-    void magician::storeInnerLoopCandidates(statementVector_t &loopsVec,
-                                            intVector_t &depthVec,
-                                            int outerLoopIdx,
-                                            int innerLoopIdx,
-                                            intVector_t &innerLoopVec){
+    bool magician::loopExitsEarly(statement &s, const bool inNestedLoop){
+      statementNode *sn = s.statementStart;
 
-      iteratorInfo_t iteratorInfo = iteratorLoopBounds(*(loopsVec[innerLoopIdx]));
+      while(sn){
+        statement &s2 = *(sn->value);
 
-      bool foundLoops = nestedLoopHasSameBounds(loopsVec,
-                                                depthVec,
-                                                outerLoopIdx,
-                                                iteratorInfo,
-                                                innerLoopVec);
+        if((s2.info & smntType::gotoStatement) ||
+           (s2.expRoot.info & (expType::return_ | expType::goto_))){
 
-      if(!foundLoops)
-        innerLoopVec.clear();
-    }
+          return true;
+        }
 
-    void magician::storeNextDepthLoops(statementVector_t &loopsVec,
-                                       intVector_t &depthVec,
-                                       int loopIdx,
-                                       intVector_t &ndLoopsVec){
+        // [break] only leaves loops and switches nested in [s]
+        if(!inNestedLoop                        &&
+           (s2.expRoot.info & expType::transfer_) &&
+           (s2.expRoot.value == "break")){
 
-      const int loopCount = (int) loopsVec.size();
-      const int depth    = depthVec[loopIdx];
+          return true;
+        }
 
-      for(int i = (loopIdx + 1); i < loopCount; ++i){
-        int iDepth = depthVec[i];
+        const bool nestsBreaks = (s2.info & (smntType::forStatement   |
+                                             smntType::whileStatement |
+                                             smntType::switchStatement));
 
-        if(iDepth == depth)
-          break;
+        if(loopExitsEarly(s2, inNestedLoop || nestsBreaks))
+          return true;
 
-        if(iDepth == (depth + 1))
-          ndLoopsVec.push_back(i);
+        sn = sn->right;
       }
+
+      return false;
     }
 
-    bool magician::nestedLoopHasSameBounds(statementVector_t &loopsVec,
-                                           intVector_t &depthVec,
-                                           int ndLoopIdx,
-                                           iteratorInfo_t &iteratorInfo,
-                                           intVector_t &innerLoopVec,
-                                           const bool isFirstCall){
+    //  Conservative dependence test, pointer arguments are assumed to not
+    //    alias as in OKL kernels
+    //
+    //  Arrays written in [loop] are only accessed through one set of
+    //    indices, which use the loop iterator with a coefficient that
+    //    differs from the iterators of nested loops:
+    //
+    //    a[i][j], a[i*N + j]   -> parallel in [i]
+    //    a[i + 1] = a[i]       -> serial
+    bool magician::loopCarriesDependency(statement &loop, std::string &reason){
+      varInfo *iter = loopIterator(loop);
+
+      if(iter == NULL){
+        reason = "iterator was not found";
+        return true;
+      }
+
+      arrayAccessVector_t accesses;
+      std::vector<varInfo*> writtenVars, iterators;
+
+      if(!storeArrayAccesses(loop, accesses, writtenVars)){
+        reason = "writes through a pointer or member";
+        return true;
+      }
+
+      storeNestedIterators(loop, iterators);
+
+      for(size_t a = 0; a < accesses.size(); ++a){
+        arrayAccess_t &access = accesses[a];
+
+        if(!access.isWrite ||
+           variableIsDeclaredIn(loop, *(access.s), *(access.var))){
+
+          continue;
+        }
+
+        const std::string &name = access.var->name;
+        const std::string indexStr = access.indexStr();
+
+        for(size_t b = 0; b < accesses.size(); ++b){
+          if((accesses[b].var == access.var) &&
+             (accesses[b].indexStr() != indexStr)){
+
+            reason = "[" + name + "] is accessed with different indices";
+            return true;
+          }
+        }
+
+        bool isPrivate = false;
+
+        for(size_t d = 0; d < access.indices.size(); ++d){
+          expNode &index = *(access.indices[d]);
+
+          std::string coeff;
+
+          if(!indexIsAffine(index, *iter, iterators, writtenVars) ||
+             !linearCoefficient(index, *iter, coeff)){
+
+            reason = "[" + name + "] has indices that are not affine in the loop iterators";
+            return true;
+          }
+
+          if(coeff.size() == 0)
+            continue;
+
+          bool sharesCoeff = false;
+
+          for(size_t i = 0; i < iterators.size(); ++i){
+            std::string iCoeff;
 
-      statement &ndS = *(loopsVec[ndLoopIdx]);
+            if(!linearCoefficient(index, *(iterators[i]), iCoeff) ||
+               (iCoeff == coeff)){
 
-      iteratorInfo_t ndIteratorInfo = iteratorLoopBounds(ndS);
+              sharesCoeff = true;
+              break;
+            }
+          }
 
-      // First call doesn't return in the case that
-      //   the inner-loop has the same bounds as the
-      //   outer-loop
-      if(!isFirstCall){
-        if(ndIteratorInfo == iteratorInfo){
-          innerLoopVec.push_back(ndLoopIdx);
+          if(!sharesCoeff)
+            isPrivate = true;
+        }
+
+        if(!isPrivate){
+          reason = "[" + name + "] can be written by different iterations";
           return true;
         }
       }
 
-      intVector_t ndLoopsVec;
+      return false;
+    }
 
-      storeNextDepthLoops(loopsVec,
-                          depthVec,
-                          ndLoopIdx,
-                          ndLoopsVec);
+    // Returns false if something other than a variable or array entry is written
+    bool magician::storeArrayAccesses(statement &s,
+                                      arrayAccessVector_t &accesses,
+                                      std::vector<varInfo*> &writtenVars){
 
-      const int ndLoopCount = (int) ndLoopsVec.size();
-      int b;
+      statementNode *sn = s.statementStart;
 
-      for(b = 0; b < ndLoopCount; ++b){
-        if(!nestedLoopHasSameBounds(loopsVec,
-                                    depthVec,
-                                    ndLoopsVec[b],
-                                    iteratorInfo,
-                                    innerLoopVec,
-                                    false)){
-#if DBP6
-          std::cout << "loops have different bounds\n";
-#endif
-          break;
+      while(sn){
+        statement &s2 = *(sn->value);
+        sn = sn->right;
+
+        for(int i = 0; i < s2.expRoot.leafCount; ++i){
+          if(!storeArrayAccesses(s2, s2.expRoot[i],
+                                 true, false,
+                                 accesses, writtenVars)){
+            return false;
+          }
         }
-      }
 
-      if(b != ndLoopCount)
-        return false;
+        if(!storeArrayAccesses(s2, accesses, writtenVars))
+          return false;
+      }
 
       return true;
     }
 
-    statementNode* magician::generateKernelsAndLabelLoops(statementVector_t &loopsVec,
-                                                          intVector_t &depthVec,
-                                                          intVector_t &outerLoopVec,
-                                                          intVecVector_t &innerLoopVec){
-      const int kernelCount = outerLoopVec.size();
-      statementVector_t newKernelVec;
+    bool magician::storeArrayAccesses(statement &s,
+                                      expNode &e,
+                                      const bool isRead,
+                                      const bool isWrite,
+                                      arrayAccessVector_t &accesses,
+                                      std::vector<varInfo*> &writtenVars){
 
-      statement &kernel  = *(parserBase::getStatementKernel(*(loopsVec[0])));
-      varInfo &kernelVar = *(kernel.getFunctionVar());
-      statementNode *sn  = kernel.getStatementNode();
+      if(isAnArrayAccess(e)){
+        const int dims = arrayAccessDims(e);
 
-      if(kernelCount == 0)
-        return sn->right;
+        if(dims == 0){
+          if(isWrite)
+            return false;
 
-#if DBP6
-      std::cout << "Kernel: " << kernel.onlyThisToString() << '\n';
-#endif
+          for(int i = 0; i < e.leafCount; ++i){
+            if(!storeArrayAccesses(s, e[i], true, false, accesses, writtenVars))
+              return false;
+          }
 
-      statement &kGlobalScope = *(kernel.getGlobalScope());
+          return true;
+        }
 
-      std::string kernelName = kernel.getFunctionName();
-      kGlobalScope.createUniqueSequentialVariables(kernelName, kernelCount);
+        arrayAccess_t access;
+        access.var     = &(arrayAccessVariable(e).getVarInfo());
+        access.s       = &s;
+        access.isWrite = isWrite;
 
-      std::stringstream ss;
-      intVector_t path;
+        for(int d = 0; d < dims; ++d){
+          expNode &index = arrayAccessIndex(e, dims, d);
 
-      int tileTest = 0;
+          access.indices.push_back(&index);
 
-      for(int k = 0; k < kernelCount; ++k){
-        ss.str("");
-        ss << k;
-        kernel.setFunctionName(kernelName + ss.str());
+          if(!storeArrayAccesses(s, index, true, false, accesses, writtenVars))
+            return false;
+        }
 
-        sn = sn->push(kernel.clone());
-        statement &newKernel = *(sn->value);
-        newKernelVec.push_back(&newKernel);
+        accesses.push_back(access);
 
-        kernel.setFunctionName(kernelName);
+        return true;
+      }
 
-        const int o   = outerLoopVec[k];
-        statement &os = *(loopsVec[o]);
+      if(e.info & expType::varInfo){
+        if(isWrite)
+          writtenVars.push_back(&(e.getVarInfo()));
 
-        os.setIndexPath(path, &kernel);
-        statement &newOs = newKernel[path];
+        return true;
+      }
 
-        if(newOs.hasAttribute("occaTag") == NULL)
-          newOs.addAttribute("@(occaTag = outer, occaNest = 0)");
+      if((e.info & expType::LR) &&
+         isAnAssOperator(e.value) &&
+         (e.leafCount == 2)){
 
-        intVector_t &innerLoopsVec = innerLoopVec[k];
-        const int innerLoopCount  = innerLoopsVec.size();
+        return (storeArrayAccesses(s, e[0],
+                                   (e.value != "="), true,
+                                   accesses, writtenVars) &&
+                storeArrayAccesses(s, e[1],
+                                   true, false,
+                                   accesses, writtenVars));
+      }
 
-        if(innerLoopCount != 0){
-          tileTest = 0;
-        }
-        else {
-          newOs.removeAttribute("occaTag");
-          newOs.removeAttribute("occaNest");
+      if((e.info & expType::L_R) &&
+         ((e.value == "++") || (e.value == "--")) &&
+         (e.leafCount == 1)){
 
-          newOs.addAttribute("@(occaTag = tile("
-                             + toString(testedTileSizes[tileTest++])
-                             + "))");
+        return storeArrayAccesses(s, e[0],
+                                  true, true,
+                                  accesses, writtenVars);
+      }
 
-          continue;
-        }
+      // [*p = x], [p->x = y], ...
+      if(isWrite && (e.value != "("))
+        return false;
 
-#if DBP6
-        std::cout << "Outer Loop   : " << newOs.onlyThisToString() << '\n';
-        std::cout << "Inner Loop(s):\n";
-#endif
+      for(int i = 0; i < e.leafCount; ++i){
+        if(!storeArrayAccesses(s, e[i], isRead, isWrite, accesses, writtenVars))
+          return false;
+      }
 
-        for(int i_ = 0; i_ < innerLoopCount; ++i_){
-          const int i   = innerLoopsVec[i_];
-          statement &is = *(loopsVec[i]);
+      return true;
+    }
 
-          is.setIndexPath(path, &kernel);
-          statement &newIs = newKernel[path];
+    void magician::storeNestedIterators(statement &s,
+                                        std::vector<varInfo*> &iterators){
+      statementNode *sn = s.statementStart;
 
-          attribute_t *occaTagAttr = newIs.hasAttribute("occaTag");
+      while(sn){
+        statement &s2 = *(sn->value);
+        sn = sn->right;
 
-          if(occaTagAttr == NULL)
-            newIs.addAttribute("@(occaTag = inner, occaNest = 0)");
+        if(s2.info == smntType::forStatement){
+          varInfo *iter = loopIterator(s2);
 
-#if DBP6
-          std::cout << "  " << i << ": " << newIs.onlyThisToString() << '\n';
-#endif
+          if(iter)
+            iterators.push_back(iter);
         }
-#if DBP6
-        std::cout << '\n';
-#endif
+
+        storeNestedIterators(s2, iterators);
       }
+    }
+
+    // Looks for [var]'s declaration between [s] and [loop]
+    bool magician::variableIsDeclaredIn(statement &loop,
+                                        statement &s,
+                                        varInfo &var){
+      statement *sUp = &s;
 
-      statementNode *retSn = sn->right;
+      while(sUp){
+        if(sUp->hasVariableInLocalScope(var.name) == &var)
+          return true;
+
+        if(sUp == &loop)
+          break;
 
-      sn = kernel.statementStart;
+        sUp = sUp->up;
+      }
 
-      while(sn)
-        popAndGoRight(sn);
+      return false;
+    }
 
-      kernel.statementStart = NULL;
-      kernel.statementEnd   = NULL;
+    //  Inner loops must be the only statements in the outer loop,
+    //    be parallel, not depend on the outer iterator and share bounds
+    bool magician::storeInnerLoops(statement &outerLoop,
+                                   statementVector_t &innerLoops){
 
-      std::string syncArgsStr, kernelArgs;
+      varInfo *outerIter = loopIterator(outerLoop);
 
-      for(int i = 0; i < kernelVar.argumentCount; ++i){
-        varInfo &argVar = kernelVar.getArgument(i);
+      if(outerIter == NULL)
+        return false;
 
-        if(0 < argVar.pointerCount){
-          ss.str("");
-          ss << "occa::setupMagicFor(" << argVar.name << ");";
-          kernel.addStatementFromSource(ss.str());
+      iteratorInfo_t innerBounds;
+      statementNode *sn = outerLoop.statementStart;
 
-          ss.str("");
-          ss << "occa::syncToDevice(" << argVar.name << ");";
-          syncArgsStr += ss.str();
+      while(sn){
+        statement &s = *(sn->value);
+        sn = sn->right;
+
+        if(s.info & smntType::blankStatement)
+          continue;
+
+        if((s.info != smntType::forStatement) ||
+           reasonLoopIsSerial(s).size()       ||
+           statementUsesVariable(s, *outerIter)){
+
+          innerLoops.clear();
+          return false;
         }
-      }
 
-      ss.str("");
+        iteratorInfo_t bounds = iteratorLoopBounds(s);
 
-      ss << '(';
+        if(innerLoops.size() && (bounds != innerBounds)){
+          innerLoops.clear();
+          return false;
+        }
 
-      for(int i = 0; i < kernelVar.argumentCount; ++i){
-        if(i) ss << ',';
-        ss << kernelVar.getArgument(i).name;
+        innerBounds = bounds;
+        innerLoops.push_back(&s);
       }
 
-      ss << ");";
+      return (0 < innerLoops.size());
+    }
 
-      kernelArgs = ss.str();
+    varInfo* magician::loopIterator(statement &s){
+      varInfo *iter = NULL;
 
-      for(int k = 0; k < kernelCount; ++k){
-        ss.str("");
-        ss << k;
+      expNode &flatRoot = *(s.expRoot[2].makeFlatHandle());
 
-        std::string kStr = ss.str();
+      for(int i = 0; i < flatRoot.leafCount; ++i){
+        expNode &leaf = flatRoot[i];
 
-        kernel.addStatementFromSource(kernelName + kStr + kernelArgs);
+        if((leaf.info & expType::varInfo) &&
+           db.varIsAnIterator(leaf.getVarInfo())){
 
-        if(k < (kernelCount - 1))
-          kernel.addStatementsFromSource(syncArgsStr);
+          iter = &(leaf.getVarInfo());
+          break;
+        }
       }
 
-      return retSn;
+      expNode::freeFlatHandle(flatRoot);
+
+      return iter;
     }
 
-    void magician::storeLoopsAndDepths(statement &s,
-                                       statementVector_t &loopsVec,
-                                       intVector_t &depthVec, int depth){
+    // Only checks the loop's initialization and bounds
+    bool magician::statementUsesVariable(statement &s, varInfo &var){
+      for(int e = 0; e < 2; ++e){
+        expNode &flatRoot = *(s.expRoot[e].makeFlatHandle());
+        bool usesVar = false;
 
-      statementNode *sn = s.statementStart;
+        for(int i = 0; i < flatRoot.leafCount; ++i){
+          expNode &leaf = flatRoot[i];
 
-      while(sn){
-        statement &s2 = *(sn->value);
+          if((leaf.info & expType::varInfo) &&
+             (&(leaf.getVarInfo()) == &var)){
 
-        if(s2.info == smntType::forStatement){
-          loopsVec.push_back(&s2);
-          depthVec.push_back(depth);
-          storeLoopsAndDepths(s2, loopsVec, depthVec, depth + 1);
+            usesVar = true;
+            break;
+          }
         }
-        else
-          storeLoopsAndDepths(s2, loopsVec, depthVec, depth);
 
-        sn = sn->right;
+        expNode::freeFlatHandle(flatRoot);
+
+        if(usesVar)
+          return true;
       }
+
+      return false;
+    }
+
+    void magician::tagLoop(statement &s, const std::string &tag){
+      s.addAttribute("@(" + tag + ")");
+      s.updateInitialLoopAttributes();
+    }
+
+    void magician::addToReport(statement &s, const std::string &message){
+      std::string loop = s.onlyThisToString();
+
+      // Drop the trailing [{]
+      const size_t brace = loop.find('{');
+
+      if(brace != std::string::npos)
+        loop = loop.substr(0, brace);
+
+      report << "[Magic] " << kernelName << ": " << loop
+             << " -> " << message << '\n';
     }
 
     iteratorInfo_t magician::iteratorLoopBounds(statement &s){
@@ -2481,82 +2826,67 @@ namespace occa {
       const bool isUpdated = (isAnUpdateOperator(opNode.value) &&
                               (opNode.value != "="));
 
-      // [-] Fix
-      if(varNode.info & expType::variable){
-        const int brackets = varNode.getVariableBracketCount();
-
-        if(brackets)
-          addVariableWrite(varNode, opNode, setNode,
-                           brackets, *(varNode.getVariableBracket(0)->up));
+      const int brackets = arrayAccessDims(varNode);
 
+      if(brackets){
+        addVariableWrite(varNode, opNode, setNode,
+                         brackets, varNode);
         return;
       }
 
+      // Writes through pointers or members are checked when labeling loops
+      if(!(varNode.info & expType::varInfo))
+        return;
+
       if(isUpdated)
         addVariableRead(varNode);
 
-      viInfo_t &viInfo = db[ varNode.getVarInfo() ];
+      viInfo_t &viInfo = getViInfo(varNode.getVarInfo());
 
       viInfo.addWrite(isUpdated, varNode);
       viInfo.updateValue(opNode, setNode);
     }
 
-    // [-] Fix
+    //  Array entries are checked when labeling loops (loopCarriesDependency),
+    //    only their indices are read here
     void magician::addVariableWrite(expNode &varNode,
                                     expNode &opNode,
                                     expNode &setNode,
                                     const int brackets,
                                     expNode &bracketNode){
 
-      const bool isUpdated = (isAnUpdateOperator(opNode.value) &&
-                              (opNode.value != "="));
-
-      if(isUpdated)
-        addVariableRead(varNode, brackets, bracketNode);
-
-      viInfo_t &viInfo = db[ varNode[0].getVarInfo() ];
-
-      viInfo.addWrite(isUpdated, brackets, bracketNode);
+      for(int i = 0; i < brackets; ++i)
+        addExpressionRead(arrayAccessIndex(bracketNode, brackets, i));
     }
 
     void magician::addVariableRead(expNode &varNode){
-      // [-] Fix
-      if(varNode.info & expType::variable){
-        const int brackets = varNode.getVariableBracketCount();
-
-        if(brackets)
-          addVariableRead(varNode, brackets, *(varNode.getVariableBracket(0)->up));
+      const int brackets = arrayAccessDims(varNode);
 
+      if(brackets){
+        addVariableRead(varNode, brackets, varNode);
         return;
       }
 
-      viInfo_t &viInfo = db[ varNode.getVarInfo() ];
+      viInfo_t &viInfo = getViInfo(varNode.getVarInfo());
 
       viInfo.addRead(varNode);
     }
 
-    // [-] Fix
     void magician::addVariableRead(expNode &varNode,
                                    const int brackets,
                                    expNode &bracketNode){
 
-      viInfo_t &viInfo = db[ varNode[0].getVarInfo() ];
-
-      viInfo.addRead(brackets, bracketNode);
+      for(int i = 0; i < brackets; ++i)
+        addExpressionRead(arrayAccessIndex(bracketNode, brackets, i));
     }
 
     void magician::addExpressionRead(expNode &e){
-      // [-] Fix
-      if(e.info & expType::variable){
-        const int brackets = e.getVariableBracketCount();
+      const int brackets = arrayAccessDims(e);
 
-        if(brackets)
-          addVariableRead(e, brackets, *(e.getVariableBracket(0)->up));
+      if(brackets){
+        addVariableRead(e, brackets, e);
       }
-      else if((e.info & expType::varInfo) &&
-              ((e.up == NULL) ||
-               !(e.up->info & expType::variable))){
-
+      else if(e.info & expType::varInfo){
         addVariableRead(e);
       }
       else {
@@ -2565,6 +2895,14 @@ namespace occa {
       }
     }
 
+    // Variables declared outside the kernel are added on their first use
+    viInfo_t& magician::getViInfo(varInfo &var){
+      if(db.has(var) == NULL)
+        db.add(var);
+
+      return db[var];
+    }
+
     //---[ Helper Functions ]---------
     void magician::placeAddedExps(infoDB_t &db, expNode &e, expVector_t &addedExps){
       placeExps(db, e, addedExps, "+-");
@@ -80,20 +80,24 @@ namespace occa {
       // std::cout << (std::string) *globalScope;
       // throw 1;
 
+      // .oak and .oaf kernels get their outer/inner loops from analysis
+      if (hasMagicEnabled())
+        magician::castMagicOn(*this);
+
+      specializeKernelArguments();
+
+      fuseKernels();
+
       reorderLoops();
       retagOccaLoops();
 
+      estimateKernelCosts();
+
       applyToAllStatements(*globalScope, &parserBase::splitTileOccaFors);
 
       markKernelFunctions();
       labelNativeKernels();
 
-      if (hasMagicEnabled()) {
-        magician::castMagicOn(*this);
-        std::cout << (std::string) *globalScope;
-        throw 1;
-      }
-
       applyToAllStatements(*globalScope, &parserBase::setupCudaVariables);
       applyToAllStatements(*globalScope, &parserBase::setupOccaVariables);
 
@@ -841,20 +845,26 @@ namespace occa {
       cPodTypes["float"]  = 0;
       cPodTypes["double"] = 0;
 
-      int parts[6]            = {1, 2, 3, 4, 8, 16};
-      std::string suffix[6]   = {"", "2", "3", "4", "8", "16"};
-      std::string baseType[8] = {"void",
-                                 "int"  ,
-                                 "bool" ,
-                                 "char" ,
-                                 "long" ,
-                                 "short",
-                                 "float",
-                                 "double"};
+      int parts[6]             = {1, 2, 3, 4, 8, 16};
+      std::string suffix[6]    = {"", "2", "3", "4", "8", "16"};
+      std::string baseType[10] = {"void",
+                                  "int"  ,
+                                  "bool" ,
+                                  "char" ,
+                                  "long" ,
+                                  "short",
+                                  "float",
+                                  "double",
+                                  "half",
+                                  "bfloat16"};
 
       std::stringstream ss;
 
-      for (int t = 0; t < 8; ++t) {
+      for (int t = 0; t < 10; ++t) {
+        // bfloat164 would be ambiguous, use bfloat16x4
+        const std::string vectorName = (baseType[t] +
+                                        ((baseType[t] == "bfloat16") ? "x" : ""));
+
         for (int n = 0; n < 6; ++n) {
           typeInfo &type = *(new typeInfo);
 
@@ -865,7 +875,7 @@ namespace occa {
             globalScope->addType(type);
           }
           else{
-            ss << "struct " << baseType[t] << parts[n] << " {\n";
+            ss << "struct " << vectorName << parts[n] << " {\n";
 
             for (int n2 = 0; n2 < parts[n]; ++n2) {
               const char varLetter = ('w' + ((n2 + 1) % 4));
@@ -2373,12 +2383,15 @@ namespace occa {
               varInfo &varg = *(kernel.argumentVarInfos[arg]);
 
               argumentInfo argInfo;
+              argInfo.name    = varg.name;
               argInfo.isConst = varg.isConst();
 
               info.argumentInfos.push_back(argInfo);
             }
           }
 
+          info.cost = kernelCostMap[info.name];
+
           kernelInfoMap[info.name] = &info;
           //============================
 
@@ -2648,13 +2661,84 @@ namespace occa {
         //   outer-most-loop <--> host kernel
         statement::swapPlaces(omLoop, sLaunch);
 
+        // occaParallelFor<N> collapses N + 1 outer loops on CPU modes
+        const int outerLoops = (_compilingForCPU                  ?
+                                perfectlyNestOuterLoops(omLoop) :
+                                1);
+
         newSKernel.pushSourceLeftOf(omLoop.getStatementNode(),
-                                    "occaParallelFor0");
+                                    "occaParallelFor" + occa::toString(outerLoops - 1));
       }
 
       return newKernels;
     }
 
+    // Declarations between nested outer loops (such as their iterators)
+    //   are moved into the inner-most one so the loops can be collapsed,
+    //   nests with other statements between outer loops are left as is
+    int parserBase::perfectlyNestOuterLoops(statement &omLoop) {
+      statement *sOuter = &omLoop;
+      int outerLoops    = 1;
+
+      while (true) {
+        statement *sNextOuter = NULL;
+        statementVector_t declarations;
+
+        statementNode *snPos = sOuter->statementStart;
+
+        while (snPos) {
+          statement &s = *(snPos->value);
+
+          if (statementIsOccaOuterFor(s) && (sNextOuter == NULL))
+            sNextOuter = &s;
+          else if ((s.info & smntType::declareStatement) && (sNextOuter == NULL))
+            declarations.push_back(&s);
+          else
+            return outerLoops;
+
+          snPos = snPos->right;
+        }
+
+        if ((sNextOuter == NULL) ||
+            (sNextOuter->statementStart == NULL)) {
+
+          return outerLoops;
+        }
+
+        // Moved declarations can't shadow the inner loop's variables
+        for (size_t i = 0; i < declarations.size(); ++i) {
+          statement &sDecl = *(declarations[i]);
+          const int varCount = sDecl.getDeclarationVarCount();
+
+          for (int v = 0; v < varCount; ++v) {
+            if (sNextOuter->hasVariableInLocalScope(sDecl.getDeclarationVarInfo(v).name))
+              return outerLoops;
+          }
+        }
+
+        statement *sFirst = sNextOuter->statementStart->value;
+
+        for (size_t i = 0; i < declarations.size(); ++i) {
+          statement &sDecl = *(declarations[i]);
+
+          sOuter->removeStatement(sDecl);
+          sNextOuter->pushLeftOf(sFirst, &sDecl);
+
+          const int varCount = sDecl.getDeclarationVarCount();
+
+          for (int v = 0; v < varCount; ++v) {
+            varInfo &var = sDecl.getDeclarationVarInfo(v);
+
+            sOuter->scope->removeLocalVariable(var);
+            sNextOuter->scope->add(var);
+          }
+        }
+
+        sOuter = sNextOuter;
+        ++outerLoops;
+      }
+    }
+
     void parserBase::addDepStatementsToKernel(statement &sKernel,
                                               varOriginMap_t &deps) {
 
@@ -2831,6 +2915,7 @@ namespace occa {
         argumentInfo argInfo;
         varInfo &arg = kernelVar.getArgument(i);
 
+        argInfo.name    = arg.name;
         argInfo.pos     = i;
         argInfo.isConst = (arg.hasQualifier("occaConst") ||
                            arg.hasQualifier("occaConstant"));
@@ -2875,6 +2960,1227 @@ namespace occa {
       sKernel.addFunctionArg(1, nestedKernelsArg);
     }
 
+    //---[ Cost Estimation ]------------
+    static std::string costTypeName(varInfo &var) {
+      if (var.baseType == NULL)
+        return "";
+
+      return var.baseType->name;
+    }
+
+    // float4 -> (float, 4), bfloat16x4 -> (bfloat16, 4)
+    static std::string costBaseTypeName(const std::string &typeName,
+                                        int &width) {
+      if (typeName.find("bfloat16") == 0) {
+        width = ((8 < typeName.size())              ?
+                 ::atoi(typeName.substr(9).c_str()) :
+                 1);
+
+        return "bfloat16";
+      }
+
+      const int chars = (int) typeName.size();
+      int pos = chars;
+
+      while((0 < pos) &&
+            ('0' <= typeName[pos - 1]) && (typeName[pos - 1] <= '9')) {
+        --pos;
+      }
+
+      width = ((pos < chars)                            ?
+               ::atoi(typeName.substr(pos).c_str()) :
+               1);
+
+      return typeName.substr(0, pos);
+    }
+
+    static int costFloatWidthOf(const std::string &typeName) {
+      int width;
+      const std::string baseName = costBaseTypeName(typeName, width);
+
+      if ((baseName == "float")  ||
+         (baseName == "double") ||
+         (baseName == "half")   ||
+         (baseName == "bfloat16")) {
+
+        return width;
+      }
+
+      return 0;
+    }
+
+    static int costBytesOf(const std::string &typeName) {
+      int width;
+      const std::string baseName = costBaseTypeName(typeName, width);
+
+      if ((baseName == "char") || (baseName == "bool"))
+        return width;
+      if ((baseName == "short") || (baseName == "half") || (baseName == "bfloat16"))
+        return 2*width;
+      if ((baseName == "int") || (baseName == "float"))
+        return 4*width;
+      if ((baseName == "long") || (baseName == "double"))
+        return 8*width;
+
+      return 0;
+    }
+
+    static bool costIsMathFunction(const std::string &name_) {
+      std::string name = name_;
+
+      if (name.find("occaFast") == 0)
+        name = name.substr(8);
+      else if (name.find("occaNative") == 0)
+        name = name.substr(10);
+      else if (name.find("occa") == 0)
+        name = name.substr(4);
+
+      if (name.size() == 0)
+        return false;
+
+      if (('A' <= name[0]) && (name[0] <= 'Z'))
+        name[0] += ('a' - 'A');
+
+      static const char *mathFunctions[] = {
+        "sqrt", "rsqrt", "cbrt", "hypot", "fabs", "fma", "min", "max",
+        "sin", "asin", "sinh", "asinh", "cos", "acos", "cosh", "acosh",
+        "tan", "atan", "tanh", "atanh", "exp", "exp2", "exp10", "expm1",
+        "log", "log2", "log10", "log1p", "pow", "floor", "ceil", NULL
+      };
+
+      for (int i = 0; mathFunctions[i] != NULL; ++i) {
+        if (name == mathFunctions[i])
+          return true;
+      }
+
+      return false;
+    }
+
+    static bool costIsFloatLiteral(const std::string &value) {
+      if ((1 < value.size()) &&
+         (value[0] == '0')   &&
+         ((value[1] == 'x') || (value[1] == 'X'))) {
+
+        return false;
+      }
+
+      return (value.find_first_of(".eE") != std::string::npos);
+    }
+
+    static bool costIsComparison(const std::string &op) {
+      return ((op == "<")  || (op == "<=") ||
+              (op == ">")  || (op == ">=") ||
+              (op == "==") || (op == "!=") ||
+              (op == "&&") || (op == "||") ||
+              (op == "!"));
+    }
+
+    static bool costIsAssignment(const std::string &op) {
+      return ((op == "=")  ||
+              (op == "+=") || (op == "-=") ||
+              (op == "*=") || (op == "/="));
+    }
+
+    static varInfo* costKernelArgument(varInfo &kernelVar,
+                                       const std::string &name) {
+      for (int i = 0; i < kernelVar.argumentCount; ++i) {
+        varInfo &arg = *(kernelVar.argumentVarInfos[i]);
+
+        if (arg.name == name)
+          return &arg;
+      }
+
+      return NULL;
+    }
+
+    // Returns the argument if [e] is a global memory array
+    static varInfo* costGlobalArray(expNode &e,
+                                    varInfo &kernelVar) {
+      if (((e.info & expType::varInfo) == 0) ||
+         (e.info & expType::type)) {
+
+        return NULL;
+      }
+
+      varInfo *arg = costKernelArgument(kernelVar,
+                                        e.getVarInfo().name);
+
+      if ((arg == NULL) || (arg->pointerCount == 0))
+        return NULL;
+
+      return arg;
+    }
+
+    static int costFloatWidth(expNode &e) {
+      if (e.info & expType::varInfo)
+        return costFloatWidthOf(costTypeName(e.getVarInfo()));
+
+      if (e.info & expType::presetValue)
+        return (costIsFloatLiteral(e.value) ? 1 : 0);
+
+      if (e.info & expType::hasInfo)
+        return 0;
+
+      if ((e.info & expType::LR) && (e.value == "["))
+        return ((0 < e.leafCount) ? costFloatWidth(e[0]) : 0);
+
+      if ((e.info & expType::operator_) && costIsComparison(e.value))
+        return 0;
+
+      int width = 0;
+
+      for (int i = 0; i < e.leafCount; ++i) {
+        const int leafWidth = costFloatWidth(e[i]);
+
+        if (width < leafWidth)
+          width = leafWidth;
+      }
+
+      return width;
+    }
+
+    // Bounds can only use integer kernel arguments to be evaluated at launch
+    static bool costIsSymbolic(expNode &e,
+                               varInfo &kernelVar) {
+      if (e.info & expType::varInfo) {
+        if (e.info & expType::type)
+          return false;
+
+        varInfo *arg = costKernelArgument(kernelVar,
+                                          e.getVarInfo().name);
+
+        return ((arg != NULL)            &&
+                (arg->pointerCount == 0) &&
+                (costFloatWidthOf(costTypeName(*arg)) == 0) &&
+                (0 < costBytesOf(costTypeName(*arg))));
+      }
+
+      if (e.info & expType::presetValue)
+        return true;
+
+      if ((e.info != expType::root) &&
+         (((e.info & expType::operator_) == 0) ||
+          (e.info & expType::cast_)            ||
+          (e.value == "["))) {
+
+        return false;
+      }
+
+      for (int i = 0; i < e.leafCount; ++i) {
+        if (!costIsSymbolic(e[i], kernelVar))
+          return false;
+      }
+
+      return true;
+    }
+
+    void parserBase::estimateKernelCosts() {
+      statementNode *snPos = globalScope->statementStart;
+
+      while(snPos) {
+        statement &s = *(snPos->value);
+
+        if ((s.info & smntType::functionDefinition) &&
+           (statementIsAKernel(s) || statementHasOccaStuff(s))) {
+
+          varInfo &kernelVar   = *(s.getFunctionVar());
+          kernelCostInfo &cost = kernelCostMap[kernelVar.name];
+
+          int counts[3] = {0, 0, 0};
+
+          estimateCostsFor(s, kernelVar, "1", cost, counts);
+
+          cost.addTerm("1", counts[0], counts[1], counts[2]);
+        }
+
+        snPos = snPos->right;
+      }
+    }
+
+    void parserBase::estimateCostsFor(statement &s,
+                                      varInfo &kernelVar,
+                                      const std::string &iterations,
+                                      kernelCostInfo &cost,
+                                      int *counts) {
+
+      statementNode *snPos = s.statementStart;
+
+      while(snPos) {
+        statement &s2 = *(snPos->value);
+
+        if (s2.info & smntType::forStatement) {
+          const std::string loopIterations = getLoopIterations(s2, kernelVar);
+
+          if (loopIterations == "1")
+            cost.isExact = false;
+
+          std::string nestedIterations = iterations;
+
+          if (iterations == "1")
+            nestedIterations = loopIterations;
+          else if (loopIterations != "1")
+            nestedIterations = iterations + " * " + loopIterations;
+
+          int loopCounts[3] = {0, 0, 0};
+
+          estimateCostsFor(s2, kernelVar, nestedIterations, cost, loopCounts);
+
+          cost.addTerm(nestedIterations,
+                       loopCounts[0], loopCounts[1], loopCounts[2]);
+        }
+        else {
+          if (s2.info & (smntType::simpleStatement |
+                         smntType::flowStatement)) {
+
+            estimateExpCosts(s2.expRoot, kernelVar, counts);
+          }
+
+          // Unknown trip counts are counted as one iteration
+          if (s2.info & smntType::whileStatement)
+            cost.isExact = false;
+
+          estimateCostsFor(s2, kernelVar, iterations, cost, counts);
+        }
+
+        snPos = snPos->right;
+      }
+    }
+
+    std::string parserBase::getLoopIterations(statement &s,
+                                              varInfo &kernelVar) {
+
+      if (s.getForStatementCount() < 3)
+        return "1";
+
+      expNode &node1 = *(s.getForStatement(0));
+      expNode &node2 = *(s.getForStatement(1));
+      expNode &node3 = *(s.getForStatement(2));
+
+      //---[ Iterator ]-------------------
+      const bool isDeclared = (node1.info & expType::declaration);
+
+      const int varsInInit = (isDeclared                  ?
+                              node1.getVariableCount()    :
+                              node1.getUpdatedVariableCount());
+
+      if (varsInInit != 1)
+        return "1";
+
+      expNode *iterNode  = (isDeclared                       ?
+                            node1.getVariableInfoNode(0)     :
+                            node1.getUpdatedVariableInfoNode(0));
+      expNode *startNode = (isDeclared                       ?
+                            node1.getVariableInitNode(0)     :
+                            node1.getUpdatedVariableSetNode(0));
+
+      if ((iterNode == NULL)  ||
+         (startNode == NULL) ||
+         ((iterNode->info & expType::varInfo) == 0)) {
+
+        return "1";
+      }
+
+      const std::string iter = iterNode->getVarInfo().name;
+
+      //---[ Bound ]----------------------
+      if ((node2.leafCount == 0) ||
+         ((node2[0].info & expType::LR) == 0) ||
+         (node2[0].leafCount != 2)) {
+
+        return "1";
+      }
+
+      expNode &checkNode = node2[0];
+      std::string check  = checkNode.value;
+      expNode *boundNode;
+
+      if ((checkNode[0].info & expType::varInfo) &&
+         (checkNode[0].getVarInfo().name == iter)) {
+
+        boundNode = &(checkNode[1]);
+      }
+      else if ((checkNode[1].info & expType::varInfo) &&
+              (checkNode[1].getVarInfo().name == iter)) {
+
+        boundNode = &(checkNode[0]);
+
+        // 0 < i -> i > 0
+        if (check[0] == '<')
+          check[0] = '>';
+        else if (check[0] == '>')
+          check[0] = '<';
+      }
+      else
+        return "1";
+
+      if ((check != "<")  && (check != "<=") &&
+         (check != ">")  && (check != ">=")) {
+
+        return "1";
+      }
+
+      //---[ Stride ]---------------------
+      if (node3.leafCount == 0)
+        return "1";
+
+      expNode &updateNode = node3[0];
+      const std::string &update = updateNode.value;
+
+      std::string stride;
+      bool isIncrementing;
+
+      if ((update == "++") || (update == "--")) {
+        stride         = "1";
+        isIncrementing = (update == "++");
+      }
+      else if (((update == "+=") || (update == "-=")) &&
+              (updateNode.leafCount == 2)            &&
+              (updateNode[0].info & expType::varInfo) &&
+              (updateNode[0].getVarInfo().name == iter)) {
+
+        if (!costIsSymbolic(updateNode[1], kernelVar))
+          return "1";
+
+        stride         = (std::string) updateNode[1];
+        isIncrementing = (update == "+=");
+      }
+      else
+        return "1";
+
+      if (isIncrementing != (check[0] == '<'))
+        return "1";
+
+      if (!costIsSymbolic(*startNode, kernelVar) ||
+         !costIsSymbolic(*boundNode, kernelVar)) {
+
+        return "1";
+      }
+
+      //---[ Iterations ]-----------------
+      const std::string start = (std::string) *startNode;
+      const std::string bound = (std::string) *boundNode;
+
+      std::string range = (isIncrementing                               ?
+                           ("(" + bound + ") - (" + start + ")") :
+                           ("(" + start + ") - (" + bound + ")"));
+
+      if (check.size() == 2)
+        range += " + 1";
+
+      if (stride == "1")
+        return "(" + range + ")";
+
+      return "((" + range + " + (" + stride + ") - 1) / (" + stride + "))";
+    }
+
+    void parserBase::estimateExpCosts(expNode &e,
+                                      varInfo &kernelVar,
+                                      int *counts) {
+      // Leaves hold varInfo/typeInfo pointers
+      if (e.info & expType::hasInfo)
+        return;
+
+      if ((e.info & expType::LR) &&
+         costIsAssignment(e.value) &&
+         (e.leafCount == 2)) {
+
+        expNode &setNode   = e[0];
+        const bool updates = (e.value != "=");
+
+        if (updates) {
+          const int width = costFloatWidth(setNode);
+
+          if (width)
+            counts[0] += width;
+        }
+
+        if ((setNode.info & expType::LR) &&
+           (setNode.value == "[")       &&
+           (setNode.leafCount == 2)) {
+
+          varInfo *arg = costGlobalArray(setNode[0], kernelVar);
+
+          if (arg != NULL) {
+            const int bytes = costBytesOf(costTypeName(*arg));
+
+            counts[2] += bytes;
+
+            if (updates)
+              counts[1] += bytes;
+          }
+
+          estimateExpCosts(setNode[1], kernelVar, counts);
+        }
+        else
+          estimateExpCosts(setNode, kernelVar, counts);
+
+        estimateExpCosts(e[1], kernelVar, counts);
+        return;
+      }
+
+      if ((e.info & expType::LR) &&
+         (e.value == "[")       &&
+         (e.leafCount == 2)) {
+
+        varInfo *arg = costGlobalArray(e[0], kernelVar);
+
+        if (arg != NULL)
+          counts[1] += costBytesOf(costTypeName(*arg));
+      }
+      else if ((e.info & expType::LR) &&
+              ((e.value == "+") || (e.value == "-") ||
+               (e.value == "*") || (e.value == "/"))) {
+
+        counts[0] += costFloatWidth(e);
+      }
+      else if ((e.info & (expType::unknown    |
+                          expType::function   |
+                          expType::printValue)) &&
+              costIsMathFunction(e.value)) {
+
+        counts[0] += 1;
+      }
+
+      for (int i = 0; i < e.leafCount; ++i)
+        estimateExpCosts(e[i], kernelVar, counts);
+    }
+    //==================================
+
+    //---[ Argument Specialization ]----
+    //  Parser flags [specialize:<arg>] = <value> replace uses of <arg>
+    //    in the [specialize-kernel] kernel with the constant <value>
+    void parserBase::specializeKernelArguments() {
+      if (!parsingFlags.has("specialize-kernel"))
+        return;
+
+      const std::string kernelName = parsingFlags["specialize-kernel"];
+      const std::string prefix     = "specialize:";
+
+      statementNode *snPos = globalScope->statementStart;
+
+      while(snPos) {
+        statement &s = *(snPos->value);
+
+        if ((s.info & smntType::functionDefinition) &&
+           (s.getFunctionName() == kernelName)) {
+
+          varInfo &kernelVar = *(s.getFunctionVar());
+          varToStrMap_t argValues;
+
+          cStrToStrMapIterator it = parsingFlags.flags.begin();
+
+          while(it != parsingFlags.flags.end()) {
+            if (it->first.find(prefix) == 0) {
+              const std::string argName = it->first.substr(prefix.size());
+
+              varInfo *arg = costKernelArgument(kernelVar, argName);
+
+              OCCA_CHECK(arg != NULL,
+                         "Kernel [" << kernelName << "] has no argument [" << argName << "] to specialize");
+
+              OCCA_CHECK(arg->pointerCount == 0,
+                         "Only scalar arguments can be specialized, [" << argName << "] is a pointer");
+
+              argValues[arg] = it->second;
+            }
+
+            ++it;
+          }
+
+          specializeArgumentsIn(s, argValues);
+        }
+
+        snPos = snPos->right;
+      }
+    }
+
+    void parserBase::specializeArgumentsIn(statement &s,
+                                           varToStrMap_t &argValues) {
+
+      statementNode *snPos = s.statementStart;
+
+      while(snPos) {
+        statement &s2 = *(snPos->value);
+
+        expNode &flatRoot = *(s2.expRoot.makeDumbFlatHandle());
+
+        for (int i = 0; i < flatRoot.leafCount; ++i) {
+          expNode &leaf = flatRoot[i];
+
+          if ((leaf.info & expType::varInfo) == 0)
+            continue;
+
+          varToStrMapIterator it = argValues.find(&(leaf.getVarInfo()));
+
+          if (it != argValues.end()) {
+            // Drops the varInfo pointer stored as the leaf
+            leaf.freeThis();
+
+            leaf.info  = expType::presetValue;
+            leaf.value = it->second;
+          }
+        }
+
+        expNode::freeFlatHandle(flatRoot);
+
+        specializeArgumentsIn(s2, argValues);
+
+        snPos = snPos->right;
+      }
+    }
+    //==================================
+
+    //---[ Kernel Fusion ]--------------
+    fusionKernel_t::fusionKernel_t() :
+      sKernel(NULL) {}
+
+    fusionAccess_t::fusionAccess_t() :
+      isWritten(false) {}
+
+    //  Parser flags set by occa::kernelSequence:
+    //
+    //    fuse-kernel : Name of the fused kernel
+    //    fuse-count  : Number of kernels in the sequence
+    //    fuse:<k>    : "<kernel name> <fused argument position> ..."
+    //
+    //  Consecutive kernels with the same loop nest whose shared arrays
+    //    are only accessed at the same index are merged into one nest.
+    //    Other kernels keep their own outer loops, which become separate
+    //    nested kernels when the fused kernel is split
+    void parserBase::fuseKernels() {
+      if (!parsingFlags.has("fuse-kernel"))
+        return;
+
+      const std::string fusedName = parsingFlags["fuse-kernel"];
+      const int kernelCount       = ::atoi(parsingFlags["fuse-count"].c_str());
+
+      std::vector<fusionKernel_t> kernels(kernelCount);
+      int argCount = 0;
+
+      for (int k = 0; k < kernelCount; ++k) {
+        loadFusionKernel(kernels[k], parsingFlags["fuse:" + occa::toString(k)]);
+
+        for (size_t a = 0; a < kernels[k].argPos.size(); ++a)
+          argCount = std::max(argCount, kernels[k].argPos[a] + 1);
+      }
+
+      //---[ Fused Arguments ]----------
+      std::vector<varInfo*> fusedArgs(argCount, (varInfo*) NULL);
+      std::vector<bool> argIsConst(argCount, true);
+
+      for (int k = 0; k < kernelCount; ++k) {
+        statement &sKernel = *(kernels[k].sKernel);
+
+        for (size_t a = 0; a < kernels[k].argPos.size(); ++a) {
+          varInfo &arg   = *(sKernel.getFunctionArgVar(a));
+          const int pos = kernels[k].argPos[a];
+
+          if (fusedArgs[pos] == NULL)
+            fusedArgs[pos] = &arg;
+
+          if (!arg.hasQualifier("const"))
+            argIsConst[pos] = false;
+        }
+      }
+
+      stringVector_t argNames(argCount);
+      std::string argSource;
+
+      for (int pos = 0; pos < argCount; ++pos) {
+        OCCA_CHECK(fusedArgs[pos] != NULL,
+                   "Fused argument [" << pos << "] is not passed to any kernel");
+
+        const std::string &baseName = fusedArgs[pos]->name;
+        std::string &name = argNames[pos];
+
+        name = baseName;
+
+        for (int n = 0; ; ++n) {
+          bool isTaken = ((std::find(argNames.begin(), argNames.begin() + pos, name) !=
+                           (argNames.begin() + pos)) ||
+                          globalScope->hasVariableInLocalScope(name));
+
+          for (int k = 0; !isTaken && (k < kernelCount); ++k)
+            isTaken = !variableNameIsFree(*(kernels[k].sKernel), name);
+
+          if (!isTaken)
+            break;
+
+          name = baseName + "_" + occa::toString(n);
+        }
+
+        varInfo arg = fusedArgs[pos]->clone();
+        arg.name = name;
+
+        if (!argIsConst[pos])
+          arg.removeQualifier("const");
+
+        if (pos)
+          argSource += ", ";
+
+        argSource += arg.toString();
+      }
+
+      // Kernel arguments take the fused names, arguments a kernel
+      //   writes to are copied first
+      varToStrMap_t originalNames;
+
+      for (int k = 0; k < kernelCount; ++k) {
+        fusionKernel_t &fk = kernels[k];
+        statement &sKernel = *(fk.sKernel);
+
+        for (size_t a = 0; a < fk.argPos.size(); ++a) {
+          varInfo &arg = *(sKernel.getFunctionArgVar(a));
+          const std::string &fusedArgName = argNames[fk.argPos[a]];
+
+          if (originalNames.find(&arg) == originalNames.end())
+            originalNames[&arg] = arg.name;
+
+          if (!statementWritesVariable(sKernel, arg)) {
+            arg.name = fusedArgName;
+            continue;
+          }
+
+          std::string copyName = fusedArgName + "_copy";
+
+          for (int n = 0; !variableNameIsFree(sKernel, copyName) ||
+                 (std::find(argNames.begin(), argNames.end(), copyName) != argNames.end()); ++n) {
+            copyName = fusedArgName + "_copy" + occa::toString(n);
+          }
+
+          arg.name = copyName;
+          fk.argCopies += arg.toString() + " = " + fusedArgName + ";\n";
+        }
+
+        if (fk.argCopies.size() == 0)
+          storeFusionLoopNest(fk);
+      }
+      //================================
+
+      for (int k = 0; k < kernelCount; ++k)
+        setFusionLoopTags(*(kernels[k].sKernel), true);
+
+      std::string source = ("occaKernel void " + fusedName + "(" + argSource + ") {\n");
+
+      std::vector<fusionKernel_t*> group;
+
+      for (int k = 0; k <= kernelCount; ++k) {
+        if ((k < kernelCount) &&
+            group.size()      &&
+            canMergeLoopNests(group, kernels[k], originalNames)) {
+
+          group.push_back(&(kernels[k]));
+          continue;
+        }
+
+        if (group.size() == 1)
+          source += fusedBlockSource(*(group[0]));
+        else if (group.size())
+          source += fusedNestSource(group);
+
+        group.clear();
+
+        if (k < kernelCount)
+          group.push_back(&(kernels[k]));
+      }
+
+      source += "}\n";
+
+      for (int k = 0; k < kernelCount; ++k)
+        setFusionLoopTags(*(kernels[k].sKernel), false);
+
+      varToStrMapIterator it = originalNames.begin();
+
+      while (it != originalNames.end()) {
+        it->first->name = it->second;
+        ++it;
+      }
+
+      globalScope->addStatementFromSource(source);
+    }
+
+    void parserBase::loadFusionKernel(fusionKernel_t &fk,
+                                      const std::string &fusionInfo) {
+      std::stringstream ss(fusionInfo);
+      std::string kernelName;
+
+      ss >> kernelName;
+
+      statementNode *snPos = globalScope->statementStart;
+
+      while (snPos) {
+        statement &s = *(snPos->value);
+
+        if ((s.info & smntType::functionDefinition) &&
+            (s.getFunctionName() == kernelName)) {
+
+          fk.sKernel = &s;
+          break;
+        }
+
+        snPos = snPos->right;
+      }
+
+      OCCA_CHECK(fk.sKernel != NULL,
+                 "Could not find kernel [" << kernelName << "] to fuse");
+
+      int pos;
+
+      while (ss >> pos)
+        fk.argPos.push_back(pos);
+
+      OCCA_CHECK((int) fk.argPos.size() == fk.sKernel->getFunctionArgCount(),
+                 "Kernel [" << kernelName << "] takes " << fk.sKernel->getFunctionArgCount()
+                 << " arguments, " << fk.argPos.size() << " were passed");
+
+      for (size_t a = 0; a < fk.argPos.size(); ++a)
+        fk.argMap[fk.sKernel->getFunctionArgVar(a)] = fk.argPos[a];
+    }
+
+    //  Kernels can merge with others if their body is one nest of
+    //    [outer] and [inner] loops
+    bool parserBase::storeFusionLoopNest(fusionKernel_t &fk) {
+      statement *s = fk.sKernel;
+
+      while (true) {
+        statement *loop = NULL;
+        statementNode *snPos = s->statementStart;
+
+        while (snPos) {
+          statement &s2 = *(snPos->value);
+          snPos = snPos->right;
+
+          if (s2.info & smntType::blankStatement)
+            continue;
+
+          if ((loop != NULL)                       ||
+              (s2.info != smntType::occaFor)       ||
+              (fusionLoopIterator(s2) == NULL)) {
+
+            loop = NULL;
+            break;
+          }
+
+          loop = &s2;
+        }
+
+        if (loop == NULL)
+          break;
+
+        fk.loops.push_back(loop);
+        s = loop;
+      }
+
+      // Nests end with an [inner] or [tile] loop
+      for (size_t l = 0; l < fk.loops.size(); ++l) {
+        const std::string tag = fk.loops[l]->attribute("occaTag").valueStr();
+
+        if ((tag == "tile") && (l == 0)) {
+          fk.loops.resize(1);
+          break;
+        }
+
+        if ((tag != "outer") && (tag != "inner")) {
+          fk.loops.resize(l);
+          break;
+        }
+      }
+
+      while (fk.loops.size() &&
+             (fk.loops.back()->attribute("occaTag").valueStr() == "outer")) {
+
+        fk.loops.pop_back();
+      }
+
+      const bool hasNest = (fk.loops.size() &&
+                            (fk.loops[0]->attribute("occaTag").valueStr() != "inner"));
+
+      if (!hasNest)
+        fk.loops.clear();
+
+      return hasNest;
+    }
+
+    bool parserBase::canMergeLoopNests(std::vector<fusionKernel_t*> &group,
+                                       fusionKernel_t &fk,
+                                       varToStrMap_t &originalNames) {
+
+      fusionKernel_t &first = *(group[0]);
+
+      if (first.loops.empty() ||
+          (first.loops.size() != fk.loops.size())) {
+
+        return false;
+      }
+
+      // Use the iterator names from the first kernel
+      varToStrMap_t iterNames;
+      bool canMerge = true;
+
+      for (size_t l = 0; canMerge && (l < fk.loops.size()); ++l) {
+        varInfo &iter            = *fusionLoopIterator(*(fk.loops[l]));
+        const std::string &name = fusionLoopIterator(*(first.loops[l]))->name;
+
+        iterNames[&iter] = iter.name;
+
+        canMerge = ((name == iter.name) ||
+                    variableNameIsFree(*(fk.sKernel), name));
+
+        iter.name = name;
+      }
+
+      for (size_t l = 0; canMerge && (l < fk.loops.size()); ++l) {
+        std::string header1 = first.loops[l]->onlyThisToString();
+        std::string header2 = fk.loops[l]->onlyThisToString();
+
+        strip(header1);
+        strip(header2);
+
+        canMerge = (header1 == header2);
+      }
+
+      if (canMerge) {
+        fusionAccessMap_t accesses;
+
+        for (size_t k = 0; k < group.size(); ++k)
+          storeFusionAccesses(*(group[k]->loops.back()), *(group[k]), k, accesses);
+
+        storeFusionAccesses(*(fk.loops.back()), fk, group.size(), accesses);
+
+        fusionAccessMap_t::iterator it = accesses.begin();
+
+        while (canMerge && (it != accesses.end())) {
+          const fusionAccess_t &access = it->second;
+
+          canMerge = (!access.isWritten           ||
+                      (access.kernels.size() == 1) ||
+                      ((access.indices.size() == 1) &&
+                       (*(access.indices.begin()) != "?")));
+          ++it;
+        }
+      }
+
+      varToStrMapIterator it = iterNames.begin();
+
+      while (it != iterNames.end()) {
+        if (canMerge) {
+          if (originalNames.find(it->first) == originalNames.end())
+            originalNames[it->first] = it->second;
+        }
+        else
+          it->first->name = it->second;
+
+        ++it;
+      }
+
+      return canMerge;
+    }
+
+    varInfo* parserBase::fusionLoopIterator(statement &s) {
+      if (s.getForStatementCount() < 3)
+        return NULL;
+
+      expNode &node1 = *(s.getForStatement(0));
+
+      if ((node1.info != expType::declaration) ||
+          (node1.getVariableCount() != 1)) {
+
+        return NULL;
+      }
+
+      expNode *iterNode = node1.getVariableInfoNode(0);
+
+      if ((iterNode == NULL) ||
+          ((iterNode->info & expType::varInfo) == 0)) {
+
+        return NULL;
+      }
+
+      return &(iterNode->getVarInfo());
+    }
+
+    //  OKL loop tags are stored as attributes, they are added back as
+    //    the 4th for-loop statement while printing kernels to fuse:
+    //
+    //    for(int i = 0; i < N; ++i; tile(16))
+    std::string parserBase::fusionLoopTag(statement &s) {
+      attribute_t *occaTagAttr = s.hasAttribute("occaTag");
+
+      if (occaTagAttr == NULL)
+        return "";
+
+      const std::string tag = occaTagAttr->valueStr();
+
+      if (tag == "tile") {
+        attribute_t &tileDimAttr = s.attribute("tileDim");
+        std::string tileTag = "tile(";
+
+        for (int i = 0; i < tileDimAttr.argCount; ++i) {
+          if (i)
+            tileTag += ", ";
+
+          tileTag += tileDimAttr.argStr(i);
+        }
+
+        return (tileTag + ")");
+      }
+
+      const std::string nest = s.attribute("occaNest").valueStr();
+
+      return ((nest == "auto") ? tag : (tag + nest));
+    }
+
+    void parserBase::setFusionLoopTags(statement &s,
+                                       const bool showTags) {
+      statementNode *snPos = s.statementStart;
+
+      while (snPos) {
+        statement &s2 = *(snPos->value);
+        snPos = snPos->right;
+
+        if (s2.info == smntType::occaFor) {
+          if (showTags && (s2.expRoot.leafCount == 3)) {
+            const std::string tag = fusionLoopTag(s2);
+
+            if (tag.size())
+              s2.expRoot.addNode(expType::presetValue, tag);
+          }
+          else if (!showTags && (s2.expRoot.leafCount == 4)) {
+            delete s2.expRoot.leaves[3];
+            s2.expRoot.removeNode(3);
+          }
+        }
+
+        setFusionLoopTags(s2, showTags);
+      }
+    }
+
+    void parserBase::storeFusionAccesses(statement &s,
+                                         fusionKernel_t &fk,
+                                         const int kernelPos,
+                                         fusionAccessMap_t &accesses) {
+
+      statementNode *snPos = s.statementStart;
+
+      while (snPos) {
+        statement &s2 = *(snPos->value);
+
+        for (int i = 0; i < s2.expRoot.leafCount; ++i)
+          storeFusionAccesses(s2.expRoot[i], fk, kernelPos, false, accesses);
+
+        storeFusionAccesses(s2, fk, kernelPos, accesses);
+
+        snPos = snPos->right;
+      }
+    }
+
+    //  Array accesses are stored with their indices, pointers used
+    //    any other way are stored with an unknown index [?]
+    void parserBase::storeFusionAccesses(expNode &e,
+                                         fusionKernel_t &fk,
+                                         const int kernelPos,
+                                         const bool isWrite,
+                                         fusionAccessMap_t &accesses) {
+
+      if ((e.info & expType::LR) &&
+          (e.value == "[")       &&
+          (e.leafCount == 2)) {
+
+        expNode *base = &e;
+
+        while ((base->info & expType::LR) &&
+               (base->value == "[")       &&
+               (base->leafCount == 2)) {
+
+          storeFusionAccesses(*(base->leaves[1]), fk, kernelPos, false, accesses);
+          base = base->leaves[0];
+        }
+
+        if (base->info & expType::varInfo) {
+          std::map<varInfo*, int>::iterator it = fk.argMap.find(&(base->getVarInfo()));
+
+          if (it != fk.argMap.end()) {
+            fusionAccess_t &access = accesses[it->second];
+
+            std::string index = (fusionIndexIsKnown(e, fk) ? e.toString() : "?");
+            index.erase(std::remove_if(index.begin(), index.end(), ::isspace),
+                        index.end());
+
+            access.indices.insert(index);
+            access.kernels.insert(kernelPos);
+            access.isWritten |= isWrite;
+          }
+
+          return;
+        }
+
+        storeFusionAccesses(*base, fk, kernelPos, isWrite, accesses);
+        return;
+      }
+
+      if (e.info & expType::varInfo) {
+        varInfo &var = e.getVarInfo();
+        std::map<varInfo*, int>::iterator it = fk.argMap.find(&var);
+
+        if ((it != fk.argMap.end()) &&
+            (var.pointerCount || var.stackPointerCount)) {
+
+          // Pointers passed to functions could be written
+          fusionAccess_t &access = accesses[it->second];
+
+          access.indices.insert("?");
+          access.kernels.insert(kernelPos);
+          access.isWritten = true;
+        }
+
+        return;
+      }
+
+      if ((e.info & expType::LR) &&
+          isAnAssOperator(e.value) &&
+          (e.leafCount == 2)) {
+
+        storeFusionAccesses(e[0], fk, kernelPos, true , accesses);
+        storeFusionAccesses(e[1], fk, kernelPos, false, accesses);
+        return;
+      }
+
+      const bool isUpdate = ((e.info & expType::L_R) &&
+                             ((e.value == "++") || (e.value == "--")));
+
+      for (int i = 0; i < e.leafCount; ++i)
+        storeFusionAccesses(e[i], fk, kernelPos, (isWrite || isUpdate), accesses);
+    }
+
+    // Indices can only use the loop iterators and kernel arguments
+    bool parserBase::fusionIndexIsKnown(expNode &e,
+                                        fusionKernel_t &fk) {
+      expNode &flatRoot = *(e.makeFlatHandle());
+      bool isKnown = true;
+
+      for (int i = 0; isKnown && (i < flatRoot.leafCount); ++i) {
+        expNode &leaf = flatRoot[i];
+
+        if ((leaf.info & expType::varInfo) == 0)
+          continue;
+
+        varInfo *var = &(leaf.getVarInfo());
+
+        isKnown = (fk.argMap.find(var) != fk.argMap.end());
+
+        for (size_t l = 0; !isKnown && (l < fk.loops.size()); ++l)
+          isKnown = (fusionLoopIterator(*(fk.loops[l])) == var);
+      }
+
+      expNode::freeFlatHandle(flatRoot);
+
+      return isKnown;
+    }
+
+    bool parserBase::statementWritesVariable(statement &s,
+                                             varInfo &var) {
+      statementNode *snPos = s.statementStart;
+
+      while (snPos) {
+        statement &s2 = *(snPos->value);
+        snPos = snPos->right;
+
+        expNode &flatRoot = *(s2.expRoot.makeFlatHandle());
+        bool writesVar = false;
+
+        for (int i = 0; !writesVar && (i < flatRoot.leafCount); ++i) {
+          expNode &leaf = flatRoot[i];
+
+          const bool setsValue = (((leaf.info & expType::LR) &&
+                                   isAnAssOperator(leaf.value)) ||
+                                  ((leaf.info & expType::L_R) &&
+                                   ((leaf.value == "++") ||
+                                    (leaf.value == "--"))));
+
+          writesVar = (setsValue           &&
+                       leaf.leafCount      &&
+                       (leaf[0].info & expType::varInfo) &&
+                       (&(leaf[0].getVarInfo()) == &var));
+        }
+
+        expNode::freeFlatHandle(flatRoot);
+
+        if (writesVar || statementWritesVariable(s2, var))
+          return true;
+      }
+
+      return false;
+    }
+
+    // Checks variables declared inside [s]
+    bool parserBase::variableNameIsFree(statement &s,
+                                        const std::string &varName,
+                                        varInfo *ignoredVar) {
+      statementNode *snPos = s.statementStart;
+
+      while (snPos) {
+        statement &s2 = *(snPos->value);
+        snPos = snPos->right;
+
+        varInfo *var = s2.hasVariableInLocalScope(varName);
+
+        if ((var != NULL) && (var != ignoredVar))
+          return false;
+
+        if (!variableNameIsFree(s2, varName, ignoredVar))
+          return false;
+      }
+
+      return true;
+    }
+
+    std::string parserBase::fusedNestSource(std::vector<fusionKernel_t*> &group) {
+      statementVector_t &loops = group[0]->loops;
+      std::string source;
+
+      for (size_t l = 0; l < loops.size(); ++l) {
+        std::string header = loops[l]->onlyThisToString();
+        strip(header);
+
+        if (header.size() && (header[header.size() - 1] == '{'))
+          header.erase(header.size() - 1);
+
+        source += header + " {\n";
+      }
+
+      for (size_t k = 0; k < group.size(); ++k) {
+        statementNode *snPos = group[k]->loops.back()->statementStart;
+
+        source += "{\n";
+
+        while (snPos) {
+          source += (std::string) *(snPos->value);
+          snPos = snPos->right;
+        }
+
+        source += "}\n";
+      }
+
+      for (size_t l = 0; l < loops.size(); ++l)
+        source += "}\n";
+
+      return source;
+    }
+
+    std::string parserBase::fusedBlockSource(fusionKernel_t &fk) {
+      std::string source = "{\n" + fk.argCopies;
+
+      statementNode *snPos = fk.sKernel->statementStart;
+
+      while (snPos) {
+        source += (std::string) *(snPos->value);
+        snPos = snPos->right;
+      }
+
+      return (source + "}\n");
+    }
+    //==================================
+
     int parserBase::getKernelOuterDim(statement &s) {
       return getKernelDimFor(s, "outer");
     }
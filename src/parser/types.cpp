@@ -2619,20 +2619,118 @@ namespace occa {
 
     //---[ Kernel Info ]--------------------------
     argumentInfo::argumentInfo() :
+      name(),
       pos(0),
       isConst(false) {}
 
     argumentInfo::argumentInfo(const argumentInfo &info) :
+      name(info.name),
       pos(info.pos),
       isConst(info.isConst) {}
 
     argumentInfo& argumentInfo::operator = (const argumentInfo &info){
+      name    = info.name;
       pos     = info.pos;
       isConst = info.isConst;
 
       return *this;
     }
 
+    kernelCostInfo::kernelCostInfo() :
+      flops(),
+      bytesLoaded(),
+      bytesStored(),
+      isExact(true) {}
+
+    kernelCostInfo::kernelCostInfo(const kernelCostInfo &cost) :
+      flops(cost.flops),
+      bytesLoaded(cost.bytesLoaded),
+      bytesStored(cost.bytesStored),
+      isExact(cost.isExact) {}
+
+    kernelCostInfo& kernelCostInfo::operator = (const kernelCostInfo &cost){
+      flops       = cost.flops;
+      bytesLoaded = cost.bytesLoaded;
+      bytesStored = cost.bytesStored;
+      isExact     = cost.isExact;
+
+      return *this;
+    }
+
+    bool kernelCostInfo::isEmpty() const {
+      return ((flops.size()       == 0) &&
+              (bytesLoaded.size() == 0) &&
+              (bytesStored.size() == 0));
+    }
+
+    static void addCostTerm(std::string &expr,
+                            const std::string &iterations,
+                            const int count){
+      if(count == 0)
+        return;
+
+      std::stringstream ss;
+
+      // Use long literals to avoid overflowing large iteration counts
+      ss << count << 'L';
+
+      if(iterations != "1")
+        ss << " * " << iterations;
+
+      if(expr.size())
+        expr += " + ";
+
+      expr += ss.str();
+    }
+
+    void kernelCostInfo::addTerm(const std::string &iterations,
+                                 const int flops_,
+                                 const int bytesLoaded_,
+                                 const int bytesStored_){
+
+      addCostTerm(flops      , iterations, flops_);
+      addCostTerm(bytesLoaded, iterations, bytesLoaded_);
+      addCostTerm(bytesStored, iterations, bytesStored_);
+    }
+
+    double kernelCostInfo::evaluate(const std::string &expr,
+                                    const strToStrMap_t &argValues){
+      if(expr.size() == 0)
+        return 0;
+
+      std::string expandedExpr;
+      const char *c = expr.c_str();
+
+      while(*c != '\0'){
+        const char *cStart = c;
+
+        if(('0' <= *c) && (*c <= '9')){
+          while(isalnum(*c) || (*c == '.'))
+            ++c;
+
+          expandedExpr += std::string(cStart, c - cStart);
+        }
+        else if(isalpha(*c) || (*c == '_')){
+          while(isalnum(*c) || (*c == '_'))
+            ++c;
+
+          cStrToStrMapIterator it = argValues.find(std::string(cStart, c - cStart));
+
+          // Missing argument values can't be estimated
+          if(it == argValues.end())
+            return 0;
+
+          expandedExpr += '(';
+          expandedExpr += it->second;
+          expandedExpr += "L)";
+        }
+        else
+          expandedExpr += *(c++);
+      }
+
+      return evaluateString(expandedExpr).to<double>();
+    }
+
     kernelInfo::kernelInfo() :
       name(),
       baseName() {}
@@ -2641,7 +2739,8 @@ namespace occa {
       name(info.name),
       baseName(info.baseName),
       nestedKernels(info.nestedKernels),
-      argumentInfos(info.argumentInfos) {}
+      argumentInfos(info.argumentInfos),
+      cost(info.cost) {}
 
     kernelInfo& kernelInfo::operator = (const kernelInfo &info){
       name     = info.name;
@@ -2650,6 +2749,8 @@ namespace occa {
       nestedKernels = info.nestedKernels;
       argumentInfos = info.argumentInfos;
 
+      cost = info.cost;
+
       return *this;
     }
 
@@ -2663,6 +2764,8 @@ namespace occa {
 
       kInfo.argumentInfos = argumentInfos;
 
+      kInfo.cost = cost;
+
       return kInfo;
     }
     //==============================================
@@ -2677,7 +2780,8 @@ namespace occa {
     name(kInfo.name),
     baseName(kInfo.baseName),
     nestedKernels(kInfo.nestedKernels),
-    argumentInfos(kInfo.argumentInfos) {}
+    argumentInfos(kInfo.argumentInfos),
+    cost(kInfo.cost) {}
 
   parsedKernelInfo& parsedKernelInfo::operator = (const parsedKernelInfo &kInfo){
     name     = kInfo.name;
@@ -2687,6 +2791,8 @@ namespace occa {
 
     argumentInfos = kInfo.argumentInfos;
 
+    cost = kInfo.cost;
+
     return *this;
   }
 
@@ -0,0 +1,486 @@
+#include "occa/reduction.hpp"
+
+namespace occa {
+  //---[ Reductions ]-----------------------------
+  reductionOp::reductionOp() :
+    combine("a + b"),
+    transform("x"),
+    inputs(1) {}
+
+  reductionOp::reductionOp(const std::string &combine_,
+                           const std::string &transform_,
+                           const int inputs_) :
+    combine(combine_),
+    transform(transform_),
+    inputs(inputs_) {}
+
+  reductionOp reductionOp::comparison(const std::string &compare_){
+    reductionOp op("", "x");
+    op.compare = compare_;
+
+    return op;
+  }
+
+  bool reductionOp::tracksIndex() const {
+    return (compare.size() != 0);
+  }
+
+  std::string reductionOp::key() const {
+    std::stringstream ss;
+
+    ss << inputs << '|' << combine << '|' << transform << '|' << compare;
+
+    return ss.str();
+  }
+
+  namespace reduction {
+    class deviceCache_t {
+    public:
+      std::map<std::string, kernel> kernels;
+      occa::memory values, indices;
+    };
+
+    static mutex_t cacheMutex;
+    static std::map<device_v*, deviceCache_t> caches;
+
+    bool usesCPULayout(occa::device device){
+      const std::string &mode = device.mode();
+
+      return ((mode == "Serial") ||
+              (mode == "OpenMP") ||
+              (mode == "Pthreads"));
+    }
+
+    // The op's expressions are inlined in blocks that declare
+    //   their variables, helper functions would be called through
+    //   the PLT in CPU modes
+    static void combineInto(std::stringstream &ss,
+                            const std::string &indent,
+                            const std::string &type,
+                            const reductionOp &op,
+                            const std::string &acc,
+                            const std::string &value,
+                            const std::string &index){
+      if(!op.tracksIndex()){
+        ss << indent << "  const " << type << " a = " << acc << ";\n"
+           << indent << "  const " << type << " b = " << value << ";\n"
+           << indent << "  " << acc << " = (" << op.combine << ");\n";
+        return;
+      }
+
+      ss << indent << "  const " << type << " a  = " << value << ";\n"
+         << indent << "  const int ai = " << index << ";\n"
+         << indent << "  const " << type << " b  = " << acc << ";\n"
+         << indent << "  const int bi = " << acc << "Idx;\n"
+         << indent << "  if((" << op.compare << ") || ((a == b) && (ai < bi))){\n"
+         << indent << "    " << acc << "    = a;\n"
+         << indent << "    " << acc << "Idx = ai;\n"
+         << indent << "  }\n";
+    }
+
+    // Merges [value] (at [index]) into accumulator [acc]
+    static void accumulate(std::stringstream &ss,
+                           const std::string &indent,
+                           const std::string &type,
+                           const reductionOp &op,
+                           const std::string &acc,
+                           const std::string &value,
+                           const std::string &index){
+      ss << indent << "{\n";
+      combineInto(ss, indent, type, op, acc, value, index);
+      ss << indent << "}\n";
+    }
+
+    // Merges entry [i] of the input into accumulator [acc],
+    //   the first stage transforms the entries
+    static void accumulateEntry(std::stringstream &ss,
+                                const std::string &indent,
+                                const std::string &type,
+                                const reductionOp &op,
+                                const int stage,
+                                const std::string &acc,
+                                const std::string &i){
+      ss << indent << "{\n";
+
+      if(stage == 0){
+        ss << indent << "  const " << type << " x = inX[" << i << "];\n";
+
+        if(op.inputs == 2)
+          ss << indent << "  const " << type << " y = inY[" << i << "];\n";
+
+        combineInto(ss, indent, type, op, acc,
+                    "(" + op.transform + ")",
+                    i);
+      }
+      else {
+        combineInto(ss, indent, type, op, acc,
+                    "inX[" + i + "]",
+                    "inIdx[" + i + "]");
+      }
+
+      ss << indent << "}\n";
+    }
+
+    // 16-bit types are accumulated in float
+    static std::string computeType(const std::string &type){
+      if((type == "half") || (type == "bfloat16"))
+        return "float";
+
+      return type;
+    }
+
+    std::string kernelSource(const std::string &type,
+                             const reductionOp &op,
+                             const int stage,
+                             const bool cpuLayout){
+      const bool tracksIndex = op.tracksIndex();
+      const std::string ctype = computeType(type);
+      std::stringstream ss;
+
+      ss << "kernel void occaReduce(const int entries,\n"
+         << "                       const int groups,\n"
+         << "                       const int chunk,\n"
+         << "                       const int outOffset,\n"
+         << "                       const " << type << " identity,\n"
+         << "                       const " << type << " *inX,\n"
+         << "                       const " << type << " *inY,\n"
+         << "                       const int *inIdx,\n"
+         << "                       " << type << " *out,\n"
+         << "                       int *outIdx){\n"
+         << "  for(int g = 0; g < groups; ++g; outer0){\n";
+
+      if(cpuLayout){
+        // One contiguous chunk per thread, the accumulators are
+        //   independent so the loads and combines can overlap
+        const int U = cpuUnroll;
+
+        ss << "    for(int t = 0; t < 1; ++t; inner0){\n"
+           << "      const int start = g * chunk;\n"
+           << "      const int end   = ((start + chunk) < entries) ? (start + chunk) : entries;\n"
+           << "      const int unrolledEnd = (start < end) ? (start + ((end - start) / " << U << ") * " << U << ") : start;\n\n";
+
+        for(int u = 0; u < U; ++u){
+          ss << "      " << ctype << " acc" << u << " = identity;\n";
+
+          if(tracksIndex)
+            ss << "      int acc" << u << "Idx = entries;\n";
+        }
+
+        ss << "\n"
+           << "      for(int i = start; i < unrolledEnd; i += " << U << "){\n";
+
+        for(int u = 0; u < U; ++u)
+          accumulateEntry(ss, "        ", ctype, op, stage,
+                          "acc" + toString(u),
+                          "i + " + toString(u));
+
+        ss << "      }\n\n"
+           << "      for(int i = unrolledEnd; i < end; ++i){\n";
+
+        accumulateEntry(ss, "        ", ctype, op, stage, "acc0", "i");
+
+        ss << "      }\n\n";
+
+        for(int s = 1; s < U; s *= 2){
+          for(int u = 0; u < U; u += 2*s){
+            const std::string acc = "acc" + toString(u + s);
+
+            accumulate(ss, "      ", ctype, op,
+                       "acc" + toString(u),
+                       acc,
+                       acc + "Idx");
+          }
+        }
+
+        ss << "\n"
+           << "      out[outOffset + g] = acc0;\n";
+
+        if(tracksIndex)
+          ss << "      outIdx[outOffset + g] = acc0Idx;\n";
+
+        ss << "    }\n";
+      }
+      else {
+        const int N = gpuInnerSize;
+
+        ss << "    shared " << ctype << " s_acc[" << N << "];\n";
+
+        if(tracksIndex)
+          ss << "    shared int s_idx[" << N << "];\n";
+
+        ss << "\n"
+           << "    for(int t = 0; t < " << N << "; ++t; inner0){\n"
+           << "      " << ctype << " acc = identity;\n";
+
+        if(tracksIndex)
+          ss << "      int accIdx = entries;\n";
+
+        ss << "\n"
+           << "      for(int i = (g * " << N << ") + t; i < entries; i += (groups * " << N << ")){\n";
+
+        accumulateEntry(ss, "        ", ctype, op, stage, "acc", "i");
+
+        ss << "      }\n\n"
+           << "      s_acc[t] = acc;\n";
+
+        if(tracksIndex)
+          ss << "      s_idx[t] = accIdx;\n";
+
+        ss << "    }\n";
+
+        for(int s = (N / 2); 0 < s; s /= 2){
+          const std::string other = "t + " + toString(s);
+
+          ss << "\n"
+             << "    barrier(localMemFence);\n\n"
+             << "    for(int t = 0; t < " << N << "; ++t; inner0){\n"
+             << "      if(t < " << s << "){\n"
+             << "        " << ctype << " acc = s_acc[t];\n";
+
+          if(tracksIndex)
+            ss << "        int accIdx = s_idx[t];\n";
+
+          accumulate(ss, "        ", ctype, op,
+                     "acc",
+                     "s_acc[" + other + "]",
+                     "s_idx[" + other + "]");
+
+          if(1 < s){
+            ss << "        s_acc[t] = acc;\n";
+
+            if(tracksIndex)
+              ss << "        s_idx[t] = accIdx;\n";
+          }
+          else {
+            ss << "        out[outOffset + g] = acc;\n";
+
+            if(tracksIndex)
+              ss << "        outIdx[outOffset + g] = accIdx;\n";
+          }
+
+          ss << "      }\n"
+             << "    }\n";
+        }
+      }
+
+      ss << "  }\n"
+         << "}\n";
+
+      return ss.str();
+    }
+
+    // Partials fit [maxGroups] values of any supported type
+    //   and the combined value after them
+    static deviceCache_t& cacheFor(occa::device device){
+      std::map<device_v*, deviceCache_t>::iterator it = caches.find(device.getDHandle());
+
+      if(it != caches.end())
+        return it->second;
+
+      deviceCache_t &cache = caches[device.getDHandle()];
+
+      cache.values  = device.malloc((maxGroups + 1) * sizeof(double));
+      cache.indices = device.malloc((maxGroups + 1) * sizeof(int));
+
+      return cache;
+    }
+
+    kernel kernelFor(occa::device device,
+                     const std::string &type,
+                     const reductionOp &op,
+                     const int stage){
+
+      deviceCache_t &cache = cacheFor(device);
+
+      const std::string key = type + '|' + toString(stage) + '|' + op.key();
+
+      std::map<std::string, kernel>::iterator it = cache.kernels.find(key);
+
+      if(it != cache.kernels.end())
+        return it->second;
+
+      const bool vc = verboseCompilation_f;
+
+      if(vc)
+        verboseCompilation_f = false;
+
+      kernel k = device.buildKernelFromString(kernelSource(type, op, stage,
+                                                           usesCPULayout(device)),
+                                              "occaReduce",
+                                              usingOKL);
+
+      verboseCompilation_f = vc;
+
+      cache.kernels[key] = k;
+
+      return k;
+    }
+
+    int groupsFor(occa::device device,
+                  const uintptr_t entries){
+      uintptr_t groups;
+
+      if(usesCPULayout(device)){
+        if(device.mode() == "Serial"){
+          groups = 1;
+        }
+        else {
+          int threads = device.getProperty<int>("threadCount");
+
+          if(threads <= 0)
+            threads = device.getProperty<int>("logicalCores");
+
+          groups = std::min((uintptr_t) std::max(threads, 1),
+                            (entries + cpuChunkSize - 1) / cpuChunkSize);
+        }
+      }
+      else {
+        groups = ((entries + gpuInnerSize - 1) / gpuInnerSize);
+      }
+
+      return (int) std::max((uintptr_t) 1,
+                            std::min((uintptr_t) maxGroups, groups));
+    }
+
+    static void launch(kernel &k,
+                       const int entries,
+                       const int groups,
+                       const int chunk,
+                       const int outOffset,
+                       const kernelArg &identity,
+                       occa::memory x,
+                       occa::memory y,
+                       occa::memory xIdx,
+                       occa::memory out,
+                       occa::memory outIdx){
+      k.clearArgumentList();
+
+      k.addArgument(0, entries);
+      k.addArgument(1, groups);
+      k.addArgument(2, chunk);
+      k.addArgument(3, outOffset);
+      k.addArgument(4, identity);
+      k.addArgument(5, x);
+      k.addArgument(6, y);
+      k.addArgument(7, xIdx);
+      k.addArgument(8, out);
+      k.addArgument(9, outIdx);
+
+      k.runFromArguments();
+    }
+
+    void run(occa::memory x,
+             occa::memory y,
+             const std::string &type,
+             const size_t typeBytes,
+             const reductionOp &op,
+             const kernelArg &identity,
+             const uintptr_t entries,
+             void *result,
+             uintptr_t *index){
+
+      OCCA_CHECK(entries <= (uintptr_t) std::numeric_limits<int>::max(),
+                 "Reductions are limited to [" << std::numeric_limits<int>::max() << "] entries");
+
+      OCCA_CHECK(typeBytes <= sizeof(double),
+                 "Reductions only support types up to [" << sizeof(double) << "] bytes");
+
+      if(index)
+        *index = 0;
+
+      if(entries == 0)
+        return;
+
+      occa::device device(x.getDHandle());
+
+      cacheMutex.lock();
+
+      deviceCache_t &cache = cacheFor(device);
+
+      const int groups = groupsFor(device, entries);
+
+      // Chunks start on cache lines
+      int chunk = (int) ((entries + groups - 1) / groups);
+      chunk = (((chunk + 63) / 64) * 64);
+
+      kernel partialK = kernelFor(device, type, op, 0);
+
+      launch(partialK,
+             (int) entries, groups, chunk, 0,
+             identity,
+             x, y, cache.indices,
+             cache.values, cache.indices);
+
+      int offset = 0;
+
+      if(1 < groups){
+        kernel combineK = kernelFor(device, type, op, 1);
+
+        // Pthreads threads run their queued launches independently,
+        //   the partials have to be written before they are combined
+        if(device.mode() == "Pthreads")
+          device.finish();
+
+        launch(combineK,
+               groups, 1, groups, groups,
+               identity,
+               cache.values, cache.values, cache.indices,
+               cache.values, cache.indices);
+
+        offset = groups;
+      }
+
+      cache.values.copyTo(result, typeBytes, offset * typeBytes);
+
+      if(index){
+        int index_;
+        cache.indices.copyTo(&index_, sizeof(int), offset * sizeof(int));
+
+        *index = (uintptr_t) index_;
+      }
+
+      cacheMutex.unlock();
+    }
+
+    static void freeCache(deviceCache_t &cache){
+      std::map<std::string, kernel>::iterator it = cache.kernels.begin();
+
+      while(it != cache.kernels.end()){
+        it->second.free();
+        ++it;
+      }
+
+      cache.values.free();
+      cache.indices.free();
+    }
+
+    void free(occa::device device){
+      cacheMutex.lock();
+
+      std::map<device_v*, deviceCache_t>::iterator it = caches.find(device.getDHandle());
+
+      if(it != caches.end()){
+        freeCache(it->second);
+        caches.erase(it);
+      }
+
+      cacheMutex.unlock();
+    }
+
+    void free(){
+      cacheMutex.lock();
+
+      std::map<device_v*, deviceCache_t>::iterator it = caches.begin();
+
+      while(it != caches.end()){
+        freeCache(it->second);
+        ++it;
+      }
+
+      caches.clear();
+
+      cacheMutex.unlock();
+    }
+  }
+  //==============================================
+}
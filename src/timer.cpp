@@ -107,6 +107,14 @@ namespace occa {
         // times[keyStack].timeTaken += kernel.timeTaken();
         times[keyStack].timeTaken += elapsedTime;
         times[keyStack].numCalls++;
+
+        // Use the parser's estimates when available
+        const double bw = kernel.estimatedBytes();
+
+        times[keyStack].flopCount      += kernel.estimatedFlops();
+        times[keyStack].bandWidthCount += bw;
+
+        dataTransferred += bw;
       }
 
       keyStack.pop();
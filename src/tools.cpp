@@ -1,5 +1,7 @@
 #include <fstream>
+#include <algorithm>
 #include <cstddef>
+#include <ctime>
 
 #include "occa/tools.hpp"
 #include "occa/base.hpp"
@@ -18,6 +20,7 @@ namespace occa {
 
     std::string OCCA_DIR, OCCA_CACHE_DIR;
     size_t OCCA_MEM_BYTE_ALIGN;
+    uintptr_t OCCA_CACHE_MAX_SIZE;
     stringVector_t OCCA_INCLUDE_PATH;
 
     void initialize() {
@@ -78,6 +81,21 @@ namespace occa {
         }
       }
 
+      // Unbounded cache unless set (e.g. 500M, 2G)
+      OCCA_CACHE_MAX_SIZE = bytesFromString(env::var("OCCA_CACHE_MAX_SIZE"));
+
+      // [1] compiles CPU kernels in memory, [persist] also caches them
+      const std::string inMemory = env::var("OCCA_IN_MEMORY_COMPILATION");
+
+      if (inMemory.size() && (inMemory != "0"))
+        setInMemoryCompilation(true, inMemory == "persist");
+
+      // [1] compiles CPU kernels through one server per node
+      const std::string compileServer = env::var("OCCA_COMPILE_SERVER");
+
+      if (compileServer.size() && (compileServer != "0"))
+        setUseCompileServer(true);
+
       isInitialized = true;
     }
 
@@ -250,6 +268,22 @@ namespace occa {
 #endif
     }
 
+    void rmrf(const std::string &dir_) {
+      std::string dir = dir_;
+      env::endDirWithSlash(dir);
+
+      const stringVector_t files = filesIn(dir);
+      const stringVector_t dirs  = directoriesIn(dir);
+
+      for(size_t i = 0; i < files.size(); ++i)
+        ::remove((dir + files[i]).c_str());
+
+      for(size_t i = 0; i < dirs.size(); ++i)
+        rmrf(dir + dirs[i]);
+
+      rmdir(dir);
+    }
+
     int mkdir(const std::string &dir) {
       errno = 0;
 
@@ -360,6 +394,83 @@ namespace occa {
       return ret;
     }
 
+    static stringVector_t entriesIn(const std::string &dir_,
+                                    const bool wantDirectories) {
+      stringVector_t entries;
+
+      std::string dir = getFilename(dir_);
+      env::endDirWithSlash(dir);
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      DIR *dirHandle = opendir(dir.c_str());
+
+      if (dirHandle == NULL)
+        return entries;
+
+      struct dirent *entry;
+
+      while((entry = readdir(dirHandle)) != NULL) {
+        const std::string name = entry->d_name;
+
+        if ((name == ".") || (name == ".."))
+          continue;
+
+        if (dirExists(dir + name) == wantDirectories)
+          entries.push_back(name);
+      }
+
+      closedir(dirHandle);
+#else
+      WIN32_FIND_DATA findData;
+      HANDLE findHandle = FindFirstFile((dir + "*").c_str(), &findData);
+
+      if (findHandle == INVALID_HANDLE_VALUE)
+        return entries;
+
+      do {
+        const std::string name = findData.cFileName;
+
+        if ((name == ".") || (name == ".."))
+          continue;
+
+        const bool isDirectory = (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY);
+
+        if (isDirectory == wantDirectories)
+          entries.push_back(name);
+      } while(FindNextFile(findHandle, &findData));
+
+      FindClose(findHandle);
+#endif
+
+      return entries;
+    }
+
+    stringVector_t filesIn(const std::string &dir) {
+      return entriesIn(dir, false);
+    }
+
+    stringVector_t directoriesIn(const std::string &dir) {
+      return entriesIn(dir, true);
+    }
+
+    uintptr_t fileBytes(const std::string &filename) {
+      struct stat statInfo;
+
+      if (stat(getFilename(filename).c_str(), &statInfo) != 0)
+        return 0;
+
+      return (uintptr_t) statInfo.st_size;
+    }
+
+    long lastModified(const std::string &filename) {
+      struct stat statInfo;
+
+      if (stat(getFilename(filename).c_str(), &statInfo) != 0)
+        return 0;
+
+      return (long) statInfo.st_mtime;
+    }
+
     void absolutePathVec(const std::string &path_,
                          stringVector_t &pathVec) {
 
@@ -460,6 +571,7 @@ namespace occa {
   namespace kc {
     std::string sourceFile = "source.occa";
     std::string binaryFile = "binary";
+    std::string infoFile   = "info";
   }
   //==================================
 
@@ -757,8 +869,24 @@ namespace occa {
     std::string lockDir   = getFileLock(hash, depth);
     const char *c_lockDir = lockDir.c_str();
 
-    while(stat(c_lockDir, &buffer) == 0)
-      ; // Do Nothing
+    // Don't take cores away from the process holding the lock
+    while(stat(c_lockDir, &buffer) == 0) {
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+      ::usleep(1000);
+#else
+      Sleep(1);
+#endif
+    }
+  }
+
+  bool haveCachedBinary(const std::string &hash,
+                        const std::string &binaryFilename) {
+    // Holding the lock keeps evictCache() from removing the binary
+    //   and lets us build it if another builder failed
+    while(!haveHash(hash, 0))
+      waitForHash(hash, 0);
+
+    return sys::fileExists(binaryFilename);
   }
 
   void releaseHash(const std::string &hash, const int depth) {
@@ -775,6 +903,8 @@ namespace occa {
 
     return ((ext == "okl") ||
             (ext == "ofl") ||
+            (ext == "oak") ||
+            (ext == "oaf") ||
             (ext == "cl") ||
             (ext == "cu"));
   }
@@ -792,7 +922,8 @@ namespace occa {
     flags_t parserFlags = info.getParserFlags();
 
     parserFlags["mode"]     = deviceMode;
-    parserFlags["language"] = ((extension != "ofl") ? "C" : "Fortran");
+    parserFlags["language"] = (((extension != "ofl") &&
+                                (extension != "oaf")) ? "C" : "Fortran");
 
     if ((extension == "oak") ||
        (extension == "oaf")) {
@@ -883,6 +1014,28 @@ namespace occa {
       delete [] source;
   }
 
+  std::string createSourceFrom(const std::string &filename,
+                               const kernelInfo &info) {
+    std::stringstream ss;
+
+    setupOccaHeaders(info);
+
+    ss << "#include \"" << info.getModeHeaderFilename() << "\"\n"
+       << "#include \"" << sys::getFilename("[occa]/primitives.hpp") << "\"\n";
+
+    if (info.mode & (Serial | OpenMP | Pthreads | CUDA)) {
+      ss << "#if defined(OCCA_IN_KERNEL) && !OCCA_IN_KERNEL\n"
+         << "using namespace occa;\n"
+         << "#endif\n";
+    }
+
+
+    ss << info.header
+       << readFile(filename);
+
+    return ss.str();
+  }
+
   void createSourceFileFrom(const std::string &filename,
                             const std::string &hashDir,
                             const kernelInfo &info) {
@@ -894,25 +1047,348 @@ namespace occa {
 
     sys::mkpath(hashDir);
 
-    setupOccaHeaders(info);
-
     std::ofstream fs;
     fs.open(sourceFile.c_str());
 
-    fs << "#include \"" << info.getModeHeaderFilename() << "\"\n"
-       << "#include \"" << sys::getFilename("[occa]/primitives.hpp") << "\"\n";
+    fs << createSourceFrom(filename, info);
 
-    if (info.mode & (Serial | OpenMP | Pthreads | CUDA)) {
-      fs << "#if defined(OCCA_IN_KERNEL) && !OCCA_IN_KERNEL\n"
-         << "using namespace occa;\n"
-         << "#endif\n";
+    fs.close();
+  }
+  //==============================================
+
+
+  //---[ Cache Info ]-----------------------------
+  cacheInfo_t::cacheInfo_t() :
+    parseTime(0),
+    compileTime(0),
+    binaryBytes(0),
+    lastUsed(0),
+    hits(0) {}
+
+  cacheInfo_t::cacheInfo_t(const std::string &hashDir_) :
+    parseTime(0),
+    compileTime(0),
+    binaryBytes(0),
+    lastUsed(0),
+    hits(0) {
+
+    load(hashDir_);
+  }
+
+  bool cacheInfo_t::load(const std::string &hashDir_) {
+    hashDir = hashDir_;
+    env::endDirWithSlash(hashDir);
+
+    std::ifstream fs((hashDir + kc::infoFile).c_str());
+
+    if (!fs.is_open())
+      return false;
+
+    std::string line;
+
+    while(std::getline(fs, line)) {
+      const size_t colon = line.find(':');
+
+      if (colon == std::string::npos)
+        continue;
+
+      std::string key   = line.substr(0, colon);
+      std::string value = line.substr(colon + 1);
+
+      strip(key);
+      strip(value);
+
+      const char *c = value.c_str();
+
+      if (key == "function")
+        functionName = value;
+      else if (key == "command")
+        command = value;
+      else if (key == "parseTime")
+        parseTime = atof(c);
+      else if (key == "compileTime")
+        compileTime = atof(c);
+      else if (key == "binaryBytes")
+        binaryBytes = (uintptr_t) atol(c);
+      else if (key == "lastUsed")
+        lastUsed = atol(c);
+      else if (key == "hits")
+        hits = atoi(c);
     }
 
+    return true;
+  }
 
-    fs << info.header
-       << readFile(filename);
+  void cacheInfo_t::write() const {
+    if (!sys::dirExists(hashDir))
+      return;
+
+    // Written to a temporary file and renamed so concurrent
+    //   readers never see a partial file
+    const std::string infoFilename = (hashDir + kc::infoFile);
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    const std::string tmpFilename  = (infoFilename + "." + toString(getpid()));
+#else
+    const std::string tmpFilename  = (infoFilename + "." + toString(GetCurrentProcessId()));
+#endif
+
+    std::ofstream fs(tmpFilename.c_str());
+
+    if (!fs.is_open())
+      return;
+
+    fs << "function: "    << functionName << '\n'
+       << "command: "     << command      << '\n'
+       << "parseTime: "   << parseTime    << '\n'
+       << "compileTime: " << compileTime  << '\n'
+       << "binaryBytes: " << binaryBytes  << '\n'
+       << "lastUsed: "    << lastUsed     << '\n'
+       << "hits: "        << hits         << '\n';
 
     fs.close();
+
+    if (rename(tmpFilename.c_str(), infoFilename.c_str()) != 0)
+      remove(tmpFilename.c_str());
+  }
+
+  uintptr_t cacheInfo_t::bytes() const {
+    uintptr_t bytes_ = 0;
+
+    const stringVector_t files = sys::filesIn(hashDir);
+
+    for(size_t i = 0; i < files.size(); ++i)
+      bytes_ += sys::fileBytes(hashDir + files[i]);
+
+    return bytes_;
+  }
+
+  void recordParse(const std::string &hashDir,
+                   const std::string &functionName,
+                   const double parseTime) {
+
+    cacheInfo_t info(hashDir);
+
+    info.functionName = functionName;
+    info.parseTime    = parseTime;
+    info.lastUsed     = (long) time(NULL);
+
+    info.write();
+  }
+
+  void recordCompilation(const std::string &hashDir,
+                         const std::string &functionName,
+                         const std::string &command,
+                         const double compileTime,
+                         const std::string &binaryFilename) {
+
+    cacheInfo_t info(hashDir);
+
+    info.functionName = functionName;
+    info.command      = command;
+    info.compileTime  = compileTime;
+    info.binaryBytes  = sys::fileBytes(binaryFilename);
+    info.lastUsed     = (long) time(NULL);
+
+    // Compile commands are built with a trailing std::endl
+    for(size_t i = 0; i < info.command.size(); ++i) {
+      if (info.command[i] == '\n')
+        info.command[i] = ' ';
+    }
+
+    strip(info.command);
+
+    info.write();
+
+    evictCacheInBackground();
+  }
+
+  void recordCacheHit(const std::string &hashDir) {
+    cacheInfo_t info(hashDir);
+
+    ++info.hits;
+    info.lastUsed = (long) time(NULL);
+
+    info.write();
+  }
+
+  static bool isHashName(const std::string &name) {
+    if (name.size() != 16)
+      return false;
+
+    for(int i = 0; i < 16; ++i) {
+      const char c = name[i];
+
+      if (!((('0' <= c) && (c <= '9')) ||
+            (('a' <= c) && (c <= 'f')))) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  stringVector_t cachedHashDirs(const std::string &cacheDir) {
+    stringVector_t hashDirs;
+
+    const std::string kernelDir  = (cacheDir + "kernels/");
+    const std::string libraryDir = (cacheDir + "libraries/");
+
+    stringVector_t dirs = sys::directoriesIn(kernelDir);
+
+    for(size_t i = 0; i < dirs.size(); ++i) {
+      if (isHashName(dirs[i]))
+        hashDirs.push_back(kernelDir + dirs[i] + "/");
+    }
+
+    const stringVector_t libraries = sys::directoriesIn(libraryDir);
+
+    for(size_t l = 0; l < libraries.size(); ++l) {
+      const std::string libDir = (libraryDir + libraries[l] + "/");
+
+      dirs = sys::directoriesIn(libDir);
+
+      for(size_t i = 0; i < dirs.size(); ++i) {
+        if (isHashName(dirs[i]))
+          hashDirs.push_back(libDir + dirs[i] + "/");
+      }
+    }
+
+    return hashDirs;
+  }
+  static bool sortByLastUsed(const cacheInfo_t &a, const cacheInfo_t &b) {
+    return (a.lastUsed < b.lastUsed);
+  }
+
+  uintptr_t evictCache(const std::string &cacheDir,
+                       const uintptr_t maxBytes,
+                       int &evictedEntries) {
+
+    // Entries used this recently can still be between their
+    //   cache lookup and loading the binary
+    const long gracePeriod = 60;
+    const long now         = (long) time(NULL);
+
+    evictedEntries = 0;
+
+    const stringVector_t hashDirs = cachedHashDirs(cacheDir);
+    const int entries = (int) hashDirs.size();
+
+    std::vector<cacheInfo_t> infos(entries);
+    std::vector<uintptr_t> entryBytes(entries);
+
+    uintptr_t cacheBytes = 0;
+
+    for(int i = 0; i < entries; ++i) {
+      cacheInfo_t &info = infos[i];
+
+      if (!info.load(hashDirs[i]) || (info.lastUsed == 0))
+        info.lastUsed = sys::lastModified(hashDirs[i]);
+
+      // binaryBytes holds the entry size while sorting
+      info.binaryBytes = info.bytes();
+      cacheBytes      += info.binaryBytes;
+    }
+
+    if (cacheBytes <= maxBytes)
+      return 0;
+
+    std::sort(infos.begin(), infos.end(), sortByLastUsed);
+
+    const std::string lockDir  = (cacheDir + "locks/");
+    const std::string trashDir = (cacheDir + "trash/");
+
+    sys::mkpath(lockDir);
+    sys::mkpath(trashDir);
+
+    uintptr_t freedBytes = 0;
+
+    for(int i = 0; (i < entries) && (maxBytes < (cacheBytes - freedBytes)); ++i) {
+      const cacheInfo_t &info = infos[i];
+
+      if ((now - info.lastUsed) < gracePeriod)
+        break;
+
+      std::string hash = info.hashDir.substr(0, info.hashDir.size() - 1);
+      hash = hash.substr(hash.rfind('/') + 1);
+
+      // Same lock builders take in haveHash(), skip entries being built
+      const std::string hashLock = (lockDir + hash + "_0");
+
+      if (sys::mkdir(hashLock) != 0)
+        continue;
+
+      // Renaming first keeps builders from seeing a partial entry
+      const std::string trashEntry = (trashDir + hash + "_" + toString((long) now));
+
+      const bool moved = (rename(info.hashDir.substr(0, info.hashDir.size() - 1).c_str(),
+                                 trashEntry.c_str()) == 0);
+
+      sys::rmdir(hashLock);
+
+      if (!moved)
+        continue;
+
+      sys::rmrf(trashEntry);
+
+      freedBytes += info.binaryBytes;
+      ++evictedEntries;
+    }
+
+    return freedBytes;
+  }
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+  static volatile bool evictingCache = false;
+
+  static void* evictCacheThread(void *args) {
+    std::string *cacheDir = (std::string*) args;
+
+    int evictedEntries;
+    evictCache(*cacheDir, env::OCCA_CACHE_MAX_SIZE, evictedEntries);
+
+    delete cacheDir;
+    evictingCache = false;
+
+    return NULL;
+  }
+#endif
+
+  void evictCacheInBackground() {
+    if (env::OCCA_CACHE_MAX_SIZE == 0)
+      return;
+
+    // Scanning large caches is expensive, only check once a minute
+    const std::string stampFile = (env::OCCA_CACHE_DIR + "locks/lastEviction");
+    const long now = (long) time(NULL);
+
+    if ((now - sys::lastModified(stampFile)) < 60)
+      return;
+
+    sys::mkpath(env::OCCA_CACHE_DIR + "locks/");
+    writeToFile(stampFile, toString(now));
+
+#if (OCCA_OS & (LINUX_OS | OSX_OS))
+    if (evictingCache)
+      return;
+
+    evictingCache = true;
+
+    pthread_t thread;
+    pthread_attr_t attr;
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    if (pthread_create(&thread, &attr,
+                       evictCacheThread, new std::string(env::OCCA_CACHE_DIR)) != 0) {
+      evictingCache = false;
+    }
+
+    pthread_attr_destroy(&attr);
+#else
+    int evictedEntries;
+    evictCache(env::OCCA_CACHE_DIR, env::OCCA_CACHE_MAX_SIZE, evictedEntries);
+#endif
   }
   //==============================================
 
@@ -1166,6 +1642,28 @@ namespace occa {
     return ret;
   }
 
+  uintptr_t bytesFromString(const std::string &str) {
+    const char *c = str.c_str();
+
+    skipWhitespace(c);
+
+    uintptr_t bytes = occa::atoi(c);
+
+    while(isADigit(*c))
+      ++c;
+
+    skipWhitespace(c);
+
+    switch(*c) {
+    case 'T': case 't': bytes <<= 10;
+    case 'G': case 'g': bytes <<= 10;
+    case 'M': case 'm': bytes <<= 10;
+    case 'K': case 'k': bytes <<= 10;
+    }
+
+    return bytes;
+  }
+
   uintptr_t atoi(const std::string &str){
     return occa::atoi((const char*) str.c_str());
   }